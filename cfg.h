@@ -4,11 +4,12 @@
 
 /*
  * MAX_SAMPLES defines the maximum number of input samples (and therefore DFT
- * bins). This is a practical limit to avoid problems with corrupted inputs and,
- * in the case of precomputed twiddle factors, identifies the limits to which
- * the algorithm is able to operate.
+ * bins). This is a practical limit to avoid problems with corrupted inputs.
+ * fft.c generates its twiddle factors at runtime for sizes beyond the
+ * precomputed tables, so the real limit is the physical memory, which fft.c
+ * checks before allocating.
  */
-#define MAX_SAMPLES ((size_t)4096U)
+#define MAX_SAMPLES ((size_t)1U << 40)
 
 /*
  * TIMING_TEST: number of iterations to repeat the DFT calculation
@@ -20,6 +21,13 @@
  */
 //#define TIMING_TEST 20000U
 
+/*
+ * Power of 2 engine selection
+ * All of the engines below are compiled into fft.c. These macros select the
+ * one used by the default "estimate" planner; the "measure" planner (-p
+ * measure) times all of them on the current machine and picks the fastest.
+ */
+
 /*
  * FEATURE_NONRECURSIVE: compute the FFT iteratively
  * Rather than using the recursive implementation (which is preserved for
@@ -33,10 +41,33 @@
  * FEATURE_PRECOMPUTED_TWIDDLE_FACTORS: use precomputed twiddle factors
  * Rather than computing the complex exponential factors in the course of
  * executing the algorithm, look them up from the precomputed tables in
- * twiddle.h.
+ * twiddle.h (for sizes that fit in the tables).
  * Only applicable to fft.c.
  */
 #define FEATURE_PRECOMPUTED_TWIDDLE_FACTORS
 
+/*
+ * FEATURE_FFT_PLAN: use the fft_plan tables for power of 2 sizes
+ * The twiddle factors and bit-reverse table are generated once at runtime when
+ * the plan is created, so any power of 2 size up to MAX_SAMPLES can be
+ * transformed without regenerating twiddle.h. The Bluestein and Rader
+ * convolutions always use them.
+ * Takes precedence over FEATURE_NONRECURSIVE and
+ * FEATURE_PRECOMPUTED_TWIDDLE_FACTORS.
+ * Only applicable to fft.c.
+ */
+#define FEATURE_FFT_PLAN
+
+/*
+ * TWIDDLE_HEADER: the header generated by twiddle.py that fft.c includes
+ * The Makefile overrides it to build fft.c against headers generated with
+ * each of the twiddle.py layouts, so that the engines for those layouts are
+ * compiled and tested as well.
+ * Only applicable to fft.c.
+ */
+#ifndef TWIDDLE_HEADER
+#define TWIDDLE_HEADER "twiddle.h"
+#endif
+
 #endif /* DFT_CFG_H */
 
@@ -1,4 +1,5 @@
 #include <complex.h>
+#include <errno.h>
 #include <getopt.h>
 #include <math.h>
 #include <stdbool.h>
@@ -8,12 +9,25 @@
 #include "cfg.h"
 
 /*** #define values ***/
+/* number of bins evaluated together by goertzel() - one SIMD lane per bin */
+#define GOERTZEL_LANES 8
+
+/* goertzel() switches to Reinsch's modification above this |cos(w)|, i.e. for
+   bins within n/8 of 0 or n/2 */
+#define GOERTZEL_REINSCH_COS M_SQRT1_2
+
+/* largest input (samples times channels) that dft accepts, well below
+   MAX_SAMPLES since the full DFT is O(N²) and the input is allocated from
+   the size in the testcase header */
+#define DFT_MAX_SAMPLES ((size_t)40960U)
 
 /*** global variables ***/
 /* option arguments */
 bool option_verbose = false;
 const char* option_input_file = NULL;
 const char* option_output_file = NULL;
+size_t* option_bins = NULL; //note: malloc in parse_bin_list()
+size_t option_num_bins = 0;
 
 /* line pointer for read_input_line helper */
 char* ril_lineptr = NULL;
@@ -39,7 +53,7 @@ char* ril_lineptr = NULL;
 noreturn void print_help(int exit_code)
 {
     fprintf(stderr, "\
-usage dft [-v] [-h] [-i INPUT] [-o OUTPUT]\n\
+usage dft [-v] [-h] [-i INPUT] [-o OUTPUT] [-b BINS]\n\
 \n\
 This program will read a test case .tc file from stdin and compute\n\
 the Discrete Fourier Transform for it and print the result to stdout.\n\
@@ -49,19 +63,61 @@ options:\n\
   -h, --help                  show this help message and exit\n\
   -i INPUT, --input INPUT     specify an input file\n\
   -o OUPTUT, --output OUTPUT  specify an output file\n\
+  -b BINS, --bins BINS        only compute the comma-separated list of bins\n\
+                              (uses the Goertzel algorithm)\n\
 ");
 
     exit(exit_code);
 }
 
+/* parse a comma-separated list of bin numbers into option_bins
+   and return false on error */
+bool parse_bin_list(const char* list)
+{
+    bool retval = true;
+    const char* p = list;
+
+    //count the separators to size the allocation
+    option_num_bins = 1;
+    for (const char* c = list; '\0' != *c; c++) {
+        if (',' == *c)
+            option_num_bins++;
+    }
+
+    free(option_bins);
+    option_bins = malloc(option_num_bins * sizeof(*option_bins));
+    if (NULL == option_bins) {
+        error("Error allocating %zd bytes for bin list\n", (option_num_bins * sizeof(*option_bins)));
+        option_num_bins = 0;
+        return false;
+    }
+
+    for (size_t i=0; i<option_num_bins; i++) {
+        char* endptr;
+
+        errno = 0;
+        option_bins[i] = strtoul(p, &endptr, 0);
+        if ((p == endptr) || (0 != errno) || ((',' != *endptr) && ('\0' != *endptr))) {
+            error("Error parsing bin list at \"%s\"\n", p);
+            retval = false;
+/*BREAK*/   break;
+        }
+        verbose("bin %zd: %zd\n", i, option_bins[i]);
+        p = endptr + 1;
+    }
+
+    return retval;
+}
+
 /* parse command line input options and return status */
 int parse_args(int argc, char* const argv[])
 {
     int retval = 0;
-    static const char* optstring = "i:o:hv";
+    static const char* optstring = "i:o:b:hv";
     static struct option long_options[] = {
         {"input",   required_argument, 0, 'i'},
         {"output",  required_argument, 0, 'o'},
+        {"bins",    required_argument, 0, 'b'},
         {"help",    no_argument,       0, 'h'},
         {"verbose", no_argument,       0, 'v'},
         {0,         0,                 0, 0}
@@ -95,6 +151,13 @@ int parse_args(int argc, char* const argv[])
                 option_output_file = optarg;
                 break;
 
+            case 'b':
+                if (!parse_bin_list(optarg)) {
+                    retval=1;
+/*BREAK*/           c=-1;
+                }
+                break;
+
             case '?':
                 /* intentional fall-through */
             default:
@@ -132,14 +195,14 @@ char* read_input_line(void)
     return ril_lineptr;
 }
 
-/* read a single long integer from stdin into "out", return false on error */
-bool read_one_long(long* out)
+/* read the first line with any long integers from stdin into "out", up to
+   max of them, return the number read or 0 on error */
+int read_longs(long* out, int max)
 {
-    bool retval = false;
+    int retval = 0;
     char* lineptr = NULL;
 
     while(true) {
-        unsigned long res;
         char* endptr;
 
         lineptr = read_input_line();
@@ -147,27 +210,28 @@ bool read_one_long(long* out)
         if (NULL == lineptr) //EOL or error
 /*BREAK*/   break;
 
-        endptr = lineptr;
-        res = strtoul(lineptr, &endptr, 0);
-        if (lineptr != endptr) {
+        for (endptr = lineptr; retval < max; lineptr = endptr) {
+            unsigned long res = strtoul(lineptr, &endptr, 0);
+            if (lineptr == endptr)
+/*BREAK*/       break;
             /* success - this is relatively forgiving pass criteria */
-            *out = res;
-            retval = true;
-/*BREAK*/   break;
+            out[retval++] = res;
         }
+        if (retval > 0)
+/*BREAK*/   break;
     }
 
     return retval;
 }
 
-/* read a single double from stdin into "out", return false on error */
-bool read_one_double(double* out)
+/* read the first line with any doubles from stdin into "out", which must
+   have count of them, return false on error */
+bool read_doubles(double* out, long count)
 {
-    bool retval = false;
+    long num_read = 0;
     char* lineptr = NULL;
 
     while(true) {
-        double res;
         char* endptr;
 
         lineptr = read_input_line();
@@ -175,38 +239,55 @@ bool read_one_double(double* out)
         if (NULL == lineptr) //EOL or error
 /*BREAK*/   break;
 
-        endptr = lineptr;
-        res = strtod(lineptr, &endptr);
-        if (lineptr != endptr) {
+        for (endptr = lineptr; num_read < count; lineptr = endptr) {
+            double res = strtod(lineptr, &endptr);
+            if (lineptr == endptr)
+/*BREAK*/       break;
             /* success - this is relatively forgiving pass criteria */
-            *out = res;
-            retval = true;
-/*BREAK*/   break;
+            out[num_read++] = res;
         }
+        if (num_read > 0)
+/*BREAK*/   break;
     }
 
-    return retval;
+    return (num_read == count);
 }
 
 /* parse testcase data from stdin into input_buf (caller must free)
-   and return the number of samples or -1 on error */
-long parse_input(double** input_buf)
+   and return the number of samples per channel or -1 on error
+   The first line may give the number of channels after the number of
+   samples, then each line holds one frame of that many samples, which are
+   stored one channel after the other: input_buf[c*num_samples + n] */
+long parse_input(double** input_buf, long* num_channels)
 {
     long retval = -1;
+    long header[2] = {0, 1}; //number of samples, number of channels
     long num_samples = 0;
+    long channels = 1;
+    double* frame = NULL;
     size_t i;
 
-    if (read_one_long(&num_samples)) {
-        verbose("num_samples = %ld\n", num_samples);
-        if ((num_samples > 0) && (num_samples <= MAX_SAMPLES)) {
-            *input_buf = malloc(num_samples * sizeof(**input_buf));
-            if (NULL == *input_buf) {
-                error("Error allocating %zd bytes for input\n", (num_samples * sizeof(float)));
+    if (read_longs(header, 2) > 0) {
+        num_samples = header[0];
+        channels = header[1];
+        verbose("num_samples = %ld, num_channels = %ld\n", num_samples, channels);
+        //the division keeps num_samples*channels*sizeof(double) from
+        //overflowing as well as capping it
+        if ((channels < 1) || (channels > DFT_MAX_SAMPLES)) {
+            error("Error: invalid number of channels provided: %ld\n", channels);
+        } else if ((num_samples > 0) &&
+            ((size_t)num_samples <= (DFT_MAX_SAMPLES / channels))) {
+            *input_buf = malloc(num_samples * channels * sizeof(**input_buf));
+            frame = malloc(channels * sizeof(*frame));
+            if ((NULL == *input_buf) || (NULL == frame)) {
+                error("Error allocating %zd bytes for input\n", (num_samples * channels * sizeof(**input_buf)));
+                free(*input_buf);
+                *input_buf = NULL;
             } else {
                 retval = num_samples;
             }
         } else {
-            error("Error: invalid number of samples provided: %ld\n", num_samples);
+            error("Error: invalid number of samples provided: %ld (at most %zd, across all channels)\n", num_samples, DFT_MAX_SAMPLES);
         }
     } else {
         error("Error parsing testcase number of samples\n");
@@ -214,8 +295,11 @@ long parse_input(double** input_buf)
 
     if (retval > 0) {
         for (i=0; i<num_samples; i++) {
-            if (read_one_double(&((*input_buf)[i]))) {
-                verbose("%ld: %.16lf\n", i, (*input_buf)[i]);
+            if (read_doubles(frame, channels)) {
+                for (long c=0; c<channels; c++) {
+                    (*input_buf)[c*num_samples + i] = frame[c];
+                    verbose("%ld: %.16lf\n", i, frame[c]);
+                }
             } else {
                 error("Error parsing testcase sample %ld\n", i);
                 retval = -1;
@@ -226,6 +310,9 @@ long parse_input(double** input_buf)
         }
     }
 
+    free(frame);
+    *num_channels = channels;
+
     return retval;
 }
 
@@ -266,6 +353,116 @@ void dft(long num_samples, const double* restrict const input_buf,
     }
 }
 
+/* Goertzel block
+ * Runs the Goertzel recurrence for up to GOERTZEL_LANES bins, selected by
+ * their indices in block, over all of input_buf. See goertzel(), reinsch
+ * selects Reinsch's modification over the one-multiply recurrence.
+ */
+void goertzel_block(long num_samples, const double* restrict const input_buf,
+    size_t lanes, const size_t block[GOERTZEL_LANES],
+    const size_t* restrict const bins, bool reinsch,
+    double complex* restrict const transform_buf)
+{
+    double coef[GOERTZEL_LANES];
+    double sigma[GOERTZEL_LANES];
+    double cosw[GOERTZEL_LANES];
+    double sinw[GOERTZEL_LANES];
+    double s[GOERTZEL_LANES] = {0};
+    double d[GOERTZEL_LANES] = {0}; //s[t-2], or the difference for Reinsch
+
+    //unused lanes in the final block just repeat the first bin
+    for (size_t l=0; l<GOERTZEL_LANES; l++) {
+        size_t k = bins[block[(l < lanes) ? l : 0]];
+        //fold k into [0, n/2] to keep w small: cos(w) is symmetric and
+        //sin(w) is antisymmetric about w=π
+        bool folded = (2*k > num_samples);
+        double w = 2*M_PI*(folded ? (num_samples-k) : k)/num_samples;
+        cosw[l] = cos(w);
+        sinw[l] = folded ? -sin(w) : sin(w);
+        if (!reinsch) {
+            sigma[l] = 0;
+            coef[l] = 2*cosw[l];
+        } else if (cosw[l] >= 0) {
+            sigma[l] = 1;
+            coef[l] = -4*sin(w/2)*sin(w/2);
+        } else {
+            sigma[l] = -1;
+            coef[l] = 4*cos(w/2)*cos(w/2);
+        }
+        verbose("Goertzel bin %zd: coef=%.16lf sigma=%+.0lf\n", k, coef[l], sigma[l]);
+    }
+
+    if (reinsch) {
+        for (size_t t=0; t<num_samples; t++) {
+            const double xt = input_buf[t];
+            for (size_t l=0; l<GOERTZEL_LANES; l++) {
+                d[l] = xt + coef[l]*s[l] + sigma[l]*d[l];
+                s[l] = sigma[l]*s[l] + d[l];
+            }
+        }
+        for (size_t l=0; l<lanes; l++)
+            transform_buf[block[l]] = CMPLX(s[l]*coef[l]/2 + sigma[l]*d[l], s[l]*sinw[l]);
+    } else {
+        for (size_t t=0; t<num_samples; t++) {
+            const double xt = input_buf[t];
+            for (size_t l=0; l<GOERTZEL_LANES; l++) {
+                const double s0 = xt + coef[l]*s[l] - d[l];
+                d[l] = s[l];
+                s[l] = s0;
+            }
+        }
+        for (size_t l=0; l<lanes; l++)
+            transform_buf[block[l]] = CMPLX(s[l]*cosw[l] - d[l], s[l]*sinw[l]);
+    }
+
+    for (size_t l=0; l<lanes; l++)
+        verbose("X(%zd) = %+.16lf%+.16lfj\n", bins[block[l]], creal(transform_buf[block[l]]), cimag(transform_buf[block[l]]));
+}
+
+/* Goertzel calculation
+ * Evaluate only the requested bins using the second-order recurrence
+ *   s[t] = x[t] + 2cos(w)*s[t-1] - s[t-2], where w = 2πk/n
+ * which costs a single real multiply per sample and bin. After the last sample
+ * the bin is recovered from the final two states as
+ *   X[k] = s[n-1]*e^(iw) - s[n-2]
+ *
+ * The plain recurrence loses precision for bins near 0 and n/2 since 2cos(w)
+ * approaches ±2, so for |cos(w)| > GOERTZEL_REINSCH_COS Reinsch's
+ * modification is used instead: with σ = ±1 (the sign of cos(w)), track the
+ * difference d[t] = s[t] - σ*s[t-1]
+ *   d[t] = x[t] + (2cos(w)-2σ)*s[t-1] + σ*d[t-1]
+ *   s[t] = σ*s[t-1] + d[t]
+ * where 2cos(w)-2σ is computed as -4sin²(w/2) or 4cos²(w/2) without
+ * cancellation. Then X[k] = s[n-1]*(cos(w)-σ) + σ*d[n-1] + i*s[n-1]*sin(w).
+ *
+ * The bins of each kind are processed GOERTZEL_LANES at a time by
+ * goertzel_block() so that the inner loop over the lanes is vectorized by the
+ * compiler (one SIMD lane per bin).
+ * Note: transform_buf must already be allocated with num_bins elements and
+ *       bins must all be less than num_samples
+ */
+void goertzel(long num_samples, const double* restrict const input_buf,
+    size_t num_bins, const size_t* restrict const bins,
+    double complex* restrict const transform_buf)
+{
+    for (int reinsch=0; reinsch<2; reinsch++) {
+        size_t block[GOERTZEL_LANES]; //indices into bins
+        size_t lanes = 0;
+
+        for (size_t b=0; b<num_bins; b++) {
+            const double c = cos(2*M_PI*bins[b]/num_samples);
+
+            if ((fabs(c) > GOERTZEL_REINSCH_COS) == (bool)reinsch)
+                block[lanes++] = b;
+            if ((GOERTZEL_LANES == lanes) || ((b+1 == num_bins) && (lanes > 0))) {
+                goertzel_block(num_samples, input_buf, lanes, block, bins,
+                    reinsch, transform_buf);
+                lanes = 0;
+            }
+        }
+    }
+}
+
 /* print out the result in the test case output format */
 void print_result(long num_bins, const double complex* const bins)
 {
@@ -306,35 +503,55 @@ int main(int argc, char* const argv[])
 
     if (0 == retval) {
         long num_samples = 0;
+        long num_channels = 1;
         double* input_buf = NULL; //note: free when going out of scope
         double complex* transform_buf = NULL; //note: malloc in this function
 
         // read samples from input
-        num_samples = parse_input(&input_buf);
-        if ((num_samples <= 0) || (num_samples > 40960)) {
+        num_samples = parse_input(&input_buf, &num_channels);
+        if (num_samples <= 0) {
             retval = 2;
         } else {
-            transform_buf = malloc(num_samples * sizeof(*transform_buf));
+            for (size_t i=0; i<option_num_bins; i++) {
+                if (option_bins[i] >= num_samples) {
+                    error("Error: bin %zd out of range for %ld samples\n", option_bins[i], num_samples);
+                    retval = 2;
+                }
+            }
+        }
 
+        if (0 == retval) {
+            long num_bins = (option_num_bins > 0) ? option_num_bins : num_samples;
+            transform_buf = malloc(num_bins * sizeof(*transform_buf));
+            if (NULL == transform_buf)
+                retval = 3;
+
+            // each channel is transformed and printed in turn
+            for (long c=0; (c<num_channels) && (0 == retval); c++) {
+                const double* const channel = &input_buf[c*num_samples];
 #if (TIMING_TEST > 0)
-            for (
-              size_t timing_counter = 0;
-              timing_counter < (size_t)TIMING_TEST;
-              timing_counter++
-            ) {
+                for (
+                  size_t timing_counter = 0;
+                  timing_counter < (size_t)TIMING_TEST;
+                  timing_counter++
+                ) {
 #endif
-              // perform DFT processing
-              dft(num_samples, input_buf, transform_buf);
+                  if (option_num_bins > 0) {
+                      // perform Goertzel processing on the selected bins
+                      goertzel(num_samples, channel, option_num_bins,
+                          option_bins, transform_buf);
+                  } else {
+                      // perform DFT processing
+                      dft(num_samples, channel, transform_buf);
+                  }
 #if (TIMING_TEST > 0)
-            }
+                }
 #endif
-            if (NULL != transform_buf) {
                 // write output
-                print_result(num_samples, transform_buf);
-                free(transform_buf);
-            } else {
-                retval = 3;
+                print_result(num_bins, transform_buf);
             }
+
+            free(transform_buf);
         }
 
         if (NULL != input_buf)
@@ -344,5 +561,8 @@ int main(int argc, char* const argv[])
     if (NULL != ril_lineptr)
         free(ril_lineptr);
 
+    if (NULL != option_bins)
+        free(option_bins);
+
     return retval;
 }
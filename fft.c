@@ -1,39 +1,375 @@
+#define _GNU_SOURCE //sched_getaffinity() and pthread_attr_setaffinity_np()
 #include <assert.h>
 #include <complex.h>
 #include <getopt.h>
 #include <math.h>
+#include <pthread.h>
+#include <sched.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdnoreturn.h>
 #include <string.h>
+#include <time.h>
+#include <unistd.h>
 #include "cfg.h"
 
-#ifdef FEATURE_PRECOMPUTED_TWIDDLE_FACTORS
-#include "twiddle.h"
+#include TWIDDLE_HEADER
+
+#ifdef __SSE3__
+#include <pmmintrin.h>
 #endif
 
 /*** #define values ***/
+/* maximum number of radix stages in a mixed-radix factorization */
+#define MAX_FACTORS 64
+
+/* largest radix supported by the mixed-radix butterflies (Winograd modules) */
+#define MAX_RADIX 16
+
+/* largest Winograd module used for the first stages of the radix-2 FFT */
+#define MAX_LEAF 16
+
+/* number of twiddle factors twiddle_gen_next() streams from each exact seed */
+#define TWIDDLE_SEED_INTERVAL 64
+
+/* constants of the Winograd small-N DFT modules */
+#define W3_C (-1.5) /* cos(2π/3) - 1 */
+#define W3_S 0.86602540378443864676 /* sin(2π/3) */
+#define W5_C1 (-1.25) /* (cos(2π/5) + cos(4π/5))/2 - 1 */
+#define W5_C2 0.55901699437494742410 /* (cos(2π/5) - cos(4π/5))/2 */
+#define W5_S1 0.95105651629515357212 /* sin(2π/5) */
+#define W5_S2 1.53884176858762670130 /* sin(2π/5) + sin(4π/5) */
+#define W5_S3 0.36327126400268044295 /* sin(2π/5) - sin(4π/5) */
+/* with c = cos(2πj/7) and s = sin(2πj/7) for j in generator order 1, 3, 2 */
+#define W7_CA (-1.0/6) /* (c₁ + c₃ + c₂)/3 */
+#define W7_C0 0.28200357860501597827 /* (c₁ - c₂)/3 */
+#define W7_C1 (-0.22614931131536824065) /* (c₃ - c₂)/3 */
+#define W7_C01 0.50815288992038421892 /* (c₁ - c₃)/3 */
+#define W7_SA 0.44095855184409843175 /* (s₁ - s₃ + s₂)/3 */
+#define W7_S0 (-0.06436547657126459944) /* (s₁ - s₂)/3 */
+#define W7_S1 0.46960388376646057583 /* (s₃ + s₂)/3 */
+#define W7_S01 0.40523840719519597639 /* (s₁ + s₃)/3 */
+#define W9_C1 0.76604444311897803520 /* cos(2π/9) */
+#define W9_S1 0.64278760968653932632 /* sin(2π/9) */
+#define W9_C2 0.17364817766693034885 /* cos(4π/9) */
+#define W9_S2 0.98480775301220805937 /* sin(4π/9) */
+#define W9_C4 (-0.93969262078590838405) /* cos(8π/9) */
+#define W9_S4 0.34202014332566873304 /* sin(8π/9) */
+#define W16_C1 0.92387953251128675613 /* cos(π/8) */
+#define W16_S1 0.38268343236508977173 /* sin(π/8) */
+
+/* alignment in bytes of the fft_plan tables and buffers (a cache line) */
+#define PLAN_ALIGNMENT 64
+
+/* π in long double precision for the fft_plan twiddle factors */
+#define PI_L 3.14159265358979323846264338327950288L
+
+/* maximum number of choices the FFT_MEASURE planner times for one size */
+#define MAX_CANDIDATES 16
+
+/* the FFT_MEASURE planner keeps the best of this many timings per candidate,
+   each one repeating the FFT for at least MEASURE_MIN_TIME seconds */
+#define MEASURE_ROUNDS 3
+#define MEASURE_MIN_TIME 1e-3
+
+/* bytes of output that fft_plan_execute_batch() transforms together, one
+   stage at a time, small enough to share L1 with the twiddle factors */
+#define BATCH_BLOCK_BYTES ((size_t)16U << 10)
+
+/* signals that fft_simd_batch() transforms together, one per SIMD lane, and
+   the range of sizes it is used for (the tables plans of these sizes hold its
+   working space) */
+#if defined(__AVX512F__)
+#define SIMD_BATCH_LANES 8
+#else
+#define SIMD_BATCH_LANES 4
+#endif
+#define SIMD_BATCH_MIN_SAMPLES 8
+#define SIMD_BATCH_MAX_SAMPLES 1024
+
+/* smallest power of 2 size that the tables engine splits across the threads
+   of the thread pool (with -t) */
+#define PARALLEL_MIN_SAMPLES ((size_t)1U << 16)
+
+/* environment variable giving the number of threads if -t is not given */
+#define THREADS_ENV "FFT_THREADS"
+
+/* NUMA nodes looked up in sysfs for the CPUs of the thread pool */
+#define MAX_NUMA_NODES 64
+
+/* the parallel recursive FFT forks tasks until there are this many per
+   thread for load balancing, or until they are down to the minimum size */
+#define RECURSIVE_TASKS_PER_THREAD 8
+#define RECURSIVE_MIN_TASK_SAMPLES ((size_t)1U << 12)
+
+/* bytes of tables the plan cache keeps for unused plans */
+#define PLAN_CACHE_MAX_BYTES ((size_t)64U << 20)
+
+/* environment variable naming the wisdom file if -w is not given */
+#define WISDOM_ENV "FFT_WISDOM"
+
+/* floating point precision of the transforms, part of the wisdom key */
+#define WISDOM_PRECISION "double"
+
+/* instruction set the program was compiled for, part of the wisdom key */
+#if defined(__AVX512F__)
+#define WISDOM_ISA "avx512f"
+#elif defined(__AVX2__)
+#define WISDOM_ISA "avx2"
+#elif defined(__AVX__)
+#define WISDOM_ISA "avx"
+#elif defined(__SSE2__)
+#define WISDOM_ISA "sse2"
+#elif defined(__ARM_NEON)
+#define WISDOM_ISA "neon"
+#else
+#define WISDOM_ISA "generic"
+#endif
+
+/*** types ***/
+/* GCC vectors of two doubles (one complex) for the SIMD kernels */
+typedef double v2df __attribute__((vector_size(16), may_alias));
+typedef long long v2di __attribute__((vector_size(16)));
+
+/* GCC vector of one double from each of SIMD_BATCH_LANES signals */
+typedef double vbatch_df __attribute__((vector_size(8*SIMD_BATCH_LANES)));
 
 /*** global variables ***/
 /* option arguments */
 bool option_verbose = false;
+/* suppresses verbose() on the current thread, set for the trial transforms
+   of fft_plan_measure() and carried over to the threads of the pool */
+_Thread_local bool verbose_quiet = false;
 const char* option_input_file = NULL;
 const char* option_output_file = NULL;
 
 /* line pointer for read_input_line helper */
 char* ril_lineptr = NULL;
 
+/* algorithms that fft() can select for a given size */
+enum fft_algorithm {
+    FFT_UNSUPPORTED = 0,
+    FFT_RADIX2, //power of 2 sizes
+    FFT_MIXED_RADIX, //sizes of the form 2^a*3^b*5^c*7^d
+    FFT_RADER, //primes p where p-1 is 2^a*3^b*5^c*7^d
+    FFT_PFA, //products of coprime factors
+    FFT_BLUESTEIN, //any other size
+};
+
+/* implementations of the power of 2 FFT that the planner can choose from */
+enum fft_engine {
+    FFT_ENGINE_TABLES = 0, //fft_plan tables with Winograd leaves of plan->leaf
+    FFT_ENGINE_ITERATIVE, //fft_inner() with runtime twiddle factors
+    FFT_ENGINE_ITERATIVE_PRECOMPUTED, //fft_inner() with twiddle.h
+    FFT_ENGINE_RECURSIVE, //fft_recursive() with runtime twiddle factors
+    FFT_ENGINE_RECURSIVE_PRECOMPUTED, //fft_recursive() with twiddle.h
+    FFT_ENGINE_MIXED_RADIX, //fft_mixed_radix() with radix 16, 8, 4, 2 stages
+    FFT_ENGINE_SPLIT, //fft_layout_inner() with split re/im twiddle.h arrays
+    FFT_ENGINE_DUP, //fft_layout_inner() with duplicated twiddle.h pairs
+    FFT_ENGINE_RADIX4, //fft_layout_inner() with radix-4 twiddle.h triplets
+};
+
+/* how fft_plan_create() chooses the algorithm and engine */
+enum fft_planner {
+    FFT_ESTIMATE = 0, //heuristics of fft_plan_algorithm() and cfg.h
+    FFT_MEASURE, //time every candidate on this machine and keep the fastest
+};
+
+/* direction of the transform, plans serve both directions */
+enum fft_direction {
+    FFT_FORWARD = 0, //X(k) = Σ x(n)*e^(-i2πnk/N)
+    FFT_BACKWARD, //x(n) = Σ X(k)*e^(i2πnk/N), times 1/N if normalized
+};
+
+/* input layout of the transform, part of the plan cache key */
+enum fft_layout {
+    FFT_LAYOUT_REAL = 0, //real samples, see fft_plan_execute()
+    FFT_LAYOUT_COMPLEX, //complex samples, see fft_plan_execute_complex()
+};
+
+/* everything needed to execute an FFT of one size, see fft_plan_create() */
+struct fft_plan {
+    size_t num_samples; //N
+    enum fft_algorithm algorithm;
+    enum fft_engine engine; //FFT_RADIX2 only
+    size_t leaf; //FFT_ENGINE_TABLES: size of the Winograd leaves
+    size_t* bitrev; //FFT_ENGINE_TABLES: N/leaf entries, first input of each leaf
+    double complex* twiddle; //FFT_ENGINE_TABLES: N entries, stage h uses twiddle[h..2h); mixed-radix: N-1 entries, see fft_plan_mixed_radix()
+    int num_factors; //mixed-radix: number of stages
+    int radices[MAX_FACTORS]; //mixed-radix: radix of each stage
+    struct conv_kernel* conv; //FFT_RADER and FFT_BLUESTEIN: convolution kernel
+    struct fft_plan* sub[2]; //FFT_PFA: plans of the N1 columns (NULL for a Winograd module) and N2 rows
+    double complex* scratch; //working space of one execution, see fft_plan_acquire()
+    size_t bytes; //size of the plan and its tables
+
+    /* plan cache bookkeeping, see fft_plan_acquire() */
+    enum fft_layout layout;
+    enum fft_planner planner;
+    size_t refcount; //number of fft_plan_acquire() without fft_plan_release()
+    struct fft_plan* lru_prev; //more recently used plan in the cache
+    struct fft_plan* lru_next; //less recently used plan in the cache
+};
+
+/* precomputed convolution kernel of a Bluestein or Rader plan, the plan's
+   scratch holds the 2M entries of working space for the convolution */
+struct conv_kernel {
+    long num_samples; //N
+    enum fft_algorithm algorithm; //FFT_BLUESTEIN or FFT_RADER
+    long conv_samples; //M, size of the cyclic convolution
+    double complex* chirp; //Bluestein: N entries of e^(-iπn²/N)
+    size_t* perm; //Rader: N-1 entries of g^q mod N
+    double complex* kernel_fft; //M entries of FFT(kernel)/M, bit-reversed with a plan
+    struct fft_plan* plan; //plan for M: complex tables if it is a power of 2, otherwise mixed-radix
+};
+
+/* names of the algorithms and engines for logging */
+const char* const fft_algorithm_names[] = {
+    "unsupported", "radix-2", "mixed-radix", "Rader", "PFA", "Bluestein",
+};
+const char* const fft_engine_names[] = {
+    "tables", "iterative", "iterative-precomputed", "recursive",
+    "recursive-precomputed", "mixed-radix", "split", "dup", "radix4",
+};
+
+/* planner selected with the -p option */
+enum fft_planner option_planner = FFT_ESTIMATE;
+
+/* power of 2 engine selected with the -e option, -1 to leave it to the
+   planner */
+int option_engine = -1;
+
+/* wisdom file selected with the -w option */
+const char* option_wisdom_file = NULL;
+
+/* transform in place into the packed half spectrum, selected with -r */
+bool option_real_inplace = false;
+
+/* input of interleaved channel pairs, selected with -s */
+bool option_stereo = false;
+
+/* direction selected with the -d option, normalization with -n */
+enum fft_direction option_direction = FFT_FORWARD;
+bool option_normalize = false;
+
+/* number of consecutive signals in the input, selected with -m */
+long option_howmany = 1;
+
+/* number of threads for large transforms, selected with -t */
+long option_threads = 1;
+
+/* pin the threads to CPUs grouped by NUMA node, selected with -a */
+bool option_affinity = false;
+
+/* a planner decision remembered in the wisdom file */
+struct wisdom_entry {
+    char* machine; //"CPU model\tISA\tprecision" the decision was made on
+    long num_samples;
+    enum fft_algorithm algorithm;
+    enum fft_engine engine;
+    size_t leaf;
+};
+
+/* wisdom imported from the wisdom file or learned by the FFT_MEASURE planner */
+struct wisdom_entry* wisdom = NULL;
+size_t wisdom_count = 0;
+size_t wisdom_capacity = 0;
+bool wisdom_changed = false; //new entries that are not in the wisdom file yet
+pthread_mutex_t wisdom_lock = PTHREAD_MUTEX_INITIALIZER; //guards the wisdom
+
+/* process-wide cache of plans, most recently used first */
+struct fft_plan* plan_cache_head = NULL;
+struct fft_plan* plan_cache_tail = NULL;
+size_t plan_cache_bytes = 0; //total bytes of the cached plans
+pthread_mutex_t plan_cache_lock = PTHREAD_MUTEX_INITIALIZER; //guards the cache
+
+/* persistent worker threads that run the jobs of thread_pool_run() */
+struct thread_pool {
+    size_t num_threads; //workers plus the calling thread, 0 if not started
+    pthread_t* workers; //num_threads-1 worker threads
+    pthread_mutex_t lock; //guards the fields below
+    pthread_cond_t start; //signalled when a job is posted or on shutdown
+    pthread_cond_t finish; //signalled when the last worker finishes the job
+    pthread_barrier_t barrier; //of num_threads, see thread_pool_barrier()
+    void (*job)(void* arg, size_t index, size_t count); //the current job
+    void* arg; //argument of the current job
+    size_t generation; //number of jobs posted so far
+    size_t busy; //workers that have not finished the current job
+    bool quiet; //verbose_quiet of the thread that posted the current job
+    bool shutdown; //workers exit when set
+};
+struct thread_pool thread_pool = {0};
+
+/* held by the caller that is using the thread pool, see
+   thread_pool_acquire() */
+pthread_mutex_t thread_pool_owner = PTHREAD_MUTEX_INITIALIZER;
+
+/* a node of the fork-join tree of fft_recursive_parallel(), task i forks the
+   tasks 2i+1 (even field) and 2i+2 (odd field) */
+struct recursive_task {
+    size_t depth;
+    long num_samples;
+    const double* input_buf;
+    size_t stride;
+    double complex* transform_buf;
+    int pending; //forked tasks that have not finished, updated atomically
+};
+
+/* work-stealing deque of task indices: the owner thread pushes and pops the
+   bottom (depth first), other threads steal from the top (largest tasks) */
+struct task_deque {
+    pthread_mutex_t lock;
+    size_t* tasks;
+    size_t top;
+    size_t bottom;
+};
+
+/* arguments of fft_recursive_job() */
+struct recursive_job {
+    struct recursive_task* tasks; //the 2^(cutoff+1)-1 nodes of the tree
+    struct task_deque* deques; //one per thread of the pool
+    size_t cutoff; //depth of the tasks that run fft_recursive() serially
+    bool precomputed;
+    int done; //set atomically when the root task finishes
+    size_t queued; //tasks in the deques, updated atomically
+    pthread_mutex_t lock; //guards the sleep of the idle threads on wake
+    pthread_cond_t wake; //signaled when a task is pushed or done is set
+};
+
 /*** function prototypes ***/
+void fft_plan_destroy(struct fft_plan* const plan);
+bool conv_kernel_init(struct fft_plan* const plan);
+bool pfa_init(struct fft_plan* const plan);
+void conv_kernel_free(struct conv_kernel* const entry);
+struct fft_plan* fft_plan_acquire(long num_samples, enum fft_layout layout,
+    enum fft_planner planner);
+void fft_plan_release(struct fft_plan* const plan);
+bool fft_algorithm_execute(const struct fft_plan* const plan,
+    const double* restrict const input_buf,
+    const double complex* restrict const complex_buf,
+    double complex* restrict const transform_buf);
 
 /*** function like macros ***/
 #define ispowerof2(unsigned_val) (0 == (unsigned_val & (unsigned_val - 1)))
 
+/* multiply complex z by -i */
+#define mul_neg_i(z) CMPLX(cimag(z), -creal(z))
+
+/* multiply complex z by the twiddle factor e^(-iθ) = c - is, where c = cos(θ)
+   and s = sin(θ), using real arithmetic */
+#define mul_twiddle(z, c, s) \
+    CMPLX(creal(z)*(c) + cimag(z)*(s), cimag(z)*(c) - creal(z)*(s))
+
+/* read sample n from complex_buf if it is not NULL, otherwise from the real
+   samples in input_buf */
+#define input_sample(input_buf, complex_buf, n) \
+    ((NULL != (complex_buf)) ? (complex_buf)[n] : CMPLX((input_buf)[n], 0))
+
 /* verbose logging */
 #define verbose(...) \
     do { \
-        if (option_verbose) fprintf(stderr, __VA_ARGS__); \
+        if (option_verbose && !verbose_quiet) fprintf(stderr, __VA_ARGS__); \
     } while(0)
 
 /* error logging */
@@ -48,17 +384,50 @@ char* ril_lineptr = NULL;
 noreturn void print_help(int exit_code)
 {
     fprintf(stderr, "\
-usage fft [-v] [-h] [-i INPUT] [-o OUTPUT]\n\
+usage fft [-v] [-h] [-r] [-s] [-n] [-d DIRECTION] [-i INPUT] [-o OUTPUT]\n\
+          [-p PLANNER] [-e ENGINE] [-w WISDOM] [-m HOWMANY] [-t THREADS]\n\
+          [-a]\n\
 \n\
 This program will read a test case .tc file from stdin and compute\n\
 the Fast Fourier Transform for it and print the result to stdout.\n\
-The number of samples in the test case must be a power of 2.\n\
+The number of samples in the test case may be any size up to MAX_SAMPLES.\n\
 \n\
 options:\n\
   -v, --verbose               extra output for debug\n\
   -h, --help                  show this help message and exit\n\
   -i INPUT, --input INPUT     specify an input file\n\
   -o OUPTUT, --output OUTPUT  specify an output file\n\
+  -p PLANNER, --planner PLANNER\n\
+                              estimate (default) picks the algorithm with\n\
+                              heuristics, measure times the candidates on\n\
+                              this machine and keeps the fastest\n\
+  -e ENGINE, --engine ENGINE  use ENGINE for power of 2 sizes instead of the\n\
+                              planner and wisdom: tables, iterative,\n\
+                              iterative-precomputed, recursive,\n\
+                              recursive-precomputed, mixed-radix, or the\n\
+                              split, dup and radix4 twiddle.h layouts\n\
+  -w WISDOM, --wisdom WISDOM  import planner decisions from the file WISDOM\n\
+                              and export new measurements back to it,\n\
+                              defaults to $FFT_WISDOM\n\
+  -r, --real-inplace          transform power of 2 sizes in place into the\n\
+                              packed half spectrum, without an output buffer\n\
+                              (other sizes and -s are rejected)\n\
+  -s, --stereo                the samples are interleaved pairs of two\n\
+                              channels, output the spectrum of each channel\n\
+  -d DIRECTION, --direction DIRECTION\n\
+                              forward (default) or backward, the inverse FFT\n\
+                              of the samples taken as bins; with -r the\n\
+                              samples are a packed half spectrum\n\
+  -n, --normalize             scale the backward transform by 1/N\n\
+  -m HOWMANY, --howmany HOWMANY\n\
+                              the samples are HOWMANY consecutive signals of\n\
+                              equal size, output the spectrum of each signal\n\
+  -t THREADS, --threads THREADS\n\
+                              split power of 2 transforms of 2^16 samples or\n\
+                              more across THREADS threads, defaults to\n\
+                              $FFT_THREADS or 1\n\
+  -a, --affinity              pin the threads to the allowed CPUs, grouped\n\
+                              by NUMA node\n\
 ");
 
     exit(exit_code);
@@ -68,11 +437,21 @@ options:\n\
 int parse_args(int argc, char* const argv[])
 {
     int retval = 0;
-    static const char* optstring = "i:o:hv";
+    static const char* optstring = "i:o:p:e:w:d:m:t:ahnrsv";
     static struct option long_options[] = {
         {"input",   required_argument, 0, 'i'},
         {"output",  required_argument, 0, 'o'},
+        {"planner", required_argument, 0, 'p'},
+        {"engine",  required_argument, 0, 'e'},
+        {"wisdom",  required_argument, 0, 'w'},
         {"help",    no_argument,       0, 'h'},
+        {"real-inplace", no_argument,  0, 'r'},
+        {"stereo",  no_argument,       0, 's'},
+        {"direction", required_argument, 0, 'd'},
+        {"normalize", no_argument,     0, 'n'},
+        {"howmany", required_argument, 0, 'm'},
+        {"threads", required_argument, 0, 't'},
+        {"affinity", no_argument,      0, 'a'},
         {"verbose", no_argument,       0, 'v'},
         {0,         0,                 0, 0}
     };
@@ -105,6 +484,86 @@ int parse_args(int argc, char* const argv[])
                 option_output_file = optarg;
                 break;
 
+            case 'p':
+                if (0 == strcmp(optarg, "estimate")) {
+                    option_planner = FFT_ESTIMATE;
+                } else if (0 == strcmp(optarg, "measure")) {
+                    option_planner = FFT_MEASURE;
+                } else {
+                    error("Error: unknown planner %s\n", optarg);
+                    retval=1;
+/*BREAK*/           c=-1;
+/*NORETURN*/        print_help(1);
+                }
+                break;
+
+            case 'e':
+                for (size_t e=0; e<(sizeof(fft_engine_names)/
+                    sizeof(fft_engine_names[0])); e++) {
+                    if (0 == strcmp(optarg, fft_engine_names[e]))
+                        option_engine = e;
+                }
+                if (option_engine < 0) {
+                    error("Error: unknown engine %s\n", optarg);
+                    retval=1;
+/*BREAK*/           c=-1;
+/*NORETURN*/        print_help(1);
+                }
+                break;
+
+            case 'w':
+                option_wisdom_file = optarg;
+                break;
+
+            case 'r':
+                option_real_inplace = true;
+                break;
+
+            case 's':
+                option_stereo = true;
+                break;
+
+            case 'd':
+                if (0 == strcmp(optarg, "forward")) {
+                    option_direction = FFT_FORWARD;
+                } else if (0 == strcmp(optarg, "backward")) {
+                    option_direction = FFT_BACKWARD;
+                } else {
+                    error("Error: unknown direction %s\n", optarg);
+                    retval=1;
+/*BREAK*/           c=-1;
+/*NORETURN*/        print_help(1);
+                }
+                break;
+
+            case 'n':
+                option_normalize = true;
+                break;
+
+            case 'm':
+                option_howmany = strtol(optarg, NULL, 10);
+                if (option_howmany < 1) {
+                    error("Error: invalid number of signals %s\n", optarg);
+                    retval=1;
+/*BREAK*/           c=-1;
+/*NORETURN*/        print_help(1);
+                }
+                break;
+
+            case 'a':
+                option_affinity = true;
+                break;
+
+            case 't':
+                option_threads = strtol(optarg, NULL, 10);
+                if (option_threads < 1) {
+                    error("Error: invalid number of threads %s\n", optarg);
+                    retval=1;
+/*BREAK*/           c=-1;
+/*NORETURN*/        print_help(1);
+                }
+                break;
+
             case '?':
                 /* intentional fall-through */
             default:
@@ -142,14 +601,14 @@ char* read_input_line(void)
     return ril_lineptr;
 }
 
-/* read a single long integer from stdin into "out", return false on error */
-bool read_one_long(long* out)
+/* read the first line with any long integers from stdin into "out", up to
+   max of them, return the number read or 0 on error */
+int read_longs(long* out, int max)
 {
-    bool retval = false;
+    int retval = 0;
     char* lineptr = NULL;
 
     while(true) {
-        unsigned long res;
         char* endptr;
 
         lineptr = read_input_line();
@@ -157,27 +616,28 @@ bool read_one_long(long* out)
         if (NULL == lineptr) //EOL or error
 /*BREAK*/   break;
 
-        endptr = lineptr;
-        res = strtoul(lineptr, &endptr, 0);
-        if (lineptr != endptr) {
+        for (endptr = lineptr; retval < max; lineptr = endptr) {
+            unsigned long res = strtoul(lineptr, &endptr, 0);
+            if (lineptr == endptr)
+/*BREAK*/       break;
             /* success - this is relatively forgiving pass criteria */
-            *out = res;
-            retval = true;
-/*BREAK*/   break;
+            out[retval++] = res;
         }
+        if (retval > 0)
+/*BREAK*/   break;
     }
 
     return retval;
 }
 
-/* read a single double from stdin into "out", return false on error */
-bool read_one_double(double* out)
+/* read the first line with any doubles from stdin into "out", which must
+   have count of them, return false on error */
+bool read_doubles(double* out, long count)
 {
-    bool retval = false;
+    long num_read = 0;
     char* lineptr = NULL;
 
     while(true) {
-        double res;
         char* endptr;
 
         lineptr = read_input_line();
@@ -185,33 +645,70 @@ bool read_one_double(double* out)
         if (NULL == lineptr) //EOL or error
 /*BREAK*/   break;
 
-        endptr = lineptr;
-        res = strtod(lineptr, &endptr);
-        if (lineptr != endptr) {
+        for (endptr = lineptr; num_read < count; lineptr = endptr) {
+            double res = strtod(lineptr, &endptr);
+            if (lineptr == endptr)
+/*BREAK*/       break;
             /* success - this is relatively forgiving pass criteria */
-            *out = res;
-            retval = true;
-/*BREAK*/   break;
+            out[num_read++] = res;
         }
+        if (num_read > 0)
+/*BREAK*/   break;
     }
 
-    return retval;
+    return (num_read == count);
+}
+
+/* Memory Check
+ * Returns true if count elements of size bytes can be allocated: the size does
+ * not overflow and fits in the physical memory of the machine. Otherwise logs
+ * an error naming what the memory is for and returns false, so oversized
+ * transforms fail cleanly rather than swapping or being killed.
+ */
+bool memory_check(size_t count, size_t size, const char* what)
+{
+    const long pages = sysconf(_SC_PHYS_PAGES);
+    const long page_size = sysconf(_SC_PAGESIZE);
+
+    if ((0 != size) && (count > (SIZE_MAX / size))) {
+        error("Error: %s of %zd x %zd bytes overflows\n", what, count, size);
+        return false;
+    }
+    if ((pages > 0) && (page_size > 0) &&
+        ((count*size / page_size) >= (size_t)pages)) {
+        error("Error: %s of %zd bytes exceeds the physical memory\n", what, count*size);
+        return false;
+    }
+
+    return true;
 }
 
 /* parse testcase data from stdin into input_buf (caller must free)
-   and return the number of samples or -1 on error */
-long parse_input(double** input_buf)
+   and return the number of samples per channel or -1 on error
+   The first line may give the number of channels after the number of
+   samples, then each line holds one frame of that many samples, which are
+   stored interleaved: input_buf[n*num_channels + c] */
+long parse_input(double** input_buf, long* num_channels)
 {
     long retval = -1;
+    long header[2] = {0, 1}; //number of samples, number of channels
     long num_samples = 0;
+    long channels = 1;
     size_t i;
 
-    if (read_one_long(&num_samples)) {
-        verbose("num_samples = %ld\n", num_samples);
-        if ((num_samples > 0) && (num_samples <= MAX_SAMPLES)) {
-            *input_buf = malloc(num_samples * sizeof(**input_buf));
+    if (read_longs(header, 2) > 0) {
+        num_samples = header[0];
+        channels = header[1];
+        verbose("num_samples = %ld, num_channels = %ld\n", num_samples, channels);
+        if ((channels < 1) || (channels > MAX_SAMPLES)) {
+            error("Error: invalid number of channels provided: %ld\n", channels);
+        } else if ((num_samples > 0) &&
+            (num_samples <= (MAX_SAMPLES / channels))) {
+            *input_buf = !memory_check(num_samples*channels,
+                sizeof(**input_buf), "input") ? NULL :
+                malloc(num_samples * channels * sizeof(**input_buf));
             if (NULL == *input_buf) {
-                error("Error allocating %zd bytes for input\n", (num_samples * sizeof(float)));
+                error("Error allocating %zd bytes for input\n", (num_samples * channels * sizeof(**input_buf)));
             } else {
                 retval = num_samples;
             }
@@ -224,8 +721,11 @@ long parse_input(double** input_buf)
 
     if (retval > 0) {
         for (i=0; i<num_samples; i++) {
-            if (read_one_double(&((*input_buf)[i]))) {
-                verbose("%ld: %.16lf\n", i, (*input_buf)[i]);
+            double* const frame = &((*input_buf)[i*channels]);
+
+            if (read_doubles(frame, channels)) {
+                for (long c=0; c<channels; c++)
+                    verbose("%ld: %.16lf\n", i, frame[c]);
             } else {
                 error("Error parsing testcase sample %ld\n", i);
                 retval = -1;
@@ -236,113 +736,481 @@ long parse_input(double** input_buf)
         }
     }
 
+    *num_channels = channels;
+
     return retval;
 }
 
 /* Reverse Bits
- * Returns the integer with the order of bits from x reversed.
- * That is if x=0xA1230000, will return 0x0000C485.
+ * Returns the 64-bit integer with the order of bits from x reversed.
+ * That is if x=0xA123000000000000, will return 0x000000000000C485.
+ * Shift the result right by 64-log2(N) to bit-reverse an index below N.
  * Note: this code shamelessly stolen from stackoverflow
  * https://stackoverflow.com/questions/746171
  */
-inline uint32_t reverse_bits( uint32_t x )
+static inline uint64_t reverse_bits( uint64_t x )
 {
     // Flip pairwise
-    x = ( ( x & 0x55555555 ) << 1 ) | ( ( x & 0xAAAAAAAA ) >> 1 );
+    x = ( ( x & 0x5555555555555555 ) << 1 ) | ( ( x & 0xAAAAAAAAAAAAAAAA ) >> 1 );
     // Flip pairs
-    x = ( ( x & 0x33333333 ) << 2 ) | ( ( x & 0xCCCCCCCC ) >> 2 );
+    x = ( ( x & 0x3333333333333333 ) << 2 ) | ( ( x & 0xCCCCCCCCCCCCCCCC ) >> 2 );
     // Flip nibbles
-    x = ( ( x & 0x0F0F0F0F ) << 4 ) | ( ( x & 0xF0F0F0F0 ) >> 4 );
+    x = ( ( x & 0x0F0F0F0F0F0F0F0F ) << 4 ) | ( ( x & 0xF0F0F0F0F0F0F0F0 ) >> 4 );
 
     // Flip bytes. CPUs have an instruction for that, pretty fast one.
-    return __builtin_bswap32( x );
+    return __builtin_bswap64( x );
+}
+
+/* Bit-Reverse Copy
+ * Out-of-place bit-reverse shuffle: reads the real samples of input_buf in
+ * bit-reversed order straight into the complex transform_buf in a single pass.
+ * Elements end up in their final position as though they had been
+ * recursively split into even and odd halves, and input_buf is left untouched.
+ * Sample n is input_buf[n*stride], so a channel of interleaved frames is read
+ * in place.
+ *
+ * Note: num_samples must be a power of two
+ */
+static inline void shuffle_copy(long num_samples,
+    const double* restrict const input_buf, size_t stride,
+    double complex* restrict const transform_buf)
+{
+    // we already know num_samples is a power of 2 so count the zeroes
+    const int shift = 64 - __builtin_ctzl(num_samples);
+
+    assert(0 < num_samples);
+    assert(ispowerof2(num_samples));
+
+    transform_buf[0] = CMPLX(input_buf[0], 0);
+    for (uint64_t i=1; i<num_samples; i++)
+        transform_buf[i] = CMPLX(input_buf[(reverse_bits(i)>>shift)*stride], 0);
+
+    if (option_verbose && !verbose_quiet) {
+        verbose("Sorted Inputs (%ld samples):\n", num_samples);
+        for (size_t i=0; i<num_samples; i++)
+            verbose("%.16lf\n", creal(transform_buf[i]));
+    }
 }
 
-/* Bit-Reverse Shuffle
- * Performs the bit-reverse shuffling algorithm in-place on the input data buf.
- * Elements will end up in their final position as though they had been
- * recursively split into even and odd halves.
+/* Bit-Reverse Shuffle (complex)
+ * Performs the bit-reverse shuffling algorithm in-place on a buffer of complex
+ * samples, as required by fft_complex(). Elements will end up in their final
+ * position as though they had been recursively split into even and odd
+ * halves.
  *
- * Note: modifies input_buf
+ * Note: modifies buf
  * Note: num_samples must be a power of two
  */
-inline void shuffle(long num_samples, double* restrict const input_buf)
+static inline void shuffle_complex(long num_samples, double complex* restrict const buf)
 {
-    double temp;
+    double complex temp;
     int log2samples;
-    int half_n = num_samples/2;
-    uint32_t i, j;
+    size_t half_n = num_samples/2;
+    size_t i, j;
 
     assert(0 < num_samples);
     assert(ispowerof2(num_samples));
 
-    // we already know num_samples is a power of 2 so count the zeroes
-    log2samples = __builtin_ctz(num_samples);
+    log2samples = __builtin_ctzl(num_samples);
 
-    // Note: element 0 and N never need to be swapped
-    // (they would swap with themselves)
     for (i=1; i<half_n; i++) {
-        j = reverse_bits(i)>>(32-log2samples);
+        j = reverse_bits(i)>>(64-log2samples);
 
-        // if i < j, then we haven't swapped these two elements yet
-        // if i == j, then we don't need to swap them
-        // if i > j, then we have swapped them already and don't need to do it
-        // again; however, there will be a matching pair of elements in the top
-        // half of the list that still needs to be swapped
         if (i < j) {
-            verbose("swapping input %X <-> %X\n", i, j);
-            temp = input_buf[j];
-            input_buf[j] = input_buf[i];
-            input_buf[i] = temp;
+            temp = buf[j];
+            buf[j] = buf[i];
+            buf[i] = temp;
         } else if (i > j) {
-            verbose("swapping input %X <-> %X\n", i+half_n+1, j+half_n+1);
-            temp = input_buf[j+half_n+1];
-            input_buf[j+half_n+1] = input_buf[i+half_n+1];
-            input_buf[i+half_n+1] = temp;
+            temp = buf[j+half_n+1];
+            buf[j+half_n+1] = buf[i+half_n+1];
+            buf[i+half_n+1] = temp;
         }
     }
+}
 
-#ifdef FEATURE_NONRECURSIVE
-    if (option_verbose) {
-        verbose("Sorted Inputs (%ld samples):\n", num_samples);
-        for (size_t i=0; i<num_samples; i++)
-            verbose("%.16lf\n", input_buf[i]);
+/* Winograd Small-N DFT Modules
+ * In-place DFTs of the leaf sizes 2, 3, 4, 5, 7, 8, 9 and 16 using the
+ * smallest known number of multiplications:
+ * - 2 and 4 need no multiplications (only by ±1 and ±i)
+ * - 3 and 5 use Winograd's algorithms with 2 and 5 real constant multiplies
+ *   per real component
+ * - 7 uses Rader's permutation to turn the cosine and sine sums into a 3-point
+ *   cyclic and negacyclic convolution, each done with 4 multiplies by the
+ *   Chinese remainder theorem, for 8 in total
+ * - 8, 16 and 9 are split into 4x2, 4x4 and 3x3 with the only non-trivial
+ *   multiplies being the internal twiddle factors
+ * Multiplication by -i and by the twiddle factors is written out in real
+ * arithmetic so that no full complex multiply is ever needed.
+ */
+static inline void dft2(double complex* restrict const a)
+{
+    const double complex t = a[0];
+
+    a[0] = t + a[1];
+    a[1] = t - a[1];
+}
+
+static inline void dft3(double complex* restrict const a)
+{
+    const double complex t1 = a[1] + a[2];
+    const double complex m2 = mul_neg_i(W3_S*(a[1] - a[2]));
+    double complex s1;
+
+    a[0] = a[0] + t1;
+    s1 = a[0] + W3_C*t1;
+    a[1] = s1 + m2;
+    a[2] = s1 - m2;
+}
+
+static inline void dft4(double complex* restrict const a)
+{
+    const double complex t0 = a[0] + a[2];
+    const double complex t1 = a[0] - a[2];
+    const double complex t2 = a[1] + a[3];
+    const double complex t3 = mul_neg_i(a[1] - a[3]);
+
+    a[0] = t0 + t2;
+    a[1] = t1 + t3;
+    a[2] = t0 - t2;
+    a[3] = t1 - t3;
+}
+
+static inline void dft5(double complex* restrict const a)
+{
+    const double complex t1 = a[1] + a[4];
+    const double complex t2 = a[2] + a[3];
+    const double complex t3 = a[1] - a[4];
+    const double complex t4 = a[3] - a[2];
+    const double complex t5 = t1 + t2;
+    const double complex m2 = W5_C2*(t1 - t2);
+    const double complex m3 = W5_S1*(t3 + t4);
+    const double complex q1 = mul_neg_i(m3 - W5_S2*t4);
+    const double complex q2 = mul_neg_i(m3 - W5_S3*t3);
+    double complex s1;
+
+    a[0] = a[0] + t5;
+    s1 = a[0] + W5_C1*t5;
+    a[1] = s1 + m2 + q1;
+    a[4] = s1 + m2 - q1;
+    a[2] = s1 - m2 + q2;
+    a[3] = s1 - m2 - q2;
+}
+
+static inline void dft7(double complex* restrict const a)
+{
+    //the generator 3 visits the pairs (j, 7-j) in the order 1, 3, 2
+    const double complex s1 = a[1] + a[6];
+    const double complex s2 = a[2] + a[5];
+    const double complex s3 = a[3] + a[4];
+    const double complex d1 = a[1] - a[6];
+    const double complex d2 = a[5] - a[2];
+    const double complex d3 = a[4] - a[3];
+    double complex ya, q0, q1, m1, m2, m3, yb0, yb1;
+    double complex r[3]; //cosine sums for bins 1, 3, 2
+    double complex s[3]; //-i times the sine sums for bins 1, 3, 2
+
+    //cyclic convolution of (s1, s2, s3) modulo (x-1)(x²+x+1)
+    ya = a[0] + W7_CA*(s1 + s2 + s3);
+    q0 = s1 - s3;
+    q1 = s2 - s3;
+    m1 = W7_C0*q0;
+    m2 = W7_C1*q1;
+    m3 = W7_C01*(q0 - q1);
+    yb0 = m1 - m2;
+    yb1 = m1 - m3;
+    r[0] = ya + 2*yb0 - yb1;
+    r[1] = ya - yb0 + 2*yb1;
+    r[2] = ya - yb0 - yb1;
+
+    //negacyclic convolution of (d1, d2, d3) modulo (x+1)(x²-x+1)
+    ya = W7_SA*(d1 - d2 + d3);
+    q0 = d1 - d3;
+    q1 = d2 + d3;
+    m1 = W7_S0*q0;
+    m2 = W7_S1*q1;
+    m3 = W7_S01*(q0 + q1);
+    yb0 = m1 - m2;
+    yb1 = m3 - m1;
+    s[0] = mul_neg_i(ya + 2*yb0 + yb1);
+    s[1] = mul_neg_i(yb0 + 2*yb1 - ya);
+    s[2] = mul_neg_i(ya - yb0 + yb1);
+
+    a[0] = a[0] + s1 + s2 + s3;
+    a[1] = r[0] + s[0];
+    a[6] = r[0] - s[0];
+    a[3] = r[1] + s[1];
+    a[4] = r[1] - s[1];
+    a[2] = r[2] + s[2];
+    a[5] = r[2] - s[2];
+}
+
+static inline void dft8(double complex* restrict const a)
+{
+    double complex e[4] = {a[0], a[2], a[4], a[6]};
+    double complex o[4] = {a[1], a[3], a[5], a[7]};
+
+    dft4(e);
+    dft4(o);
+
+    //twiddle factors e^(-iπk/4), k = 1, 2, 3
+    o[1] = mul_twiddle(o[1], M_SQRT1_2, M_SQRT1_2);
+    o[2] = mul_neg_i(o[2]);
+    o[3] = mul_twiddle(o[3], -M_SQRT1_2, M_SQRT1_2);
+
+    for (int k=0; k<4; k++) {
+        a[k] = e[k] + o[k];
+        a[k+4] = e[k] - o[k];
     }
-#endif
 }
 
-#ifdef FEATURE_NONRECURSIVE
+static inline void dft9(double complex* restrict const a)
+{
+    double complex b[3][3];
+
+    for (int n1=0; n1<3; n1++) {
+        b[n1][0] = a[n1];
+        b[n1][1] = a[n1+3];
+        b[n1][2] = a[n1+6];
+        dft3(b[n1]);
+    }
+
+    //twiddle factors e^(-i2πk/9), k = 1, 2, 2, 4
+    b[1][1] = mul_twiddle(b[1][1], W9_C1, W9_S1);
+    b[1][2] = mul_twiddle(b[1][2], W9_C2, W9_S2);
+    b[2][1] = mul_twiddle(b[2][1], W9_C2, W9_S2);
+    b[2][2] = mul_twiddle(b[2][2], W9_C4, W9_S4);
+
+    for (int k2=0; k2<3; k2++) {
+        double complex c[3] = {b[0][k2], b[1][k2], b[2][k2]};
+        dft3(c);
+        a[k2] = c[0];
+        a[k2+3] = c[1];
+        a[k2+6] = c[2];
+    }
+}
+
+static inline void dft16(double complex* restrict const a)
+{
+    double complex b[4][4];
+
+    for (int n1=0; n1<4; n1++) {
+        b[n1][0] = a[n1];
+        b[n1][1] = a[n1+4];
+        b[n1][2] = a[n1+8];
+        b[n1][3] = a[n1+12];
+        dft4(b[n1]);
+    }
+
+    //twiddle factors e^(-iπk/8), k = n1*k2
+    b[1][1] = mul_twiddle(b[1][1], W16_C1, W16_S1);
+    b[1][2] = mul_twiddle(b[1][2], M_SQRT1_2, M_SQRT1_2);
+    b[1][3] = mul_twiddle(b[1][3], W16_S1, W16_C1);
+    b[2][1] = mul_twiddle(b[2][1], M_SQRT1_2, M_SQRT1_2);
+    b[2][2] = mul_neg_i(b[2][2]);
+    b[2][3] = mul_twiddle(b[2][3], -M_SQRT1_2, M_SQRT1_2);
+    b[3][1] = mul_twiddle(b[3][1], W16_S1, W16_C1);
+    b[3][2] = mul_twiddle(b[3][2], -M_SQRT1_2, M_SQRT1_2);
+    b[3][3] = mul_twiddle(b[3][3], -W16_C1, -W16_S1);
+
+    for (int k2=0; k2<4; k2++) {
+        double complex c[4] = {b[0][k2], b[1][k2], b[2][k2], b[3][k2]};
+        dft4(c);
+        a[k2] = c[0];
+        a[k2+4] = c[1];
+        a[k2+8] = c[2];
+        a[k2+12] = c[3];
+    }
+}
+
+/* check whether winograd_dft() has a module for num_samples */
+static inline bool winograd_supported(long num_samples)
+{
+    switch (num_samples) {
+        case 2: case 3: case 4: case 5: case 7: case 8: case 9: case 16:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/* In-place DFT of a using the Winograd module for num_samples */
+static inline void winograd_dft(long num_samples, double complex* restrict const a)
+{
+    switch (num_samples) {
+        case 2: dft2(a); break;
+        case 3: dft3(a); break;
+        case 4: dft4(a); break;
+        case 5: dft5(a); break;
+        case 7: dft7(a); break;
+        case 8: dft8(a); break;
+        case 9: dft9(a); break;
+        case 16: dft16(a); break;
+        default: assert(false); break;
+    }
+}
+
+/* Winograd Leaf for the radix-2 FFT
+ * Computes the DFT of num_samples (2, 4, 8 or 16) complex samples that are
+ * stored in bit-reversed order, as the first stages of the radix-2 FFT see
+ * them, and stores the result in natural order.
+ * Note: in and out may be the same buffer
+ */
+static inline void winograd_leaf(long num_samples,
+    const double complex* const in, double complex* const out)
+{
+    const int shift = 64 - __builtin_ctzl(num_samples);
+    double complex a[MAX_RADIX];
+
+    for (uint64_t j=0; j<num_samples; j++)
+        a[j] = in[reverse_bits(j)>>shift];
+
+    winograd_dft(num_samples, a);
+
+    for (size_t k=0; k<num_samples; k++)
+        out[k] = a[k];
+}
+
+/* Exact Twiddle Factor
+ * Returns e^(-i2πk/N) for 0 <= k < N/2.
+ * The angle is reduced to the first octant with integer arithmetic, in units
+ * of a 1/(8N) turn, and evaluated in long double before rounding to double.
+ * This keeps the table exactly symmetric (e.g. the k=N/4 entry is exactly -i)
+ * and each entry within rounding of the true value.
+ */
+static double complex exact_twiddle(size_t k, size_t num_samples)
+{
+    size_t m = 8*k; //angle in units of 2π/(8N), less than a half turn
+    bool negate_cos = false;
+    bool swap = false;
+    long double theta, c, s;
+
+    //θ -> π-θ: cos(θ) = -cos(π-θ), sin(θ) = sin(π-θ)
+    if (m > 2*num_samples) {
+        m = 4*num_samples - m;
+        negate_cos = true;
+    }
+    //θ -> π/2-θ: cos(θ) = sin(π/2-θ), sin(θ) = cos(π/2-θ)
+    if (m > num_samples) {
+        m = 2*num_samples - m;
+        swap = true;
+    }
+
+    theta = (2*PI_L*m)/(8*num_samples);
+    c = cosl(theta);
+    s = sinl(theta);
+    if (swap) {
+        long double t = c;
+        c = s;
+        s = t;
+    }
+    if (negate_cos)
+        c = -c;
+
+    return CMPLX((double)c, -(double)s);
+}
+
+/* Twiddle Generator
+ * Streams the twiddle factors e^(-i2πk/g), k = 0, 1, 2, ..., of a stage with
+ * group size g without a table. Every TWIDDLE_SEED_INTERVAL factors the
+ * stream is reseeded from exact_twiddle() and in between it follows the
+ * subtraction-free recurrence
+ *   w(k+1) = w(k) + w(k)*d,  d = e^(-iδ) - 1 = -2sin²(δ/2) - i·sin(δ)
+ * with δ = 2π/g. The increment d is small, so each step adds about one ulp of
+ * rounding error and the runs between seeds stay accurate for any g, unlike
+ * repeated multiplication by e^(-iδ) whose error grows with g.
+ */
+struct twiddle_gen {
+    size_t g; //group size
+    size_t k; //index of w in the stream
+    double complex w; //e^(-i2πk/g)
+    double complex d; //e^(-i2π/g) - 1
+};
+
+/* prepare gen for the stage with group size g, call twiddle_gen_reset() to
+   start the stream */
+static inline void twiddle_gen_init(struct twiddle_gen* const gen, size_t g)
+{
+    const long double half_delta = PI_L/g;
+    const long double s = sinl(half_delta);
+
+    gen->g = g;
+    gen->d = CMPLX((double)(-2*s*s), -(double)sinl(2*half_delta));
+}
+
+/* restart the stream of gen at k = 0 and return the first factor, 1 */
+static inline double complex twiddle_gen_reset(struct twiddle_gen* const gen)
+{
+    gen->k = 0;
+    gen->w = 1;
+    return gen->w;
+}
+
+/* advance gen to the next factor and return it, valid while k < g/2 */
+static inline double complex twiddle_gen_next(struct twiddle_gen* const gen)
+{
+    gen->k++;
+    if (0 == (gen->k % TWIDDLE_SEED_INTERVAL))
+        gen->w = exact_twiddle(gen->k, gen->g);
+    else
+        gen->w += gen->w * gen->d;
+    return gen->w;
+}
+
+/* Precomputed Twiddle Factor
+ * Returns e^(-i2πk/g) for the stage with group size g = 2^(gc+1) and
+ * 0 <= k <= g/2, reconstructed from the quarter-wave sine table of twiddle.h.
+ * With N = TWIDDLE_MAX_SAMPLES, Q = N/4 and m = k*N/g (so m <= N/2):
+ *   cos(2πm/N) = W_sin[Q-m],  sin(2πm/N) = W_sin[m]     for m <= Q
+ *   cos(2πm/N) = -W_sin[m-Q], sin(2πm/N) = W_sin[2Q-m]  for m > Q
+ */
+static inline double complex precomputed_twiddle(size_t gc, size_t k)
+{
+    const size_t quarter = TWIDDLE_MAX_SAMPLES/4;
+    const size_t m = k * (TWIDDLE_MAX_SAMPLES >> (gc+1));
+
+    if (m <= quarter)
+        return CMPLX(W_sin[quarter - m], -W_sin[m]);
+    else
+        return CMPLX(-W_sin[m - quarter], -W_sin[2*quarter - m]);
+}
+
 /* Iterative FFT implementation
- * 1. Iterate over the transform_buf in groups of 2, then 4, then 8, etc.
- * 2. Within each group merge the individual elements together
+ * 1. Compute the groups of up to MAX_LEAF elements with the Winograd module
+ * 2. Iterate over the transform_buf in groups of 2*MAX_LEAF, then 4*MAX_LEAF,
+ *    etc.
+ * 3. Within each group merge the individual elements together
+ * The twiddle factors are looked up from twiddle.h if precomputed is true,
+ * otherwise they are streamed by the accurate twiddle_gen_next().
  *
- * Note: no contract checking for performance, don't call directly, call fft()
- * depth parameter is only used for logging
+ * Note: no contract checking for performance, don't call directly, call
+ * fft_plan_execute() or fft_complex()
  */
-inline void fft_inner(long num_samples,
-    double complex* restrict const transform_buf)
+static inline void fft_inner(long num_samples,
+    double complex* restrict const transform_buf, const bool precomputed)
 {
-    size_t g = 2; //grouping size
-    size_t groups = num_samples/2; //number of groups
-#ifdef FEATURE_PRECOMPUTED_TWIDDLE_FACTORS
-    size_t gc = 0; //group counter
-#endif
+    const size_t leaf = (num_samples < MAX_LEAF) ? num_samples : MAX_LEAF;
+    size_t g = 2*leaf; //grouping size
+    size_t groups = num_samples/g; //number of groups
+    size_t gc = __builtin_ctzl(leaf); //group counter
+
+    //the first log2(leaf) stages of each group are a leaf-sized DFT
+    if (leaf > 1) {
+        for (size_t n=0; n<num_samples; n+=leaf)
+            winograd_leaf(leaf, &transform_buf[n], &transform_buf[n]);
+    }
 
     while (g<=num_samples) {
         long half_samples = g/2;
-#ifndef FEATURE_PRECOMPUTED_TWIDDLE_FACTORS
-        double complex basis = cexp(-I*M_PI/half_samples);
-#endif
+        struct twiddle_gen gen = {0};
+
+        if (!precomputed)
+            twiddle_gen_init(&gen, g);
 
         for(size_t n=0; n<groups; n++) {
             size_t k = g*n; //group_size*count_n, counts up from 0 to halfway
             size_t j = k + half_samples; //count up from halfway point of group
-#ifdef FEATURE_PRECOMPUTED_TWIDDLE_FACTORS
-            double complex basis_k = W²[gc][0];
+            double complex basis_k = precomputed ? 1 : twiddle_gen_reset(&gen);
             size_t c = 0; //count through the basis entries
-#else
-            double complex basis_k = 1;
-#endif
 
             //Merge the individual elements in the group
             //Xk = Xk_even + Xk_odd*e^(-ikπ/half_samples)
@@ -356,128 +1224,3296 @@ inline void fft_inner(long num_samples,
                 verbose("%zd,%zd: (%+.16lf%+.16lfj)-(%+.16lf%+.16lfj)*(%+.16lf%+.16lfj) = %+.16lf%+.16lfj\n", g, j, creal(transform_buf[k]), cimag(transform_buf[k]), creal(basis_k), cimag(basis_k), creal(transform_buf[j]), cimag(transform_buf[j]), creal(xj), cimag(xj));
                 transform_buf[k] = xk;
                 transform_buf[j] = xj;
-#ifdef FEATURE_PRECOMPUTED_TWIDDLE_FACTORS
-                //grab next precomputed twiddle factor in group gc
-                c++;
-                basis_k = W²[gc][c];
-#else
-                //compute next twiddle factor by multiplying by basis
-                basis_k = basis_k * basis;
-#endif
+                if (precomputed) {
+                    //reconstruct next precomputed twiddle factor in group gc
+                    c++;
+                    basis_k = precomputed_twiddle(gc, c);
+                } else {
+                    //generate next twiddle factor
+                    basis_k = twiddle_gen_next(&gen);
+                }
             }
         }
 
         //maintain the helper vars
         g<<=1;
         groups>>=1;
-#ifdef FEATURE_PRECOMPUTED_TWIDDLE_FACTORS
         gc++;
-#endif
     }
 }
-#else /* FEATURE_NONRECURSIVE */
-/* Recursive FFT implementation
- * 1. Recursively compute the FFT on each half of the input buffer
- * 2. Merge the results
- *
- * Note: no contract checking for performance, don't call directly, call fft()
- * depth parameter is only used for logging
+
+#ifdef TWIDDLE_LAYOUT_SPLIT
+/* Split Twiddle Stages
+ * The merge stages of fft_inner() from group size 2*leaf up to num_samples,
+ * reading the twiddle factors of the stage with half size h from the split
+ * W_re[h..2h) and W_im[h..2h) arrays of twiddle.h, so consecutive butterflies
+ * load consecutive doubles.
  */
-void fft_inner(size_t depth, long num_samples, double* restrict const input_buf,
+static inline void fft_split_stages(long num_samples, size_t leaf,
     double complex* restrict const transform_buf)
 {
-    //Base Case: num_samples=1
-    if (1 == num_samples) {
-        //Simply return the input, X₀=x₀
-        transform_buf[0]=CMPLX(input_buf[0], 0);
-        verbose("Returning %.16lf%+.16lfj at Level %zd\n",  creal(transform_buf[0]), cimag(transform_buf[0]), depth);
-    } else {
-        long half_samples = num_samples/2;
-#ifdef FEATURE_PRECOMPUTED_TWIDDLE_FACTORS
-        // we already know num_samples is a power of 2 so count the zeroes
-        const int log2samples = __builtin_ctz(num_samples);
-        const size_t gc = log2samples-1;
-        double complex basis_k = W²[gc][0];
-#else
-        double complex basis = cexp(-I*M_PI/half_samples);
-        double complex basis_k = 1;
-#endif
-
-        if (option_verbose) {
-            verbose("Sorted Inputs at Level %zd (%ld samples)\n", depth, num_samples);
-            for (size_t i=0; i<num_samples; i++)
-                verbose("%.16lf\n", input_buf[i]);
-        }
+    for (size_t h=leaf; h<(size_t)num_samples; h<<=1) {
+        const double* restrict const wr = &W_re[h];
+        const double* restrict const wi = &W_im[h];
 
-        //Recursively call fft on each half
-        fft_inner(depth+1, half_samples, &input_buf[0], transform_buf);
-        fft_inner(depth+1, half_samples, &input_buf[half_samples],
-          &transform_buf[half_samples]);
+        for (size_t n=0; n<(size_t)num_samples; n+=2*h) {
+            double* restrict const x = (double*)&transform_buf[n];
+            double* restrict const y = (double*)&transform_buf[n + h];
 
-        //Merge the results
-        //Xk = Xk_even + Xk_odd*e^(-ikπ/half_samples)
-        //Xj = Xk_even + Xk_odd*e^(-ijπ/half_samples)
-        // where j = k+half_samples
-        // and, therefore, e^(-ij) = -e^(-ik)
-        for (size_t k=0, j=half_samples; k<half_samples; k++, j++) {
-#ifdef FEATURE_PRECOMPUTED_TWIDDLE_FACTORS
-            //grab next precomputed twiddle factor in group gc
-            basis_k = W²[gc][k];
-#endif
-            double complex xk = transform_buf[k] + basis_k*transform_buf[j];
-            double complex xj = transform_buf[k] - basis_k*transform_buf[j];
-            verbose("%zd,%zd: (%+.16lf%+.16lfj)+(%+.16lf%+.16lfj)*(%+.16lf%+.16lfj) = %+.16lf%+.16lfj\n", depth, k, creal(transform_buf[k]), cimag(transform_buf[k]), creal(basis_k), cimag(basis_k), creal(transform_buf[j]), cimag(transform_buf[j]), creal(xk), cimag(xk));
-            verbose("%zd,%zd: (%+.16lf%+.16lfj)-(%+.16lf%+.16lfj)*(%+.16lf%+.16lfj) = %+.16lf%+.16lfj\n", depth, j, creal(transform_buf[k]), cimag(transform_buf[k]), creal(basis_k), cimag(basis_k), creal(transform_buf[j]), cimag(transform_buf[j]), creal(xj), cimag(xj));
-            transform_buf[k] = xk;
-            transform_buf[j] = xj;
-#ifndef FEATURE_PRECOMPUTED_TWIDDLE_FACTORS
-            //compute next twiddle factor by multiplying by basis
-            basis_k = basis_k * basis;
-#endif
+            for (size_t k=0; k<h; k++) {
+                const double tr = y[2*k]*wr[k] - y[2*k+1]*wi[k];
+                const double ti = y[2*k]*wi[k] + y[2*k+1]*wr[k];
+                y[2*k] = x[2*k] - tr;
+                y[2*k+1] = x[2*k+1] - ti;
+                x[2*k] += tr;
+                x[2*k+1] += ti;
+            }
         }
     }
 }
-#endif /* FEATURE_NONRECURSIVE */
+#endif
 
-/* FFT calculation
- * 1. Split the sample into two halves (even/odd fields)
- * 2. Call fft_inner() to recursively compute the FFT
- *
- * Note: transform_buf must already be allocated and can not be NULL and
- *       cannot overlap with input_buf
- * Note: modifies input_buf
+#ifdef TWIDDLE_LAYOUT_DUP
+/* Duplicated Twiddle Stages
+ * The merge stages of fft_inner() from group size 2*leaf up to num_samples,
+ * reading the (re,re) and (im,im) pairs of W_dup_re and W_dup_im from
+ * twiddle.h so each complex multiply is two vector multiplies and an addsub:
+ *   y*w = (yr*wr, yi*wr) -+ (yi*wi, yr*wi)
  */
-void fft(long num_samples, double* restrict const input_buf,
+static inline void fft_dup_stages(long num_samples, size_t leaf,
     double complex* restrict const transform_buf)
 {
-    //Check the inputs; particularly that there are a power of 2 samples
-    assert(NULL != input_buf);
-    assert(NULL != transform_buf);
-    assert(0 < num_samples);
-    assert(ispowerof2(num_samples));
+    for (size_t h=leaf; h<(size_t)num_samples; h<<=1) {
+        const v2df* restrict const wr = (const v2df*)&W_dup_re[2*h];
+        const v2df* restrict const wi = (const v2df*)&W_dup_im[2*h];
 
-    // 1. Perform bit-reverse shuffling to split the input buffer into
-    //    even and odd samples in O(n) time rather than O(nlog(n)) time.
-    shuffle(num_samples, input_buf);
+        for (size_t n=0; n<(size_t)num_samples; n+=2*h) {
+            v2df* restrict const x = (v2df*)&transform_buf[n];
+            v2df* restrict const y = (v2df*)&transform_buf[n + h];
 
-#ifdef FEATURE_NONRECURSIVE
-    // 1.5 copy the input_buf to the transform_buf
-    for (size_t i=0; i<num_samples; i++)
-        transform_buf[i] = CMPLX(input_buf[i], 0);
-
-    // 2. Iteratively compute the FFT
-    fft_inner(num_samples, transform_buf);
+            for (size_t k=0; k<h; k++) {
+                const v2df swapped = __builtin_shuffle(y[k], (v2di){1, 0});
+#ifdef __SSE3__
+                const v2df t = (v2df)_mm_addsub_pd(y[k]*wr[k], swapped*wi[k]);
 #else
-    // 2. Recursively compute the FFT
-    fft_inner(0, num_samples, input_buf, transform_buf);
+                const v2df t = y[k]*wr[k] + swapped*wi[k]*(v2df){-1.0, 1.0};
 #endif
+                y[k] = x[k] - t;
+                x[k] = x[k] + t;
+            }
+        }
+    }
 }
+#endif
 
-/* print out the result in the test case output format */
-void print_result(long num_bins, const double complex* const bins)
+#ifdef TWIDDLE_LAYOUT_RADIX4
+/* Radix-4 Twiddle Stages
+ * The merge stages of fft_inner() from group size 2*leaf up to num_samples,
+ * fused in pairs into radix-4 stages that read the (w, w², w³) triplet of
+ * each butterfly contiguously from W_r4 of twiddle.h. The inputs are in
+ * radix-2 bit-reversed order, so the quarters at k, k+m, k+2m and k+3m hold
+ * the sub-transforms of x[4n], x[4n+2], x[4n+1] and x[4n+3], which take the
+ * twiddle factors 1, w², w and w³.
+ * A radix-2 stage finishes odd numbers of stages.
+ */
+static inline void fft_radix4_stages(long num_samples, size_t leaf,
+    double complex* restrict const transform_buf)
 {
-    printf("# %ld Frequency Bins\n", num_bins);
-    for (size_t i=0; i<num_bins; i++)
+    size_t m = leaf; //quarter size of the radix-4 stage
+
+    for (; 4*m<=(size_t)num_samples; m<<=2) {
+        const double complex* restrict const w = &W_r4[3*m];
+
+        for (size_t n=0; n<(size_t)num_samples; n+=4*m) {
+            double complex* restrict const x = &transform_buf[n];
+
+            for (size_t k=0; k<m; k++) {
+                const double complex c0 = x[k];
+                const double complex c1 = mul_twiddle(x[k + m],
+                    creal(w[3*k+1]), -cimag(w[3*k+1]));
+                const double complex c2 = mul_twiddle(x[k + 2*m],
+                    creal(w[3*k]), -cimag(w[3*k]));
+                const double complex c3 = mul_twiddle(x[k + 3*m],
+                    creal(w[3*k+2]), -cimag(w[3*k+2]));
+                const double complex s01 = c0 + c1;
+                const double complex d01 = c0 - c1;
+                const double complex s23 = c2 + c3;
+                const double complex d23 = mul_neg_i(c2 - c3);
+
+                x[k] = s01 + s23;
+                x[k + m] = d01 + d23;
+                x[k + 2*m] = s01 - s23;
+                x[k + 3*m] = d01 - d23;
+            }
+        }
+    }
+
+    if (2*m == (size_t)num_samples) {
+        const size_t gc = __builtin_ctzl(m);
+
+        for (size_t k=0; k<m; k++) {
+            const double complex w = precomputed_twiddle(gc, k);
+            const double complex t = mul_twiddle(transform_buf[k + m],
+                creal(w), -cimag(w));
+
+            transform_buf[k + m] = transform_buf[k] - t;
+            transform_buf[k] += t;
+        }
+    }
+}
+#endif
+
+/* Twiddle Layout FFT implementation
+ * fft_inner() with precomputed twiddle factors, where the merge stages read
+ * one of the layouts for vectorized kernels that twiddle.py emits with -l:
+ * FFT_ENGINE_SPLIT, FFT_ENGINE_DUP or FFT_ENGINE_RADIX4.
+ *
+ * Note: no contract checking for performance, num_samples must not exceed
+ * TWIDDLE_MAX_SAMPLES and the layout of engine must be in twiddle.h
+ */
+static inline void fft_layout_inner(long num_samples,
+    double complex* restrict const transform_buf, enum fft_engine engine)
+{
+    const size_t leaf = (num_samples < MAX_LEAF) ? num_samples : MAX_LEAF;
+
+    //the first log2(leaf) stages of each group are a leaf-sized DFT
+    if (leaf > 1) {
+        for (size_t n=0; n<num_samples; n+=leaf)
+            winograd_leaf(leaf, &transform_buf[n], &transform_buf[n]);
+    }
+
+    switch (engine) {
+#ifdef TWIDDLE_LAYOUT_SPLIT
+        case FFT_ENGINE_SPLIT:
+            fft_split_stages(num_samples, leaf, transform_buf);
+            break;
+#endif
+#ifdef TWIDDLE_LAYOUT_DUP
+        case FFT_ENGINE_DUP:
+            fft_dup_stages(num_samples, leaf, transform_buf);
+            break;
+#endif
+#ifdef TWIDDLE_LAYOUT_RADIX4
+        case FFT_ENGINE_RADIX4:
+            fft_radix4_stages(num_samples, leaf, transform_buf);
+            break;
+#endif
+        default:
+            assert(false);
+            break;
+    }
+}
+
+/* Recursive FFT Merge
+ * Merges the FFTs of the even and odd fields in each half of transform_buf
+ * into the FFT of num_samples, the last step of fft_recursive():
+ *   Xk = Xk_even + Xk_odd*e^(-ikπ/half_samples)
+ * The twiddle factors are looked up from twiddle.h if precomputed is true,
+ * otherwise they are streamed by the accurate twiddle_gen_next().
+ * depth parameter is only used for logging
+ */
+static void fft_recursive_merge(size_t depth, long num_samples,
+    double complex* restrict const transform_buf, const bool precomputed)
+{
+    long half_samples = num_samples/2;
+    // we already know num_samples is a power of 2 so count the zeroes
+    const size_t gc = __builtin_ctzl(num_samples)-1;
+    struct twiddle_gen gen = {0};
+    double complex basis_k = 1;
+
+    if (!precomputed) {
+        twiddle_gen_init(&gen, num_samples);
+        basis_k = twiddle_gen_reset(&gen);
+    }
+
+    //Merge the results
+    //Xk = Xk_even + Xk_odd*e^(-ikπ/half_samples)
+    //Xj = Xk_even + Xk_odd*e^(-ijπ/half_samples)
+    // where j = k+half_samples
+    // and, therefore, e^(-ij) = -e^(-ik)
+    for (size_t k=0, j=half_samples; k<half_samples; k++, j++) {
+        if (precomputed) {
+            //reconstruct next precomputed twiddle factor in group gc
+            basis_k = precomputed_twiddle(gc, k);
+        }
+        double complex xk = transform_buf[k] + basis_k*transform_buf[j];
+        double complex xj = transform_buf[k] - basis_k*transform_buf[j];
+        verbose("%zd,%zd: (%+.16lf%+.16lfj)+(%+.16lf%+.16lfj)*(%+.16lf%+.16lfj) = %+.16lf%+.16lfj\n", depth, k, creal(transform_buf[k]), cimag(transform_buf[k]), creal(basis_k), cimag(basis_k), creal(transform_buf[j]), cimag(transform_buf[j]), creal(xk), cimag(xk));
+        verbose("%zd,%zd: (%+.16lf%+.16lfj)-(%+.16lf%+.16lfj)*(%+.16lf%+.16lfj) = %+.16lf%+.16lfj\n", depth, j, creal(transform_buf[k]), cimag(transform_buf[k]), creal(basis_k), cimag(basis_k), creal(transform_buf[j]), cimag(transform_buf[j]), creal(xj), cimag(xj));
+        transform_buf[k] = xk;
+        transform_buf[j] = xj;
+        if (!precomputed) {
+            //generate next twiddle factor
+            basis_k = twiddle_gen_next(&gen);
+        }
+    }
+}
+
+/* Recursive FFT implementation
+ * Out-of-place FFT of the num_samples inputs input_buf[0], input_buf[stride],
+ * input_buf[2*stride], ... into transform_buf:
+ * 1. Recursively compute the FFT of the even and odd fields (the same input
+ *    with twice the stride) into each half of transform_buf, down to
+ *    MAX_LEAF samples which are computed by the Winograd module
+ * 2. Merge the results with fft_recursive_merge()
+ * input_buf is only read, so no bit-reverse shuffle or copy is needed.
+ *
+ * Note: no contract checking for performance, don't call directly, call
+ * fft_plan_execute()
+ * depth parameter is only used for logging
+ */
+void fft_recursive(size_t depth, long num_samples,
+    const double* restrict const input_buf, size_t stride,
+    double complex* restrict const transform_buf, const bool precomputed)
+{
+    //Base Case: num_samples=1
+    if (1 == num_samples) {
+        //Simply return the input, X₀=x₀
+        transform_buf[0]=CMPLX(input_buf[0], 0);
+        verbose("Returning %.16lf%+.16lfj at Level %zd\n",  creal(transform_buf[0]), cimag(transform_buf[0]), depth);
+    } else if (num_samples <= MAX_LEAF) {
+        //Leaf Case: use the Winograd module on the strided inputs
+        for (size_t j=0; j<num_samples; j++)
+            transform_buf[j] = CMPLX(input_buf[j*stride], 0);
+        winograd_dft(num_samples, transform_buf);
+
+        for (size_t k=0; k<num_samples; k++)
+            verbose("Returning %.16lf%+.16lfj at Level %zd\n",  creal(transform_buf[k]), cimag(transform_buf[k]), depth);
+    } else {
+        long half_samples = num_samples/2;
+
+        if (option_verbose && !verbose_quiet) {
+            verbose("Inputs at Level %zd (%ld samples)\n", depth, num_samples);
+            for (size_t i=0; i<num_samples; i++)
+                verbose("%.16lf\n", input_buf[i*stride]);
+        }
+
+        //Recursively call fft on the even and odd fields
+        fft_recursive(depth+1, half_samples, &input_buf[0], 2*stride,
+            transform_buf, precomputed);
+        fft_recursive(depth+1, half_samples, &input_buf[stride], 2*stride,
+          &transform_buf[half_samples], precomputed);
+
+        fft_recursive_merge(depth, num_samples, transform_buf, precomputed);
+    }
+}
+
+/* Factorize for the Mixed-Radix FFT
+ * Splits num_samples into radix 2, 3, 5 and 7 factors, stored in radices in
+ * the order the stages will be executed.
+ * Returns the number of factors or 0 if num_samples has any other prime factor.
+ */
+int factorize(long num_samples, int radices[MAX_FACTORS])
+{
+    static const int supported[] = {2, 3, 5, 7};
+    int count = 0;
+
+    for (size_t i=0; i<(sizeof(supported)/sizeof(supported[0])); i++) {
+        while ((0 == (num_samples % supported[i])) && (count < MAX_FACTORS)) {
+            radices[count++] = supported[i];
+            num_samples /= supported[i];
+        }
+    }
+
+    return (1 == num_samples) ? count : 0;
+}
+
+/* Mixed-Radix Stages
+ * Groups the prime factors of num_samples into the radices of the stages of
+ * the mixed-radix FFT, preferring the larger Winograd modules 16, 8, 4 and 9
+ * to reduce the number of stages and twiddle multiplies.
+ * Returns the number of stages or 0 if num_samples has any other prime factor.
+ */
+int mixed_radix_stages(long num_samples, int radices[MAX_FACTORS])
+{
+    int primes[MAX_FACTORS];
+    int num_primes = factorize(num_samples, primes);
+    int twos = 0;
+    int threes = 0;
+    int count = 0;
+
+    for (int i=0; i<num_primes; i++) {
+        if (2 == primes[i])
+            twos++;
+        else if (3 == primes[i])
+            threes++;
+    }
+
+    for (; twos >= 4; twos -= 4)
+        radices[count++] = 16;
+    if (twos > 0)
+        radices[count++] = 1<<twos;
+    for (; threes >= 2; threes -= 2)
+        radices[count++] = 9;
+    if (threes > 0)
+        radices[count++] = 3;
+    for (int i=0; i<num_primes; i++) {
+        if (primes[i] > 3)
+            radices[count++] = primes[i];
+    }
+
+    return count;
+}
+
+/* Digit-Reverse Permutation
+ * Generalization of the bit-reverse shuffle to a mixed-radix number system.
+ * Element p of the transform_buf receives the input sample whose index has the
+ * mixed-radix digits of p in reverse order, so that after all stages the
+ * output is in natural order.
+ * If p = d₀ + r₀*(d₁ + r₁*(d₂ + ...)) then the source index is
+ *   n = d₀*(N/r₀) + d₁*(N/(r₀r₁)) + d₂*(N/(r₀r₁r₂)) + ...
+ * The source index is maintained incrementally as p counts up, so the cost
+ * is amortized O(1) per element.
+ * The input is read from complex_buf if it is not NULL, otherwise from the
+ * real samples in input_buf, sample n being at n*stride.
+ *
+ * Note: the input buffers are not modified
+ */
+void digit_reverse(long num_samples, int num_factors,
+    const int radices[MAX_FACTORS], const double* restrict const input_buf,
+    const double complex* restrict const complex_buf, size_t stride,
+    double complex* restrict const transform_buf)
+{
+    int digit[MAX_FACTORS] = {0};
+    size_t weight[MAX_FACTORS]; //how much n moves when digit s increments
+    size_t n = 0;
+
+    weight[0] = num_samples/radices[0];
+    for (int s=1; s<num_factors; s++)
+        weight[s] = weight[s-1]/radices[s];
+
+    for (size_t p=0; p<num_samples; p++) {
+        transform_buf[p] = input_sample(input_buf, complex_buf, n*stride);
+        verbose("permute input %zd -> %zd\n", n, p);
+
+        //increment the reversed counter, carrying from the lowest digit
+        for (int s=0; s<num_factors; s++) {
+            digit[s]++;
+            n += weight[s];
+            if (digit[s] < radices[s])
+/*BREAK*/       break;
+            digit[s] = 0;
+            n -= radices[s]*weight[s];
+        }
+    }
+}
+
+/* Mixed-Radix FFT implementation
+ * Iterative Cooley-Tukey decimation-in-time FFT over the factors of
+ * num_samples. Each stage merges groups of radix sub-transforms of span m
+ * into groups of g = m*radix:
+ *   aj = Xk(j) * e^(-i2πjk/g), for j in [0, radix)
+ *   X(k+q*m) = Σ aj * e^(-i2πjq/radix)
+ * where the radix-point DFT is done by the Winograd module for radix and the
+ * twiddle factors are read in order from the plan, see fft_plan_mixed_radix().
+ *
+ * Note: no contract checking for performance, don't call directly, call
+ * fft_mixed_radix()
+ * Note: transform_buf must already be in digit-reversed order
+ */
+void mixed_radix_inner(const struct fft_plan* const plan,
+    double complex* restrict const transform_buf)
+{
+    const size_t num_samples = plan->num_samples;
+    const double complex* tw = plan->twiddle;
+    size_t m = 1; //span of the sub-transforms being merged
+
+    for (int s=0; s<plan->num_factors; s++) {
+        const int radix = plan->radices[s];
+        const size_t g = m*radix; //grouping size
+
+        verbose("stage %d: radix %d, group size %zd\n", s, radix, g);
+
+        for (size_t k=0; k<m; k++) {
+            //twiddle factors e^(-i2πjk/g) for this k are shared by all groups
+            const double complex* const w = tw;
+            tw += radix-1;
+
+            for (size_t base=k; base<num_samples; base+=g) {
+                double complex a[MAX_RADIX];
+
+                a[0] = transform_buf[base];
+                for (int j=1; j<radix; j++)
+                    a[j] = w[j-1]*transform_buf[base + j*m];
+
+                winograd_dft(radix, a);
+
+                for (int q=0; q<radix; q++) {
+                    verbose("%zd,%zd: %+.16lf%+.16lfj\n", g, base + q*m, creal(a[q]), cimag(a[q]));
+                    transform_buf[base + q*m] = a[q];
+                }
+            }
+        }
+
+        m = g;
+    }
+}
+
+/* Mixed-Radix FFT calculation
+ * 1. Digit-reverse the input into the transform_buf
+ * 2. Call mixed_radix_inner() to iteratively merge the sub-transforms
+ * The input is read from complex_buf if it is not NULL, otherwise from the
+ * real samples in input_buf, sample n being at n*stride.
+ *
+ * Note: plan must have the mixed-radix tables, see fft_plan_mixed_radix()
+ * Note: the input buffers are not modified
+ */
+void fft_mixed_radix(const struct fft_plan* const plan,
+    const double* restrict const input_buf,
+    const double complex* restrict const complex_buf, size_t stride,
+    double complex* restrict const transform_buf)
+{
+    assert(0 < plan->num_factors);
+
+    digit_reverse(plan->num_samples, plan->num_factors, plan->radices,
+        input_buf, complex_buf, stride, transform_buf);
+    mixed_radix_inner(plan, transform_buf);
+}
+
+/* check whether the radix-2 FFT of num_samples takes its twiddle factors
+   from twiddle.h by default, see cfg.h */
+static inline bool default_precomputed(long num_samples)
+{
+#ifdef FEATURE_PRECOMPUTED_TWIDDLE_FACTORS
+    return (num_samples <= TWIDDLE_MAX_SAMPLES);
+#else
+    return false;
+#endif
+}
+
+/* Complex FFT calculation
+ * In-place power of 2 FFT of a complex buffer using the iterative fft_inner().
+ * Used as the building block for the Bluestein FFT.
+ *
+ * Note: num_samples must be a power of two
+ */
+void fft_complex(long num_samples, double complex* restrict const buf)
+{
+    assert(NULL != buf);
+    assert(0 < num_samples);
+    assert(ispowerof2(num_samples));
+
+    shuffle_complex(num_samples, buf);
+    fft_inner(num_samples, buf, default_precomputed(num_samples));
+}
+
+/* allocate count elements of size bytes aligned to PLAN_ALIGNMENT, release
+   with free() */
+static void* plan_alloc(size_t count, size_t size)
+{
+    if (!memory_check(count, size, "fft_plan"))
+        return NULL;
+
+    //aligned_alloc requires a size that is a multiple of the alignment
+    size = (count*size + PLAN_ALIGNMENT - 1) & ~(size_t)(PLAN_ALIGNMENT - 1);
+    return aligned_alloc(PLAN_ALIGNMENT, size);
+}
+
+/* FFT Plan Tables
+ * Prepares the tables of the FFT_ENGINE_TABLES engine for a power of 2 plan
+ * with Winograd leaves of up to leaf samples:
+ * - bitrev[b]: the bit-reversed index of b*leaf, the first input sample of
+ *   leaf b
+ * - twiddle[h+k] = e^(-iπk/h) for each merge stage of half size h, so the
+ *   twiddle factors of every stage are contiguous
+ * - for the sizes of fft_simd_batch(), the scratch for its split real and
+ *   imaginary arrays of 2N vectors
+ * Returns false on allocation failure.
+ */
+static bool fft_plan_tables(struct fft_plan* const plan, size_t leaf)
+{
+    const size_t num_samples = plan->num_samples;
+    const int log2samples = __builtin_ctzl(num_samples);
+    const size_t half_n = num_samples/2;
+
+    plan->leaf = (num_samples < leaf) ? num_samples : leaf;
+    plan->bitrev = plan_alloc(num_samples/plan->leaf, sizeof(*plan->bitrev));
+    plan->twiddle = plan_alloc(num_samples, sizeof(*plan->twiddle));
+    if ((NULL == plan->bitrev) || (NULL == plan->twiddle))
+        return false;
+    if ((SIMD_BATCH_MIN_SAMPLES <= num_samples) &&
+        (num_samples <= SIMD_BATCH_MAX_SAMPLES)) {
+        plan->scratch = plan_alloc(2*num_samples, sizeof(vbatch_df));
+        if (NULL == plan->scratch)
+            return false;
+    }
+
+    for (uint64_t b=0; b<(num_samples/plan->leaf); b++)
+        plan->bitrev[b] = (0 == log2samples) ? 0 :
+            (reverse_bits(b*plan->leaf) >> (64 - log2samples));
+
+    //the last stage needs e^(-i2πk/N) for k < N/2, the earlier stages take
+    //every other entry of the stage after them
+    plan->twiddle[0] = 1;
+    for (size_t k=0; k<half_n; k++)
+        plan->twiddle[half_n + k] = exact_twiddle(k, num_samples);
+    for (size_t h=half_n/2; h>0; h/=2) {
+        for (size_t k=0; k<h; k++)
+            plan->twiddle[h + k] = plan->twiddle[2*h + 2*k];
+    }
+
+    return true;
+}
+
+/* Mixed-Radix Plan Tables
+ * Prepares the stages of the mixed-radix FFT: the radices from
+ * mixed_radix_stages() and, for the stage of span m and radix r, the
+ * twiddle factors
+ *   twiddle[k*(r-1) + j-1] = e^(-i2πjk/(m*r)), for k < m and 0 < j < r
+ * following those of the previous stages, in the order mixed_radix_inner()
+ * reads them. There are Σ m*(r-1) = N-1 of them.
+ * Returns false on allocation failure.
+ */
+static bool fft_plan_mixed_radix(struct fft_plan* const plan)
+{
+    double complex* tw;
+    size_t m = 1;
+
+    plan->num_factors = mixed_radix_stages(plan->num_samples, plan->radices);
+    assert(0 < plan->num_factors);
+    plan->twiddle = plan_alloc(plan->num_samples, sizeof(*plan->twiddle));
+    if (NULL == plan->twiddle)
+        return false;
+
+    tw = plan->twiddle;
+    for (int s=0; s<plan->num_factors; s++) {
+        const size_t g = m*plan->radices[s];
+
+        for (size_t k=0; k<m; k++) {
+            for (size_t j=1; j<plan->radices[s]; j++) {
+                //e^(-i2πn/g) = conj(e^(-i2π(g-n)/g)) for the second half
+                const size_t n = (j*k) % g;
+                *tw++ = (2*n <= g) ? exact_twiddle(n, g) :
+                    conj(exact_twiddle(g - n, g));
+            }
+        }
+        m = g;
+    }
+
+    return true;
+}
+
+/* FFT Plan Construction
+ * Builds a plan for num_samples that uses the given algorithm; for FFT_RADIX2
+ * also the given engine, and for FFT_ENGINE_TABLES the given leaf size.
+ * Mixed-radix plans precompute the twiddle factors of their stages, Rader
+ * and Bluestein plans compute their convolution kernel here, PFA plans
+ * acquire the plans of their factors and allocate their work buffer.
+ * Returns NULL on allocation failure.
+ * Release the plan with fft_plan_destroy().
+ */
+struct fft_plan* fft_plan_new(long num_samples, enum fft_algorithm algorithm,
+    enum fft_engine engine, size_t leaf)
+{
+    struct fft_plan* plan = calloc(1, sizeof(*plan));
+    bool ok = (NULL != plan);
+
+    assert(FFT_UNSUPPORTED != algorithm);
+
+    if (ok) {
+        plan->num_samples = num_samples;
+        plan->algorithm = algorithm;
+        plan->engine = engine;
+        plan->bytes = sizeof(*plan);
+    }
+    if (ok && (FFT_RADIX2 == algorithm) && (FFT_ENGINE_TABLES == engine)) {
+        ok = fft_plan_tables(plan, leaf);
+        plan->bytes += (num_samples/plan->leaf) * sizeof(*plan->bitrev) +
+            num_samples * sizeof(*plan->twiddle) +
+            ((NULL != plan->scratch) ? (2*num_samples*sizeof(vbatch_df)) : 0);
+    }
+    if (ok && ((FFT_MIXED_RADIX == algorithm) ||
+        ((FFT_RADIX2 == algorithm) && (FFT_ENGINE_MIXED_RADIX == engine)))) {
+        ok = fft_plan_mixed_radix(plan);
+        plan->bytes += num_samples * sizeof(*plan->twiddle);
+    }
+    if (ok && ((FFT_RADER == algorithm) || (FFT_BLUESTEIN == algorithm)))
+        ok = conv_kernel_init(plan);
+    if (ok && (FFT_PFA == algorithm))
+        ok = pfa_init(plan);
+
+    if (!ok) {
+        error("Error allocating fft_plan for %ld samples\n", num_samples);
+        fft_plan_destroy(plan);
+        plan = NULL;
+    }
+
+    return plan;
+}
+
+/* release an fft_plan created by fft_plan_create(), plan may be NULL */
+void fft_plan_destroy(struct fft_plan* const plan)
+{
+    if (NULL == plan)
+        return;
+
+    free(plan->bitrev);
+    free(plan->twiddle);
+    if (NULL != plan->conv)
+        conv_kernel_free(plan->conv);
+    fft_plan_release(plan->sub[0]);
+    fft_plan_release(plan->sub[1]);
+    free(plan->scratch);
+    free(plan);
+}
+
+/* Thread Pool Worker
+ * Waits for the jobs posted by thread_pool_run() and runs its share of each
+ * one, until thread_pool_stop() shuts the pool down.
+ */
+static void* thread_pool_worker(void* arg)
+{
+    const size_t index = (size_t)arg;
+    size_t generation = 0;
+
+    pthread_mutex_lock(&thread_pool.lock);
+    while (true) {
+        while (!thread_pool.shutdown && (generation == thread_pool.generation))
+            pthread_cond_wait(&thread_pool.start, &thread_pool.lock);
+        if (thread_pool.shutdown)
+/*BREAK*/   break;
+        generation = thread_pool.generation;
+        verbose_quiet = thread_pool.quiet;
+        pthread_mutex_unlock(&thread_pool.lock);
+
+        thread_pool.job(thread_pool.arg, index, thread_pool.num_threads);
+
+        pthread_mutex_lock(&thread_pool.lock);
+        if (0 == --thread_pool.busy)
+            pthread_cond_signal(&thread_pool.finish);
+    }
+    pthread_mutex_unlock(&thread_pool.lock);
+
+    return NULL;
+}
+
+/* stop the workers of the thread pool, if it is started, thread_pool_owner
+   must be held */
+static void thread_pool_shutdown(void)
+{
+    if (0 == thread_pool.num_threads)
+        return;
+
+    pthread_mutex_lock(&thread_pool.lock);
+    thread_pool.shutdown = true;
+    pthread_cond_broadcast(&thread_pool.start);
+    pthread_mutex_unlock(&thread_pool.lock);
+
+    for (size_t i=1; i<thread_pool.num_threads; i++)
+        pthread_join(thread_pool.workers[i-1], NULL);
+
+    pthread_barrier_destroy(&thread_pool.barrier);
+    pthread_cond_destroy(&thread_pool.finish);
+    pthread_cond_destroy(&thread_pool.start);
+    pthread_mutex_destroy(&thread_pool.lock);
+    free(thread_pool.workers);
+    memset(&thread_pool, 0, sizeof(thread_pool));
+}
+
+/* NUMA node of cpu according to sysfs, 0 if it is unknown */
+static int cpu_node(int cpu)
+{
+    char path[64];
+
+    for (int node=0; node<MAX_NUMA_NODES; node++) {
+        snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/node%d", cpu, node);
+        if (0 == access(path, F_OK))
+            return node;
+    }
+
+    return 0;
+}
+
+/* Thread Pool CPUs
+ * Lists the CPUs that the process may run on (as restricted by taskset or
+ * numactl) into cpus, sorted by NUMA node, so that consecutive threads of
+ * the pool share a node and the contiguous ranges of the output that they
+ * compute (and first touch) are on that node.
+ * Returns the number of CPUs, 0 if they cannot be determined.
+ */
+static size_t thread_pool_cpus(int cpus[CPU_SETSIZE])
+{
+    int nodes[CPU_SETSIZE];
+    cpu_set_t set;
+    size_t count = 0;
+
+    if (0 != sched_getaffinity(0, sizeof(set), &set))
+        return 0;
+
+    //insertion sort by node, stable so CPUs of a node stay in order
+    for (int cpu=0; cpu<CPU_SETSIZE; cpu++) {
+        size_t i = count;
+        int node;
+
+        if (!CPU_ISSET(cpu, &set))
+            continue;
+
+        node = cpu_node(cpu);
+        for (; (i > 0) && (nodes[i-1] > node); i--) {
+            nodes[i] = nodes[i-1];
+            cpus[i] = cpus[i-1];
+        }
+        nodes[i] = node;
+        cpus[i] = cpu;
+        count++;
+    }
+
+    return count;
+}
+
+/* Thread Pool Start
+ * Starts num_threads-1 persistent worker threads, which together with the
+ * calling thread run the jobs of thread_pool_run(). The workers are kept
+ * between jobs, so no threads are created per transform; the pool is only
+ * restarted if num_threads changes.
+ * With -a, thread i is pinned to CPU i of thread_pool_cpus() (wrapping
+ * around if there are more threads than CPUs), the calling thread included.
+ * Returns false if the threads cannot be created.
+ */
+static bool thread_pool_start(size_t num_threads)
+{
+    int cpus[CPU_SETSIZE];
+    const size_t num_cpus = option_affinity ? thread_pool_cpus(cpus) : 0;
+    pthread_attr_t attr;
+    cpu_set_t set;
+    size_t started = 1;
+
+    if (num_threads == thread_pool.num_threads)
+        return true;
+    thread_pool_shutdown();
+
+    thread_pool.workers = calloc(num_threads-1, sizeof(*thread_pool.workers));
+    if (NULL == thread_pool.workers) {
+        error("Error allocating the thread pool\n");
+        return false;
+    }
+    pthread_mutex_init(&thread_pool.lock, NULL);
+    pthread_cond_init(&thread_pool.start, NULL);
+    pthread_cond_init(&thread_pool.finish, NULL);
+    pthread_barrier_init(&thread_pool.barrier, NULL, num_threads);
+    thread_pool.num_threads = num_threads;
+
+    pthread_attr_init(&attr);
+    if (num_cpus > 0) {
+        CPU_ZERO(&set);
+        CPU_SET(cpus[0], &set);
+        pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    }
+    for (; started<num_threads; started++) {
+        if (num_cpus > 0) {
+            CPU_ZERO(&set);
+            CPU_SET(cpus[started % num_cpus], &set);
+            pthread_attr_setaffinity_np(&attr, sizeof(set), &set);
+        }
+        if (0 != pthread_create(&thread_pool.workers[started-1], &attr,
+            thread_pool_worker, (void*)started))
+/*BREAK*/   break;
+    }
+    pthread_attr_destroy(&attr);
+    verbose("Thread pool: %zd threads, pinned to %zd CPUs\n", started, (num_cpus < started) ? num_cpus : started);
+
+    if (started < num_threads) {
+        error("Error creating thread %zd of the thread pool\n", started);
+        thread_pool.num_threads = started;
+        thread_pool_shutdown();
+        return false;
+    }
+
+    return true;
+}
+
+/* Thread Pool Acquire
+ * Takes the thread pool for the calling thread and starts it with
+ * num_threads threads, see thread_pool_start(). The pool runs the jobs of one
+ * caller at a time: if another thread holds it (or the caller already does,
+ * from within a job), this returns false at once and the caller transforms
+ * serially rather than waiting, so the pool is never restarted under a job.
+ * Hand the pool back with thread_pool_release().
+ * Returns false if the pool is busy or cannot be started.
+ */
+bool thread_pool_acquire(size_t num_threads)
+{
+    if (0 != pthread_mutex_trylock(&thread_pool_owner))
+        return false;
+
+    if (!thread_pool_start(num_threads)) {
+        pthread_mutex_unlock(&thread_pool_owner);
+        return false;
+    }
+
+    return true;
+}
+
+/* hand back the thread pool taken by thread_pool_acquire() */
+void thread_pool_release(void)
+{
+    pthread_mutex_unlock(&thread_pool_owner);
+}
+
+/* stop the workers of the thread pool once its current user is done */
+void thread_pool_stop(void)
+{
+    pthread_mutex_lock(&thread_pool_owner);
+    thread_pool_shutdown();
+    pthread_mutex_unlock(&thread_pool_owner);
+}
+
+/* Thread Pool Run
+ * Runs job(arg, index, count) on each of the count threads of the pool, the
+ * calling thread being index 0, and returns when all of them are done.
+ * Within the job, thread_pool_barrier() synchronizes the threads.
+ * The caller must hold the pool, see thread_pool_acquire().
+ */
+void thread_pool_run(void (*job)(void* arg, size_t index, size_t count),
+    void* arg)
+{
+    pthread_mutex_lock(&thread_pool.lock);
+    thread_pool.job = job;
+    thread_pool.arg = arg;
+    thread_pool.quiet = verbose_quiet;
+    thread_pool.busy = thread_pool.num_threads - 1;
+    thread_pool.generation++;
+    pthread_cond_broadcast(&thread_pool.start);
+    pthread_mutex_unlock(&thread_pool.lock);
+
+    job(arg, 0, thread_pool.num_threads);
+
+    pthread_mutex_lock(&thread_pool.lock);
+    while (thread_pool.busy > 0)
+        pthread_cond_wait(&thread_pool.finish, &thread_pool.lock);
+    pthread_mutex_unlock(&thread_pool.lock);
+}
+
+/* wait until all the threads of the current job reach the barrier */
+static inline void thread_pool_barrier(void)
+{
+    pthread_barrier_wait(&thread_pool.barrier);
+}
+
+/* FFT Plan Stages
+ * Merges the leaf-sized DFTs in buf into the full transform. Same as the
+ * loop of fft_inner(), but stage h reads its twiddle factors from the
+ * contiguous plan->twiddle[h..2h).
+ * buf may hold howmany consecutive transforms, which are merged together one
+ * stage at a time so that the twiddle factors of the stage are reused from
+ * L1 for all of them.
+ * FFT_BACKWARD conjugates the twiddle factors as they are read, so both
+ * directions share the same table. The last stage multiplies its outputs by
+ * scale, which saves a separate normalization pass (or the leaves, if there
+ * are no stages).
+ */
+static inline void fft_plan_stages(const struct fft_plan* const plan,
+    double complex* restrict const buf, size_t howmany,
+    enum fft_direction direction, double scale)
+{
+    const size_t num_samples = plan->num_samples;
+    const size_t total = howmany*num_samples;
+    //sin(θ) of the twiddle factor e^(∓iθ) is -Im(w) forward, Im(w) backward
+    const double sin_sign = (FFT_BACKWARD == direction) ? 1.0 : -1.0;
+
+    //without any stages, the scale is applied to the leaf
+    if ((plan->leaf == num_samples) && (1.0 != scale)) {
+        for (size_t k=0; k<total; k++)
+            buf[k] *= scale;
+    }
+
+    for (size_t h=plan->leaf; h<num_samples; h<<=1) {
+        const double complex* restrict const w = &plan->twiddle[h];
+        const bool last = ((2*h) == num_samples) && (1.0 != scale);
+
+        for (size_t base=0; base<total; base+=2*h) {
+            double complex* restrict const x = &buf[base];
+            double complex* restrict const y = &buf[base + h];
+
+            for (size_t k=0; k<h; k++) {
+                const double complex t =
+                    mul_twiddle(y[k], creal(w[k]), sin_sign*cimag(w[k]));
+                if (last) {
+                    y[k] = (x[k] - t)*scale;
+                    x[k] = (x[k] + t)*scale;
+                } else {
+                    y[k] = x[k] - t;
+                    x[k] = x[k] + t;
+                }
+            }
+        }
+    }
+}
+
+/* FFT Plan Tables Leaves
+ * Computes the leaves first_leaf to last_leaf-1 of the FFT of the real
+ * samples in input_buf, sample n being input_buf[n*stride], into
+ * transform_buf. The bit-reverse permutation is folded into the gather: the
+ * leaf at n is the DFT of the samples bitrev[n/leaf] + j*N/leaf in natural
+ * order.
+ */
+static inline void fft_tables_leaves(const struct fft_plan* const plan,
+    const double* restrict const input_buf, size_t stride,
+    double complex* restrict const transform_buf, size_t first_leaf,
+    size_t last_leaf)
+{
+    const size_t leaf = plan->leaf;
+    const size_t leaf_stride = stride*(plan->num_samples/leaf);
+
+    for (size_t b=first_leaf; b<last_leaf; b++) {
+        double complex* const a = &transform_buf[b*leaf];
+        const double* const x = &input_buf[plan->bitrev[b]*stride];
+
+        for (size_t j=0; j<leaf; j++)
+            a[j] = CMPLX(x[j*leaf_stride], 0);
+        if (leaf > 1)
+            winograd_dft(leaf, a);
+    }
+}
+
+/* FFT Plan Tables Leaves (complex)
+ * Same as fft_tables_leaves() for the complex samples in, in either
+ * direction: the inverse uses IDFT(a) = conj(DFT(conj(a))).
+ * If in and out are the same buffer, it must already be in bit-reversed
+ * order and the leaves are computed in place by winograd_leaf().
+ */
+static inline void fft_tables_complex_leaves(const struct fft_plan* const plan,
+    const double complex* const in, double complex* const out,
+    enum fft_direction direction, size_t first_leaf, size_t last_leaf)
+{
+    const size_t leaf = plan->leaf;
+    const size_t stride = plan->num_samples/leaf;
+    const bool backward = (FFT_BACKWARD == direction);
+
+    for (size_t b=first_leaf; b<last_leaf; b++) {
+        double complex* const a = &out[b*leaf];
+        const double complex* const x = &in[plan->bitrev[b]];
+
+        for (size_t j=0; (j<leaf) && (in != out); j++)
+            a[j] = x[j*stride];
+        for (size_t j=0; (j<leaf) && backward; j++)
+            a[j] = conj(a[j]);
+        if ((leaf > 1) && (in == out))
+            winograd_leaf(leaf, a, a);
+        else if (leaf > 1)
+            winograd_dft(leaf, a);
+        for (size_t j=0; (j<leaf) && backward; j++)
+            a[j] = conj(a[j]);
+    }
+}
+
+/* FFT Plan Stage (range)
+ * Butterflies first to last-1 of the N/2 butterflies of stage h of
+ * fft_plan_stages(), where butterfly i is k = i mod h of the group at
+ * 2h*(i/h), for fft_tables_job(). The last stage multiplies its outputs by
+ * scale.
+ */
+static inline void fft_plan_stage_range(const struct fft_plan* const plan,
+    double complex* restrict const buf, size_t h, size_t first, size_t last,
+    enum fft_direction direction, double scale)
+{
+    const double complex* restrict const w = &plan->twiddle[h];
+    const double sin_sign = (FFT_BACKWARD == direction) ? 1.0 : -1.0;
+    const bool scaled = ((2*h) == plan->num_samples) && (1.0 != scale);
+
+    for (size_t i=first; i<last; ) {
+        const size_t k0 = i % h;
+        const size_t end = ((last - i) < (h - k0)) ? (k0 + last - i) : h;
+        double complex* restrict const x = &buf[2*(i - k0)];
+        double complex* restrict const y = &x[h];
+
+        for (size_t k=k0; k<end; k++) {
+            const double complex t =
+                mul_twiddle(y[k], creal(w[k]), sin_sign*cimag(w[k]));
+            if (scaled) {
+                y[k] = (x[k] - t)*scale;
+                x[k] = (x[k] + t)*scale;
+            } else {
+                y[k] = x[k] - t;
+                x[k] = x[k] + t;
+            }
+        }
+        i += end - k0;
+    }
+}
+
+/* arguments of fft_tables_job() */
+struct tables_job {
+    const struct fft_plan* plan;
+    const double* input_buf; //real samples, NULL for complex_buf
+    size_t stride; //of the samples in input_buf
+    const double complex* complex_buf; //complex samples, NULL for input_buf
+    double complex* transform_buf;
+    enum fft_direction direction;
+    double scale;
+};
+
+/* compute the leaves first_leaf to last_leaf-1 of the FFT of a tables_job */
+static inline void fft_tables_job_leaves(const struct tables_job* const job,
+    size_t first_leaf, size_t last_leaf)
+{
+    if (NULL != job->input_buf)
+        fft_tables_leaves(job->plan, job->input_buf, job->stride,
+            job->transform_buf, first_leaf, last_leaf);
+    else
+        fft_tables_complex_leaves(job->plan, job->complex_buf,
+            job->transform_buf, job->direction, first_leaf, last_leaf);
+}
+
+/* FFT Plan Tables Job
+ * Share index of count of fft_tables_run() on the thread pool: the leaves
+ * and the butterflies of each stage are split into count contiguous ranges,
+ * with a barrier between the stages. If count is a power of 2, the stages
+ * with groups no larger than N/count stay within the range of the thread
+ * that computed their inputs, so they need no barrier and run depth first
+ * on data in the cache of that thread.
+ * The leaves are the first writes to transform_buf, so each thread first
+ * touches the range of the output that it computes, and Linux places the
+ * pages of a newly allocated output on the NUMA node of that thread.
+ */
+static void fft_tables_job(void* arg, size_t index, size_t count)
+{
+    const struct tables_job* const job = arg;
+    const struct fft_plan* const plan = job->plan;
+    const size_t num_samples = plan->num_samples;
+    const size_t num_leaves = num_samples/plan->leaf;
+    const size_t half_n = num_samples/2;
+    const size_t local = ispowerof2(count) ? (num_samples/count) : 0;
+
+    fft_tables_job_leaves(job, index*num_leaves/count,
+        (index + 1)*num_leaves/count);
+
+    for (size_t h=plan->leaf; h<num_samples; h<<=1) {
+        if ((2*h) > local)
+            thread_pool_barrier();
+        fft_plan_stage_range(plan, job->transform_buf, h, index*half_n/count,
+            (index + 1)*half_n/count, job->direction, job->scale);
+    }
+}
+
+/* FFT Plan Tables Run
+ * Runs the FFT of a tables_job: fft_tables_job_leaves() and
+ * fft_plan_stages(), so there is no setup or shuffle per call.
+ * With -t, sizes of at least PARALLEL_MIN_SAMPLES are split across the
+ * threads of the persistent thread pool by fft_tables_job(), unless another
+ * thread is using the pool.
+ */
+static void fft_tables_run(struct tables_job* const job)
+{
+    const struct fft_plan* const plan = job->plan;
+    const size_t num_samples = plan->num_samples;
+
+    if ((option_threads > 1) && (num_samples >= PARALLEL_MIN_SAMPLES) &&
+        thread_pool_acquire(option_threads)) {
+        thread_pool_run(fft_tables_job, job);
+        thread_pool_release();
+        return;
+    }
+
+    fft_tables_job_leaves(job, 0, num_samples/plan->leaf);
+    fft_plan_stages(plan, job->transform_buf, 1, job->direction, job->scale);
+}
+
+/* FFT Plan Tables Execution
+ * Power of 2 FFT of the real samples in input_buf, sample n being
+ * input_buf[n*stride], into transform_buf with the FFT_ENGINE_TABLES engine,
+ * by fft_tables_run().
+ *
+ * Note: input_buf is not modified
+ * Note: transform_buf cannot overlap with input_buf
+ */
+static void fft_tables_execute(const struct fft_plan* const plan,
+    const double* restrict const input_buf, size_t stride,
+    double complex* restrict const transform_buf)
+{
+    struct tables_job job = {plan, input_buf, stride, NULL, transform_buf,
+        FFT_FORWARD, 1.0};
+
+    fft_tables_run(&job);
+}
+
+/* SIMD Batch FFT implementation
+ * FFTs of SIMD_BATCH_LANES real signals at once, read like
+ * fft_tables_batch(), with each signal in its own lane of the vectors.
+ * The signals are interleaved into split real and imaginary arrays of
+ * vectors, so every butterfly of every stage (including the narrow early
+ * ones) is full-width vector code: the same radix-2 stages as fft_inner(),
+ * with the twiddle factors of plan->twiddle[h..2h) broadcast to all lanes.
+ * The first stage is fused with the bit-reversed gather, positions n and n+1
+ * read samples bitrev(n) and bitrev(n) + N/2.
+ * The arrays are the plan's scratch, see fft_plan_tables().
+ *
+ * Note: num_samples must be a power of 2 from SIMD_BATCH_MIN_SAMPLES to
+ *       SIMD_BATCH_MAX_SAMPLES
+ */
+static void fft_simd_batch(const struct fft_plan* const plan,
+    const double* restrict const input_buf, size_t stride, size_t dist,
+    double complex* restrict const transform_buf)
+{
+    const size_t num_samples = plan->num_samples;
+    const size_t half_n = num_samples/2;
+    const int shift = 64 - __builtin_ctzl(num_samples);
+    vbatch_df* restrict const re = (vbatch_df*)plan->scratch;
+    vbatch_df* restrict const im = &re[num_samples];
+
+    for (uint64_t n=0; n<num_samples; n+=2) {
+        const size_t r = reverse_bits(n)>>shift;
+        vbatch_df a;
+        vbatch_df b;
+
+        for (size_t l=0; l<SIMD_BATCH_LANES; l++) {
+            a[l] = input_buf[l*dist + r*stride];
+            b[l] = input_buf[l*dist + (r + half_n)*stride];
+        }
+        re[n] = a + b;
+        re[n+1] = a - b;
+        im[n] = im[n+1] = (vbatch_df){0};
+    }
+
+    for (size_t h=2; h<num_samples; h<<=1) {
+        const double complex* restrict const w = &plan->twiddle[h];
+
+        for (size_t base=0; base<num_samples; base+=2*h) {
+            for (size_t k=0, j=base+h; k<h; k++, j++) {
+                const double wr = creal(w[k]);
+                const double wi = cimag(w[k]);
+                const vbatch_df tr = re[j]*wr - im[j]*wi;
+                const vbatch_df ti = re[j]*wi + im[j]*wr;
+
+                re[j] = re[base + k] - tr;
+                im[j] = im[base + k] - ti;
+                re[base + k] += tr;
+                im[base + k] += ti;
+            }
+        }
+    }
+
+    for (size_t l=0; l<SIMD_BATCH_LANES; l++) {
+        double complex* const out = &transform_buf[l*num_samples];
+
+        for (size_t k=0; k<num_samples; k++)
+            out[k] = CMPLX(re[k][l], im[k][l]);
+    }
+}
+
+/* FFT Plan Tables Batch Execution
+ * Same as fft_tables_execute() for the howmany real signals in input_buf,
+ * where sample n of signal t is input_buf[t*dist + n*stride], into
+ * consecutive transforms in transform_buf.
+ * The signals are processed in blocks of BATCH_BLOCK_BYTES of output: the
+ * leaves of the whole block are computed first and then each stage is run
+ * over the whole block, so the block and the twiddle factors of a stage stay
+ * in L1 across the signals. Signals larger than a block are transformed one
+ * at a time, and from PARALLEL_MIN_SAMPLES on by fft_tables_execute(), so
+ * that with -t each of them is split across the thread pool.
+ * Sizes from SIMD_BATCH_MIN_SAMPLES to SIMD_BATCH_MAX_SAMPLES, too narrow to
+ * vectorize within one transform, are transformed SIMD_BATCH_LANES signals
+ * at a time by fft_simd_batch() instead, the rest as above.
+ *
+ * Note: transform_buf cannot overlap with input_buf
+ */
+static void fft_tables_batch(const struct fft_plan* const plan,
+    size_t howmany, const double* restrict const input_buf, size_t stride,
+    size_t dist, double complex* restrict const transform_buf)
+{
+    const size_t num_samples = plan->num_samples;
+    const size_t num_leaves = num_samples/plan->leaf;
+    size_t block = BATCH_BLOCK_BYTES/(num_samples*sizeof(*transform_buf));
+    size_t first = 0;
+
+    //large signals are transformed one at a time, across the thread pool
+    if (num_samples >= PARALLEL_MIN_SAMPLES) {
+        for (size_t t=0; t<howmany; t++)
+            fft_tables_execute(plan, &input_buf[t*dist], stride,
+                &transform_buf[t*num_samples]);
+        return;
+    }
+
+    if (block < 1)
+        block = 1;
+
+    if ((SIMD_BATCH_MIN_SAMPLES <= num_samples) &&
+        (num_samples <= SIMD_BATCH_MAX_SAMPLES)) {
+        for (; (first + SIMD_BATCH_LANES) <= howmany;
+            first += SIMD_BATCH_LANES)
+            fft_simd_batch(plan, &input_buf[first*dist], stride, dist,
+                &transform_buf[first*num_samples]);
+    }
+
+    for (size_t t0=first; t0<howmany; t0+=block) {
+        const size_t count = ((howmany - t0) < block) ? (howmany - t0) : block;
+        double complex* const out = &transform_buf[t0*num_samples];
+
+        for (size_t t=0; t<count; t++)
+            fft_tables_leaves(plan, &input_buf[(t0 + t)*dist], stride,
+                &out[t*num_samples], 0, num_leaves);
+
+        fft_plan_stages(plan, out, count, FFT_FORWARD, 1.0);
+    }
+}
+
+/* FFT Plan Tables DIT
+ * Decimation-in-time FFT of the complex samples in buf, which must already be
+ * in bit-reversed order, into natural order in place, in either direction.
+ * The leaves are computed by fft_tables_complex_leaves() and merged by
+ * fft_plan_stages().
+ * The outputs are multiplied by scale.
+ *
+ * Note: plan must use the FFT_ENGINE_TABLES engine
+ */
+static inline void fft_tables_dit(const struct fft_plan* const plan,
+    double complex* restrict const buf, enum fft_direction direction,
+    double scale)
+{
+    fft_tables_complex_leaves(plan, buf, buf, direction, 0,
+        plan->num_samples/plan->leaf);
+    fft_plan_stages(plan, buf, 1, direction, scale);
+}
+
+/* FFT Plan Tables DIF
+ * Decimation-in-frequency forward FFT of the complex samples in buf, in
+ * natural order, into bit-reversed order in place: fft_plan_stages() run
+ * backwards, splitting rather than merging.
+ *   y[k] = (x[k] - y[k])*e^(-iπk/h), x[k] = x[k] + y[k]
+ * Stage h reads the same plan->twiddle[h..2h) and the remaining leaves are
+ * computed by winograd_dft() and stored in bit-reversed order.
+ *
+ * Note: plan must use the FFT_ENGINE_TABLES engine
+ */
+static inline void fft_tables_dif(const struct fft_plan* const plan,
+    double complex* restrict const buf)
+{
+    const size_t num_samples = plan->num_samples;
+    const size_t leaf = plan->leaf;
+
+    for (size_t h=num_samples/2; h>=leaf; h>>=1) {
+        const double complex* restrict const w = &plan->twiddle[h];
+
+        for (size_t base=0; base<num_samples; base+=2*h) {
+            double complex* restrict const x = &buf[base];
+            double complex* restrict const y = &buf[base + h];
+
+            for (size_t k=0; k<h; k++) {
+                const double complex d = x[k] - y[k];
+                x[k] = x[k] + y[k];
+                y[k] = mul_twiddle(d, creal(w[k]), -cimag(w[k]));
+            }
+        }
+    }
+
+    for (size_t n=0; (n<num_samples) && (leaf > 1); n+=leaf) {
+        const int shift = 64 - __builtin_ctzl(leaf);
+        double complex a[MAX_RADIX];
+
+        for (size_t j=0; j<leaf; j++)
+            a[j] = buf[n + j];
+        winograd_dft(leaf, a);
+        for (uint64_t k=0; k<leaf; k++)
+            buf[n + (reverse_bits(k)>>shift)] = a[k];
+    }
+}
+
+/* FFT Plan Tables (complex)
+ * Same as fft_tables_execute() but for complex samples, in either direction,
+ * by fft_tables_run() with fft_tables_complex_leaves(). The inverse reuses
+ * the forward tables: the leaves use IDFT(a) = conj(DFT(conj(a))) and the
+ * stages conjugate the twiddle factors on the fly. The outputs are
+ * multiplied by scale.
+ * in and out may be the same buffer, in which case the buffer is bit-reverse
+ * shuffled in place first, so no working space is needed.
+ *
+ * Note: plan must use the FFT_ENGINE_TABLES engine
+ */
+static inline void fft_tables_complex(const struct fft_plan* const plan,
+    const double complex* in, double complex* const out,
+    enum fft_direction direction, double scale)
+{
+    struct tables_job job = {plan, NULL, 0, in, out, direction, scale};
+
+    assert((FFT_RADIX2 == plan->algorithm) &&
+        (FFT_ENGINE_TABLES == plan->engine));
+
+    if (in == out)
+        shuffle_complex(plan->num_samples, out);
+
+    fft_tables_run(&job);
+}
+
+/* FFT Plan Execution (complex)
+ * Forward FFT of the complex samples in into out with fft_tables_complex().
+ * in and out may be the same buffer.
+ *
+ * Note: plan must use the FFT_ENGINE_TABLES engine
+ */
+void fft_plan_execute_complex(const struct fft_plan* const plan,
+    const double complex* in, double complex* const out)
+{
+    fft_tables_complex(plan, in, out, FFT_FORWARD, 1.0);
+}
+
+/* FFT Plan Execution (inverse)
+ * Inverse FFT of the complex samples in into out with fft_tables_complex(),
+ * using the tables of the forward plan:
+ *   x(n) = Σ X(k)*e^(i2πnk/N), times 1/N if normalize is true
+ * in and out may be the same buffer.
+ *
+ * Note: plan must use the FFT_ENGINE_TABLES engine
+ */
+void fft_plan_execute_inverse(const struct fft_plan* const plan,
+    const double complex* in, double complex* const out, bool normalize)
+{
+    fft_tables_complex(plan, in, out, FFT_BACKWARD,
+        normalize ? (1.0/plan->num_samples) : 1.0);
+}
+
+/* FFT Plan Execution (DIF)
+ * Forward FFT of the complex samples in buf in place with fft_tables_dif(),
+ * leaving the spectrum in bit-reversed order: buf[n] = X(bitrev(n)).
+ * For convolution and filtering, where the order of the spectrum does not
+ * matter between the forward FFT, the pointwise multiply and the inverse
+ * FFT, pair it with fft_plan_execute_dit_inverse() so that neither direction
+ * needs a bit-reverse shuffle.
+ *
+ * Note: plan must use the FFT_ENGINE_TABLES engine
+ */
+void fft_plan_execute_dif(const struct fft_plan* const plan,
+    double complex* const buf)
+{
+    assert((FFT_RADIX2 == plan->algorithm) &&
+        (FFT_ENGINE_TABLES == plan->engine));
+
+    fft_tables_dif(plan, buf);
+}
+
+/* FFT Plan Execution (DIT inverse)
+ * Inverse FFT of the complex spectrum in buf in place with fft_tables_dit(),
+ * where buf is in the bit-reversed order that fft_plan_execute_dif() leaves:
+ *   x(n) = Σ X(k)*e^(i2πnk/N), times 1/N if normalize is true
+ * The result is in natural order.
+ *
+ * Note: plan must use the FFT_ENGINE_TABLES engine
+ */
+void fft_plan_execute_dit_inverse(const struct fft_plan* const plan,
+    double complex* const buf, bool normalize)
+{
+    assert((FFT_RADIX2 == plan->algorithm) &&
+        (FFT_ENGINE_TABLES == plan->engine));
+
+    fft_tables_dit(plan, buf, FFT_BACKWARD,
+        normalize ? (1.0/plan->num_samples) : 1.0);
+}
+
+/* size of the power of 2 convolution needed by the Bluestein FFT */
+long bluestein_conv_samples(long num_samples)
+{
+    long conv_samples = 1;
+
+    while (conv_samples < (2*num_samples - 1))
+        conv_samples <<= 1;
+
+    return conv_samples;
+}
+
+/* a*b mod m without overflow for any 64-bit a, b < m */
+static inline size_t mulmod(size_t a, size_t b, size_t m)
+{
+    return (size_t)(((unsigned __int128)a * b) % m);
+}
+
+/* a^e mod m by repeated squaring */
+size_t powmod(size_t a, size_t e, size_t m)
+{
+    size_t x = 1;
+
+    for (; e>0; e>>=1) {
+        if (e & 1)
+            x = mulmod(x, a, m);
+        a = mulmod(a, a, m);
+    }
+
+    return x;
+}
+
+/* check whether num_samples is prime */
+bool isprime(long num_samples)
+{
+    if (num_samples < 2)
+        return false;
+
+    for (long d=2; d*d<=num_samples; d++) {
+        if (0 == (num_samples % d))
+            return false;
+    }
+
+    return true;
+}
+
+/* Prime Factor Split
+ * Returns the largest power of the smallest prime factor of num_samples, which
+ * is coprime to the remaining factor, or 0 if num_samples is a prime power.
+ */
+long pfa_split(long num_samples)
+{
+    long p = 2; //smallest prime factor
+    long n1 = 1;
+    long n2 = num_samples;
+
+    while ((0 != (num_samples % p)) && (p*p <= num_samples))
+        p++;
+    if (0 != (num_samples % p))
+        return 0; //prime
+
+    while (0 == (n2 % p)) {
+        n1 *= p;
+        n2 /= p;
+    }
+
+    return (1 == n2) ? 0 : n1;
+}
+
+/* FFT Planner
+ * Picks the algorithm fft() will use for num_samples:
+ * - powers of 2 use the radix-2 FFT
+ * - sizes with only factors 2, 3, 5 and 7 use the mixed-radix FFT
+ * - primes p where p-1 only has factors 2, 3, 5 and 7 use Rader's algorithm
+ *   with a length p-1 convolution computed by the radix-2 or mixed-radix FFT
+ * - other sizes with coprime factors use the prime factor algorithm, each
+ *   factor being planned in turn
+ * - all other sizes use Bluestein's algorithm
+ */
+enum fft_algorithm fft_plan_algorithm(long num_samples)
+{
+    int radices[MAX_FACTORS];
+    long n1;
+
+    if (num_samples <= 0)
+        return FFT_UNSUPPORTED;
+    if (ispowerof2(num_samples))
+        return FFT_RADIX2;
+    if (0 < factorize(num_samples, radices))
+        return FFT_MIXED_RADIX;
+    if (isprime(num_samples) && (0 < factorize(num_samples-1, radices)))
+        return FFT_RADER;
+
+    n1 = pfa_split(num_samples);
+    if (0 < n1) {
+        if ((FFT_UNSUPPORTED == fft_plan_algorithm(n1)) ||
+            (FFT_UNSUPPORTED == fft_plan_algorithm(num_samples/n1)))
+            return FFT_UNSUPPORTED;
+        return FFT_PFA;
+    }
+
+    return FFT_BLUESTEIN;
+}
+
+/* Convolution Kernel FFT
+ * FFT of the M samples of a convolution kernel into entry->kernel_fft, using
+ * fft_plan_execute_dif() for powers of 2, which leaves it in the bit-reversed
+ * order that conv_apply() multiplies, and the mixed-radix plan otherwise.
+ * Note: kernel is overwritten if M is a power of 2
+ */
+void conv_kernel_fft(struct conv_kernel* const entry,
+    double complex* const kernel)
+{
+    if (ispowerof2(entry->conv_samples)) {
+        memcpy(entry->kernel_fft, kernel,
+            entry->conv_samples * sizeof(*entry->kernel_fft));
+        fft_plan_execute_dif(entry->plan, entry->kernel_fft);
+    } else {
+        fft_algorithm_execute(entry->plan, NULL, kernel, entry->kernel_fft);
+    }
+}
+
+/* Cyclic Convolution
+ * Convolves the M samples in a with the kernel of entry in place:
+ *   a = IFFT(FFT(a)*kernel_fft)
+ * For powers of 2 the spectrum stays in bit-reversed order between
+ * fft_plan_execute_dif() and fft_plan_execute_dit_inverse(), so neither
+ * direction shuffles. Otherwise the inverse is computed by the mixed-radix
+ * plan as conj(FFT(conj(a))), using the M entries of work.
+ * The 1/M normalization is already folded into kernel_fft.
+ */
+void conv_apply(const struct conv_kernel* const entry,
+    double complex* restrict const a, double complex* restrict const work)
+{
+    const long conv_samples = entry->conv_samples;
+
+    if (ispowerof2(conv_samples)) {
+        fft_plan_execute_dif(entry->plan, a);
+        for (long k=0; k<conv_samples; k++)
+            a[k] *= entry->kernel_fft[k];
+        fft_plan_execute_dit_inverse(entry->plan, a, false);
+    } else {
+        double complex* const c = work;
+
+        fft_algorithm_execute(entry->plan, NULL, a, c);
+        for (long k=0; k<conv_samples; k++)
+            c[k] = conj(c[k]*entry->kernel_fft[k]);
+        fft_algorithm_execute(entry->plan, NULL, c, a);
+        for (long k=0; k<conv_samples; k++)
+            a[k] = conj(a[k]);
+    }
+}
+
+/* release a convolution kernel from conv_kernel_init() and its plan */
+void conv_kernel_free(struct conv_kernel* const entry)
+{
+    free(entry->chirp);
+    free(entry->perm);
+    free(entry->kernel_fft);
+    fft_plan_release(entry->plan);
+    free(entry);
+}
+
+/* Bluestein Chirp Setup
+ *   chirp[n] = e^(-iπn²/N)
+ *   kernel_fft = FFT(b)/M, where b[n] = b[M-n] = conj(chirp[n])
+ * n² is reduced modulo 2N with integer arithmetic before it is converted to
+ * an angle so that the chirp stays accurate for large n.
+ * b is M entries of working space.
+ * Returns false on allocation failure.
+ */
+bool bluestein_init(struct conv_kernel* const entry, double complex* const b)
+{
+    const long num_samples = entry->num_samples;
+    size_t n2 = 0; //n² mod 2N
+
+    entry->chirp = malloc(num_samples * sizeof(*entry->chirp));
+    if (NULL == entry->chirp)
+        return false;
+
+    verbose("Bluestein: %ld samples, convolution of %ld samples\n", num_samples, entry->conv_samples);
+
+    memset(b, 0, entry->conv_samples * sizeof(*b));
+    for (size_t n=0; n<num_samples; n++) {
+        entry->chirp[n] = cexp(-I*M_PI*n2/num_samples);
+        b[n] = conj(entry->chirp[n])/entry->conv_samples;
+        if (n > 0)
+            b[entry->conv_samples-n] = b[n];
+
+        //(n+1)² = n² + 2n + 1
+        n2 = (n2 + 2*n + 1) % (2*num_samples);
+    }
+    conv_kernel_fft(entry, b);
+
+    return true;
+}
+
+/* Rader Kernel Setup
+ * Finds a generator g of the multiplicative group modulo the prime N and
+ * tabulates perm[q] = g^q mod N, which visits every index 1..N-1 once.
+ *   kernel_fft = FFT(b)/(N-1), where b[q] = e^(-i2π*g^(-q)/N)
+ * b is M entries of working space.
+ * Returns false on allocation failure.
+ */
+bool rader_init(struct conv_kernel* const entry, double complex* const b)
+{
+    const long num_samples = entry->num_samples;
+    const long conv_samples = num_samples-1;
+    int radices[MAX_FACTORS];
+    int num_factors = factorize(conv_samples, radices);
+    size_t g;
+
+    entry->perm = malloc(conv_samples * sizeof(*entry->perm));
+    if (NULL == entry->perm)
+        return false;
+
+    //g is a generator iff g^((N-1)/f) != 1 for every prime factor f of N-1
+    for (g=2; g<num_samples; g++) {
+        bool generator = true;
+        for (int f=0; (f<num_factors) && generator; f++)
+            generator = (1 != powmod(g, conv_samples/radices[f], num_samples));
+        if (generator)
+/*BREAK*/   break;
+    }
+
+    verbose("Rader: %ld samples, generator %zd\n", num_samples, g);
+
+    entry->perm[0] = 1;
+    for (long q=1; q<conv_samples; q++)
+        entry->perm[q] = mulmod(entry->perm[q-1], g, num_samples);
+
+    //g^(-q) = g^(N-1-q)
+    for (long q=0; q<conv_samples; q++) {
+        size_t n = entry->perm[(conv_samples-q) % conv_samples];
+        b[q] = cexp(-I*2*M_PI*n/num_samples)/conv_samples;
+    }
+    conv_kernel_fft(entry, b);
+
+    return true;
+}
+
+/* Convolution Kernel Setup
+ * Computes the convolution kernel of a Bluestein or Rader plan with
+ * bluestein_init() or rader_init() and allocates the plan's scratch of 2M
+ * entries for executing it. The plan of the convolution, complex tables for
+ * a power of 2 and otherwise the mixed-radix plan of M, comes from the plan
+ * cache and is held until the kernel is freed.
+ * The 1/M normalization of the inverse FFT is folded into kernel_fft.
+ * Returns false on allocation failure.
+ */
+bool conv_kernel_init(struct fft_plan* const plan)
+{
+    const long num_samples = plan->num_samples;
+    const enum fft_algorithm algorithm = plan->algorithm;
+    //both algorithms need less than 2N complex samples for the convolution
+    const long conv_samples = (FFT_BLUESTEIN == algorithm) ?
+        bluestein_conv_samples(num_samples) : (num_samples-1);
+    struct conv_kernel* const entry = calloc(1, sizeof(*entry));
+    bool ok = (NULL != entry);
+
+    plan->conv = entry;
+    if (ok && memory_check(3*conv_samples, sizeof(*plan->scratch),
+        "convolution kernel")) {
+        entry->num_samples = num_samples;
+        entry->algorithm = algorithm;
+        entry->conv_samples = conv_samples;
+        entry->kernel_fft = malloc(conv_samples * sizeof(*entry->kernel_fft));
+        plan->scratch = malloc(2*conv_samples * sizeof(*plan->scratch));
+    }
+    ok = ok && (NULL != entry->kernel_fft) && (NULL != plan->scratch);
+    if (ok) {
+        entry->plan = fft_plan_acquire(conv_samples,
+            ispowerof2(conv_samples) ? FFT_LAYOUT_COMPLEX : FFT_LAYOUT_REAL,
+            FFT_ESTIMATE);
+        ok = (NULL != entry->plan);
+    }
+
+    if (ok && (FFT_BLUESTEIN == algorithm))
+        ok = bluestein_init(entry, plan->scratch);
+    else if (ok)
+        ok = rader_init(entry, plan->scratch);
+
+    if (ok) {
+        plan->bytes += sizeof(*entry) +
+            3*conv_samples * sizeof(*plan->scratch) +
+            ((FFT_BLUESTEIN == algorithm) ?
+            (num_samples * sizeof(*entry->chirp)) :
+            ((num_samples-1) * sizeof(*entry->perm)));
+    } else {
+        error("Error allocating convolution kernel for %ld samples\n", num_samples);
+    }
+
+    return ok;
+}
+
+/* Bluestein FFT implementation
+ * Re-expresses the DFT as a convolution using nk = (n² + k² - (k-n)²)/2:
+ *   Xk = chirp[k] * Σ (x[n]*chirp[n]) * conj(chirp[k-n])
+ * The convolution is evaluated with power of 2 FFTs of at least 2N-1 samples
+ * so it works for any size, including primes, in O(Nlog(N)).
+ * The inverse FFT is computed as conj(FFT(conj(...))) with the conjugation
+ * folded into the pointwise multiply and the final chirp multiply.
+ * The input is read from complex_buf if it is not NULL, otherwise from the
+ * real samples in input_buf.
+ *
+ * Note: the input buffers are not modified, plan->scratch is overwritten
+ */
+void fft_bluestein(const struct fft_plan* const plan,
+    const double* restrict const input_buf,
+    const double complex* restrict const complex_buf,
+    double complex* restrict const transform_buf)
+{
+    const long num_samples = plan->num_samples;
+    const struct conv_kernel* const entry = plan->conv;
+    double complex* const a = plan->scratch;
+
+    // 1. Modulate the input by the chirp and zero pad
+    for (size_t n=0; n<num_samples; n++)
+        a[n] = input_sample(input_buf, complex_buf, n)*entry->chirp[n];
+    for (size_t n=num_samples; n<entry->conv_samples; n++)
+        a[n] = 0;
+
+    // 2. Convolve with the conjugate chirp
+    conv_apply(entry, a, &plan->scratch[entry->conv_samples]);
+
+    // 3. Demodulate the result
+    for (size_t k=0; k<num_samples; k++) {
+        transform_buf[k] = entry->chirp[k]*a[k];
+        verbose("X(%zd) = %+.16lf%+.16lfj\n", k, creal(transform_buf[k]), cimag(transform_buf[k]));
+    }
+}
+
+/* Rader FFT implementation
+ * For prime N, the indices 1..N-1 are a cyclic group generated by g, so with
+ * n = g^q and k = g^(-m) the DFT becomes a cyclic convolution of length N-1:
+ *   X₀ = Σ x[n]
+ *   X(g^(-m)) = x₀ + Σ x[g^q] * e^(-i2π*g^(q-m)/N)
+ * The convolution is computed with the radix-2 or mixed-radix FFT, so when
+ * N-1 is smooth there is no zero padding as with fft_bluestein().
+ * The input is read from complex_buf if it is not NULL, otherwise from the
+ * real samples in input_buf.
+ *
+ * Note: the input buffers are not modified, plan->scratch is overwritten
+ */
+void fft_rader(const struct fft_plan* const plan,
+    const double* restrict const input_buf,
+    const double complex* restrict const complex_buf,
+    double complex* restrict const transform_buf)
+{
+    const long num_samples = plan->num_samples;
+    const struct conv_kernel* const entry = plan->conv;
+    const long conv_samples = num_samples-1;
+    double complex* const a = plan->scratch;
+    const double complex x0 = input_sample(input_buf, complex_buf, 0);
+    double complex sum = x0;
+
+    // 1. Permute the input into generator order
+    for (long q=0; q<conv_samples; q++) {
+        a[q] = input_sample(input_buf, complex_buf, entry->perm[q]);
+        sum += a[q];
+    }
+
+    // 2. Convolve with the permuted twiddle factors
+    conv_apply(entry, a, &plan->scratch[conv_samples]);
+
+    // 3. Scatter the result into the inverse generator order
+    transform_buf[0] = sum;
+    for (long m=0; m<conv_samples; m++) {
+        size_t k = entry->perm[(conv_samples-m) % conv_samples];
+        transform_buf[k] = x0 + a[m];
+        verbose("X(%zd) = %+.16lf%+.16lfj\n", k, creal(transform_buf[k]), cimag(transform_buf[k]));
+    }
+}
+
+/* modular inverse of a modulo m, a and m must be coprime */
+long modinv(long a, long m)
+{
+    long t = 0, new_t = 1;
+    long r = m, new_r = a % m;
+
+    //extended Euclidean algorithm
+    while (0 != new_r) {
+        long q = r/new_r;
+        long tmp;
+
+        tmp = t - q*new_t;
+        t = new_t;
+        new_t = tmp;
+
+        tmp = r - q*new_r;
+        r = new_r;
+        new_r = tmp;
+    }
+
+    return (t < 0) ? (t + m) : t;
+}
+
+/* Prime Factor Setup
+ * Acquires the plans of the two coprime factors N1 x N2 = N from pfa_split()
+ * for the column and row transforms of fft_pfa(), except for columns with a
+ * Winograd module, and allocates the plan's scratch for the N1 x N2 matrix,
+ * a column and its transform, and a row transform: N + 2*N1 + N2 entries.
+ * The factors are planned with FFT_ESTIMATE, like the convolutions.
+ * Returns false on allocation failure.
+ */
+bool pfa_init(struct fft_plan* const plan)
+{
+    const long num_samples = plan->num_samples;
+    const long n1 = pfa_split(num_samples);
+    const long n2 = num_samples/n1;
+    const size_t scratch_samples = num_samples + 2*n1 + n2;
+    bool ok = true;
+
+    assert(0 < n1);
+
+    if (!winograd_supported(n1)) {
+        plan->sub[0] = fft_plan_acquire(n1, FFT_LAYOUT_REAL, FFT_ESTIMATE);
+        ok = (NULL != plan->sub[0]);
+    }
+    if (ok) {
+        plan->sub[1] = fft_plan_acquire(n2, FFT_LAYOUT_REAL, FFT_ESTIMATE);
+        ok = (NULL != plan->sub[1]);
+    }
+    if (ok && memory_check(scratch_samples, sizeof(*plan->scratch),
+        "prime factor work buffer")) {
+        plan->scratch = malloc(scratch_samples * sizeof(*plan->scratch));
+    }
+    ok = ok && (NULL != plan->scratch);
+
+    if (ok)
+        plan->bytes += scratch_samples * sizeof(*plan->scratch);
+    else
+        error("Error allocating prime factor plan for %ld samples\n", num_samples);
+
+    return ok;
+}
+
+/* Prime Factor FFT implementation (Good-Thomas)
+ * For N = N1*N2 with N1 and N2 coprime, the index maps
+ *   n = (N2*n1 + N1*n2) mod N
+ *   k = (N2*(N2⁻¹ mod N1)*k1 + N1*(N1⁻¹ mod N2)*k2) mod N
+ * turn the DFT into a two dimensional N1 x N2 DFT:
+ *   X(k1,k2) = Σ Σ x(n1,n2) * e^(-i2πn1k1/N1) * e^(-i2πn2k2/N2)
+ * with no twiddle factors between the column and row transforms.
+ * Columns with a Winograd module are computed directly with winograd_dft(),
+ * other sizes (and all rows) with the plans of the factors from pfa_init(),
+ * so a row of coprime factors is split again.
+ * The input is read from complex_buf if it is not NULL, otherwise from the
+ * real samples in input_buf.
+ *
+ * Note: the input buffers are not modified, plan->scratch is overwritten
+ */
+void fft_pfa(const struct fft_plan* const plan,
+    const double* restrict const input_buf,
+    const double complex* restrict const complex_buf,
+    double complex* restrict const transform_buf)
+{
+    const long num_samples = plan->num_samples;
+    const long n1 = pfa_split(num_samples);
+    const long n2 = num_samples/n1;
+    const size_t k1_step = mulmod(n2, modinv(n2, n1), num_samples);
+    const size_t k2_step = mulmod(n1, modinv(n1, n2), num_samples);
+    double complex* const work = plan->scratch; //N1 x N2 matrix
+    double complex* const col = &work[num_samples]; //2*N1 column input and output
+    double complex* const row = &col[2*n1]; //N2 row output
+
+    verbose("PFA: %ld samples = %ld x %ld\n", num_samples, n1, n2);
+
+    // 1. Gather the input into the N1 x N2 matrix
+    for (size_t i1=0; i1<n1; i1++) {
+        size_t n = (n2*i1) % num_samples;
+        for (size_t i2=0; i2<n2; i2++) {
+            work[i1*n2 + i2] = input_sample(input_buf, complex_buf, n);
+            n += n1;
+            if (n >= num_samples)
+                n -= num_samples;
+        }
+    }
+
+    // 2. Transform the columns
+    for (size_t i2=0; i2<n2; i2++) {
+        for (size_t i1=0; i1<n1; i1++)
+            col[i1] = work[i1*n2 + i2];
+
+        if (NULL == plan->sub[0]) {
+            winograd_dft(n1, col);
+            for (size_t k1=0; k1<n1; k1++)
+                work[k1*n2 + i2] = col[k1];
+        } else {
+            fft_algorithm_execute(plan->sub[0], NULL, col, &col[n1]);
+            for (size_t k1=0; k1<n1; k1++)
+                work[k1*n2 + i2] = col[n1 + k1];
+        }
+    }
+
+    // 3. Transform the rows and scatter them into the output order
+    for (size_t k1=0; k1<n1; k1++) {
+        size_t k = mulmod(k1_step, k1, num_samples);
+
+        fft_algorithm_execute(plan->sub[1], NULL, &work[k1*n2], row);
+        for (size_t k2=0; k2<n2; k2++) {
+            transform_buf[k] = row[k2];
+            verbose("X(%zd) = %+.16lf%+.16lfj\n", k, creal(transform_buf[k]), cimag(transform_buf[k]));
+            k += k2_step;
+            if (k >= num_samples)
+                k -= num_samples;
+        }
+    }
+}
+
+/* FFT algorithm execution
+ * Out-of-place FFT with a plan of any algorithm, for real or complex input.
+ * Radix-2 plans of complex samples use fft_tables_complex() if the plan has
+ * the tables, otherwise fft_complex() on a copy.
+ * The input is read from complex_buf if it is not NULL, otherwise from the
+ * real samples in input_buf.
+ *
+ * Note: the input buffers are not modified
+ * Returns false on failure.
+ */
+bool fft_algorithm_execute(const struct fft_plan* const plan,
+    const double* restrict const input_buf,
+    const double complex* restrict const complex_buf,
+    double complex* restrict const transform_buf)
+{
+    const long num_samples = plan->num_samples;
+
+    switch (plan->algorithm) {
+        case FFT_RADIX2:
+            if ((NULL != complex_buf) && (FFT_ENGINE_TABLES == plan->engine)) {
+                fft_tables_complex(plan, complex_buf, transform_buf,
+                    FFT_FORWARD, 1.0);
+                return true;
+            }
+            for (size_t i=0; i<num_samples; i++)
+                transform_buf[i] = input_sample(input_buf, complex_buf, i);
+            fft_complex(num_samples, transform_buf);
+            return true;
+
+        case FFT_MIXED_RADIX:
+            fft_mixed_radix(plan, input_buf, complex_buf, 1, transform_buf);
+            return true;
+
+        case FFT_RADER:
+            fft_rader(plan, input_buf, complex_buf, transform_buf);
+            return true;
+
+        case FFT_PFA:
+            fft_pfa(plan, input_buf, complex_buf, transform_buf);
+            return true;
+
+        case FFT_BLUESTEIN:
+            fft_bluestein(plan, input_buf, complex_buf, transform_buf);
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+/* FFT dispatch
+ * Out-of-place FFT of any supported size with the cached plan for the -p
+ * planner, see fft_algorithm_execute().
+ * The input is read from complex_buf if it is not NULL, otherwise from the
+ * real samples in input_buf.
+ *
+ * Note: the input buffers are not modified
+ * Returns false on failure.
+ */
+bool fft_dispatch(long num_samples, const double* restrict const input_buf,
+    const double complex* restrict const complex_buf,
+    double complex* restrict const transform_buf)
+{
+    struct fft_plan* const plan = fft_plan_acquire(num_samples,
+        FFT_LAYOUT_REAL, option_planner);
+    bool ok;
+
+    if (NULL == plan)
+        return false;
+    ok = fft_algorithm_execute(plan, input_buf, complex_buf, transform_buf);
+    fft_plan_release(plan);
+
+    return ok;
+}
+
+/* check whether fft_plan_create() is able to process num_samples */
+bool fft_supported(long num_samples)
+{
+    return (FFT_UNSUPPORTED != fft_plan_algorithm(num_samples));
+}
+
+/* wake up one (or, if all is true, every) idle thread of fft_recursive_job() */
+static void recursive_job_wake(struct recursive_job* const job, bool all)
+{
+    pthread_mutex_lock(&job->lock);
+    if (all)
+        pthread_cond_broadcast(&job->wake);
+    else
+        pthread_cond_signal(&job->wake);
+    pthread_mutex_unlock(&job->lock);
+}
+
+/* push task onto the bottom of the deque of its owner and wake up a thief */
+static void task_push(struct recursive_job* const job,
+    struct task_deque* const deque, size_t task)
+{
+    pthread_mutex_lock(&deque->lock);
+    deque->tasks[deque->bottom++] = task;
+    __atomic_add_fetch(&job->queued, 1, __ATOMIC_RELEASE);
+    pthread_mutex_unlock(&deque->lock);
+
+    recursive_job_wake(job, false);
+}
+
+/* pop the newest task from the bottom (owner) or steal the oldest one from
+   the top (thief) of deque into task, return false if it is empty */
+static bool task_take(struct recursive_job* const job,
+    struct task_deque* const deque, bool steal, size_t* const task)
+{
+    bool found;
+
+    pthread_mutex_lock(&deque->lock);
+    found = (deque->top < deque->bottom);
+    if (found && steal)
+        *task = deque->tasks[deque->top++];
+    else if (found)
+        *task = deque->tasks[--deque->bottom];
+    if (found)
+        __atomic_sub_fetch(&job->queued, 1, __ATOMIC_RELEASE);
+    pthread_mutex_unlock(&deque->lock);
+
+    return found;
+}
+
+/* Recursive Task Done
+ * Joins task i into its parent: the last of the two forked tasks to finish
+ * runs the merge of the parent, and so on up the tree, so no thread ever
+ * blocks waiting for a join. The root sets job->done.
+ */
+static void recursive_task_done(struct recursive_job* const job, size_t i)
+{
+    while (0 != i) {
+        const size_t parent = (i - 1)/2;
+        struct recursive_task* const task = &job->tasks[parent];
+
+        if (0 != __atomic_sub_fetch(&task->pending, 1, __ATOMIC_ACQ_REL))
+            return;
+        fft_recursive_merge(task->depth, task->num_samples,
+            task->transform_buf, job->precomputed);
+        i = parent;
+    }
+
+    __atomic_store_n(&job->done, 1, __ATOMIC_RELEASE);
+    recursive_job_wake(job, true);
+}
+
+/* Recursive Task Run
+ * Runs task i: below the cutoff depth the subproblem is computed serially by
+ * fft_recursive(), otherwise its even and odd fields are forked onto the
+ * deque of the running thread, the even one on the bottom to run next.
+ */
+static void recursive_task_run(struct recursive_job* const job, size_t i,
+    struct task_deque* const deque)
+{
+    const struct recursive_task* const task = &job->tasks[i];
+
+    if (task->depth == job->cutoff) {
+        fft_recursive(task->depth, task->num_samples, task->input_buf,
+            task->stride, task->transform_buf, job->precomputed);
+        recursive_task_done(job, i);
+    } else {
+        const long half_samples = task->num_samples/2;
+
+        for (size_t c=0; c<2; c++) {
+            struct recursive_task* const child = &job->tasks[2*i + 1 + c];
+
+            child->depth = task->depth + 1;
+            child->num_samples = half_samples;
+            child->input_buf = &task->input_buf[c*task->stride];
+            child->stride = 2*task->stride;
+            child->transform_buf = &task->transform_buf[c*half_samples];
+            child->pending = 2;
+        }
+        task_push(job, deque, 2*i + 2);
+        task_push(job, deque, 2*i + 1);
+    }
+}
+
+/* Recursive FFT Job
+ * Share index of count of fft_recursive_parallel() on the thread pool: runs
+ * the tasks of its own deque depth first and, when it is empty, steals the
+ * oldest (largest) task of another thread, until the root task is done.
+ * A thread that finds nothing to run or steal sleeps on job->wake until a
+ * task is pushed or the root task is done, rather than spinning.
+ */
+static void fft_recursive_job(void* arg, size_t index, size_t count)
+{
+    struct recursive_job* const job = arg;
+    struct task_deque* const own = &job->deques[index];
+
+    if (0 == index)
+        task_push(job, own, 0);
+
+    while (!__atomic_load_n(&job->done, __ATOMIC_ACQUIRE)) {
+        size_t task;
+        bool found = task_take(job, own, false, &task);
+
+        for (size_t v=1; (v<count) && !found; v++)
+            found = task_take(job, &job->deques[(index + v) % count], true,
+                &task);
+
+        if (found) {
+            recursive_task_run(job, task, own);
+            continue;
+        }
+
+        //task_push() and recursive_task_done() signal under job->lock, so
+        //a task or done that is published after the check is not missed
+        pthread_mutex_lock(&job->lock);
+        while ((0 == __atomic_load_n(&job->queued, __ATOMIC_ACQUIRE)) &&
+            !__atomic_load_n(&job->done, __ATOMIC_ACQUIRE))
+            pthread_cond_wait(&job->wake, &job->lock);
+        pthread_mutex_unlock(&job->lock);
+    }
+}
+
+/* Parallel Recursive FFT
+ * fft_recursive() as a fork-join tree on the thread pool: each task forks
+ * its even and odd fields as two tasks onto a work-stealing deque, down to
+ * the cutoff depth where there are RECURSIVE_TASKS_PER_THREAD tasks per
+ * thread (or RECURSIVE_MIN_TASK_SAMPLES samples per task), which run
+ * serially. Each thread works depth first on its own tasks, so it keeps the
+ * cache locality of the serial recursion, and idle threads steal the largest
+ * pending tasks. Sample n is input_buf[n*stride], as for fft_recursive().
+ * Returns false on allocation failure.
+ */
+bool fft_recursive_parallel(long num_samples,
+    const double* restrict const input_buf, size_t stride,
+    double complex* restrict const transform_buf, const bool precomputed)
+{
+    const size_t count = thread_pool.num_threads;
+    struct recursive_job job = {0};
+    size_t num_tasks;
+    bool ok;
+
+    while (((num_samples >> job.cutoff) > RECURSIVE_MIN_TASK_SAMPLES) &&
+        (((size_t)1U << job.cutoff) < (RECURSIVE_TASKS_PER_THREAD * count)))
+        job.cutoff++;
+    num_tasks = ((size_t)2U << job.cutoff) - 1;
+
+    job.precomputed = precomputed;
+    pthread_mutex_init(&job.lock, NULL);
+    pthread_cond_init(&job.wake, NULL);
+    job.tasks = malloc(num_tasks * sizeof(*job.tasks));
+    job.deques = calloc(count, sizeof(*job.deques));
+    ok = (NULL != job.tasks) && (NULL != job.deques);
+    for (size_t t=0; (t<count) && (NULL != job.deques); t++) {
+        pthread_mutex_init(&job.deques[t].lock, NULL);
+        job.deques[t].tasks = malloc(num_tasks * sizeof(*job.deques[t].tasks));
+        ok = ok && (NULL != job.deques[t].tasks);
+    }
+
+    if (ok) {
+        job.tasks[0] = (struct recursive_task){0, num_samples, input_buf,
+            stride, transform_buf, 2};
+        verbose("Parallel recursive FFT: %zd tasks of %ld samples\n", (num_tasks + 1)/2, num_samples >> job.cutoff);
+        thread_pool_run(fft_recursive_job, &job);
+    } else {
+        error("Error allocating the tasks of the parallel recursive FFT\n");
+    }
+
+    for (size_t t=0; (t<count) && (NULL != job.deques); t++) {
+        free(job.deques[t].tasks);
+        pthread_mutex_destroy(&job.deques[t].lock);
+    }
+    free(job.deques);
+    free(job.tasks);
+    pthread_cond_destroy(&job.wake);
+    pthread_mutex_destroy(&job.lock);
+
+    return ok;
+}
+
+/* FFT Plan Execution (strided)
+ * FFT of the real samples input_buf[0], input_buf[stride], input_buf[2*stride],
+ * ... into transform_buf using the algorithm and engine chosen by
+ * fft_plan_create().
+ * All engines are out-of-place and only read input_buf, each with the stride:
+ * - the iterative engines read it into transform_buf in bit-reversed order
+ *   with shuffle_copy() and then call fft_inner() in-place on transform_buf
+ * - the recursive engines read the even/odd fields with twice the stride
+ * - the tables engine gathers each leaf through the bit-reverse table
+ * - the mixed-radix engine and algorithm read it in digit-reversed order
+ * Bluestein, Rader and PFA plans read their input through
+ * fft_algorithm_execute(), which is shared with the contiguous complex
+ * transforms of their convolutions and factors, so stride must be 1.
+ *
+ * Note: transform_buf must already be allocated and can not be NULL and
+ *       cannot overlap with input_buf
+ * Returns false on failure.
+ */
+static bool fft_plan_execute_strided(const struct fft_plan* const plan,
+    const double* restrict const input_buf, size_t stride,
+    double complex* restrict const transform_buf)
+{
+    const long num_samples = plan->num_samples;
+    bool precomputed = false;
+
+    assert(NULL != input_buf);
+    assert(NULL != transform_buf);
+    assert(0 < stride);
+
+    if (FFT_MIXED_RADIX == plan->algorithm) {
+        fft_mixed_radix(plan, input_buf, NULL, stride, transform_buf);
+        return true;
+    }
+    if (FFT_RADIX2 != plan->algorithm) {
+        assert(1 == stride);
+        return fft_algorithm_execute(plan, input_buf, NULL, transform_buf);
+    }
+
+    switch (plan->engine) {
+        case FFT_ENGINE_TABLES:
+            fft_tables_execute(plan, input_buf, stride, transform_buf);
+            break;
+
+        case FFT_ENGINE_ITERATIVE_PRECOMPUTED:
+            precomputed = true;
+            /* intentional fall-through */
+        case FFT_ENGINE_ITERATIVE:
+            // 1. read the input_buf into the transform_buf in bit-reversed
+            //    order in O(n) time rather than O(nlog(n))
+            shuffle_copy(num_samples, input_buf, stride, transform_buf);
+
+            // 2. Iteratively compute the FFT
+            fft_inner(num_samples, transform_buf, precomputed);
+            break;
+
+        case FFT_ENGINE_SPLIT:
+        case FFT_ENGINE_DUP:
+        case FFT_ENGINE_RADIX4:
+            shuffle_copy(num_samples, input_buf, stride, transform_buf);
+            fft_layout_inner(num_samples, transform_buf, plan->engine);
+            break;
+
+        case FFT_ENGINE_RECURSIVE_PRECOMPUTED:
+            precomputed = true;
+            /* intentional fall-through */
+        case FFT_ENGINE_RECURSIVE:
+            // Recursively compute the FFT, the leaves read the even/odd
+            // fields of input_buf with a stride rather than a shuffled copy
+            if ((option_threads > 1) &&
+                (num_samples >= PARALLEL_MIN_SAMPLES) &&
+                thread_pool_acquire(option_threads)) {
+                const bool ok = fft_recursive_parallel(num_samples,
+                    input_buf, stride, transform_buf, precomputed);
+
+                thread_pool_release();
+                return ok;
+            }
+            fft_recursive(0, num_samples, input_buf, stride, transform_buf,
+                precomputed);
+            break;
+
+        case FFT_ENGINE_MIXED_RADIX:
+            fft_mixed_radix(plan, input_buf, NULL, stride, transform_buf);
+            break;
+    }
+
+    return true;
+}
+
+/* FFT Plan Execution
+ * FFT of the num_samples contiguous real samples in input_buf into
+ * transform_buf, see fft_plan_execute_strided().
+ *
+ * Note: transform_buf must already be allocated and can not be NULL and
+ *       cannot overlap with input_buf
+ * Note: input_buf is not modified, so it can be transformed repeatedly
+ * Returns false on failure.
+ */
+bool fft_plan_execute(const struct fft_plan* const plan,
+    const double* restrict const input_buf,
+    double complex* restrict const transform_buf)
+{
+    return fft_plan_execute_strided(plan, input_buf, 1, transform_buf);
+}
+
+/* FFT Plan Execution (batch)
+ * FFTs of howmany real signals of plan->num_samples each with one plan, in
+ * the spirit of the FFTW advanced interface: sample n of signal t is
+ *   input_buf[t*dist + n*stride]
+ * and its spectrum is transform_buf[t*num_samples .. (t+1)*num_samples).
+ * Contiguous signals have stride 1 and dist num_samples, interleaved
+ * channels have stride howmany and dist 1.
+ * The tables engine runs the batch with fft_tables_batch(). The other radix-2
+ * engines and the mixed-radix plans run fft_plan_execute_strided() on each
+ * signal in place. Only Bluestein, Rader and PFA plans, which need contiguous
+ * input, gather a strided signal into a buffer first; their convolutions and
+ * sub-transforms cost far more than the copy.
+ *
+ * Note: transform_buf must hold howmany*num_samples bins and cannot overlap
+ *       with input_buf
+ * Returns false on failure.
+ */
+bool fft_plan_execute_batch(const struct fft_plan* const plan,
+    size_t howmany, const double* restrict const input_buf, size_t stride,
+    size_t dist, double complex* restrict const transform_buf)
+{
+    const size_t num_samples = plan->num_samples;
+    const bool strided = (FFT_RADIX2 == plan->algorithm) ||
+        (FFT_MIXED_RADIX == plan->algorithm);
+    double* gather = NULL;
+    bool ok = true;
+
+    assert(NULL != input_buf);
+    assert(NULL != transform_buf);
+    assert(0 < stride);
+
+    if ((FFT_RADIX2 == plan->algorithm) &&
+        (FFT_ENGINE_TABLES == plan->engine)) {
+        fft_tables_batch(plan, howmany, input_buf, stride, dist,
+            transform_buf);
+        return true;
+    }
+
+    if ((1 != stride) && !strided) {
+        gather = malloc(num_samples * sizeof(*gather));
+        if (NULL == gather)
+            return false;
+    }
+
+    for (size_t t=0; (t<howmany) && ok; t++) {
+        const double* in = &input_buf[t*dist];
+        size_t in_stride = stride;
+
+        if (NULL != gather) {
+            for (size_t n=0; n<num_samples; n++)
+                gather[n] = in[n*stride];
+            in = gather;
+            in_stride = 1;
+        }
+        ok = fft_plan_execute_strided(plan, in, in_stride,
+            &transform_buf[t*num_samples]);
+    }
+
+    free(gather);
+
+    return ok;
+}
+
+/* Real FFT (in-place, packed)
+ * FFT of the num_samples real samples in buf, overwritten with the packed
+ * half spectrum in the "perm" layout, i.e. the CCS format without the two
+ * imaginary parts that are always 0:
+ *   buf[0] = Re X(0), buf[1] = Re X(N/2),
+ *   buf[2k] = Re X(k), buf[2k+1] = Im X(k) for 0 < k < N/2
+ * The other bins follow from X(N-k) = conj(X(k)).
+ * The even and odd samples are transformed together as the N/2 complex
+ * samples z(n) = x(2n) + i·x(2n+1), whose spectrum Z holds the spectra E and O
+ * of the even and odd samples:
+ *   E(k) = (Z(k) + conj(Z(N/2-k)))/2,  O(k) = -i·(Z(k) - conj(Z(N/2-k)))/2
+ *   X(k) = E(k) + e^(-i2πk/N)·O(k),  X(N/2-k) = conj(E(k) - e^(-i2πk/N)·O(k))
+ * so bins k and N/2-k are computed together in place. The half size FFT uses
+ * the cached complex plan and the twiddle factors are streamed by
+ * twiddle_gen_next(), so no buffer of the transform size is needed.
+ * Returns false if num_samples is not a power of 2 or on allocation failure.
+ */
+bool fft_real_inplace(long num_samples, double* const buf)
+{
+    const size_t half_n = num_samples/2;
+    double complex* const z = (double complex*)buf;
+    struct fft_plan* plan;
+    struct twiddle_gen gen;
+    double z0r, z0i;
+
+    assert(NULL != buf);
+
+    if ((num_samples < 1) || !ispowerof2(num_samples))
+        return false;
+    if (1 == num_samples)
+        return true;
+
+    plan = fft_plan_acquire(half_n, FFT_LAYOUT_COMPLEX, option_planner);
+    if (NULL == plan)
+        return false;
+    fft_plan_execute_complex(plan, z, z);
+    fft_plan_release(plan);
+
+    //X(0) = E(0) + O(0) and X(N/2) = E(0) - O(0) are both real
+    z0r = creal(z[0]);
+    z0i = cimag(z[0]);
+    buf[0] = z0r + z0i;
+    buf[1] = z0r - z0i;
+
+    twiddle_gen_init(&gen, num_samples);
+    twiddle_gen_reset(&gen);
+    for (size_t k=1; k<=(half_n/2); k++) {
+        const size_t j = half_n - k;
+        const double complex w = twiddle_gen_next(&gen);
+        const double complex a = z[k];
+        const double complex b = conj(z[j]);
+        const double complex e = (a + b)/2;
+        const double complex o = mul_twiddle(mul_neg_i(a - b)/2,
+            creal(w), -cimag(w));
+
+        z[j] = conj(e - o);
+        z[k] = e + o;
+    }
+
+    return true;
+}
+
+/* Two Real FFTs in One
+ * FFTs of the two real signals x and y of num_samples each, read with the
+ * given stride, into X and Y using a single complex FFT of
+ * z(n) = x(n) + i·y(n). The conjugate symmetry of the real spectra separates
+ * them in one pass over Z, bins k and N-k together:
+ *   X(k) = (Z(k) + conj(Z(N-k)))/2,  Y(k) = -i·(Z(k) - conj(Z(N-k)))/2
+ * Power of 2 sizes use the cached complex plan, other sizes fft_dispatch().
+ *
+ * Note: x and y may be interleaved channels of one buffer (x = buf,
+ *       y = buf+1, stride 2), X and Y must not overlap with them or each other
+ * Returns false on failure.
+ */
+bool fft_two_real(long num_samples, const double* const x,
+    const double* const y, size_t stride, double complex* restrict const X,
+    double complex* restrict const Y)
+{
+    assert((NULL != x) && (NULL != y) && (NULL != X) && (NULL != Y));
+    assert(0 < num_samples);
+
+    //pack the signals into Y, used as the input of the complex FFT
+    for (size_t n=0; n<num_samples; n++)
+        Y[n] = CMPLX(x[n*stride], y[n*stride]);
+
+    if (ispowerof2(num_samples)) {
+        struct fft_plan* const plan = fft_plan_acquire(num_samples,
+            FFT_LAYOUT_COMPLEX, option_planner);
+        if (NULL == plan)
+            return false;
+        fft_plan_execute_complex(plan, Y, X);
+        fft_plan_release(plan);
+    } else if (!fft_dispatch(num_samples, NULL, Y, X)) {
+        return false;
+    }
+
+    //X holds Z, separate the spectra
+    Y[0] = CMPLX(cimag(X[0]), 0);
+    X[0] = CMPLX(creal(X[0]), 0);
+    for (size_t k=1; k<=(num_samples/2); k++) {
+        const size_t j = num_samples - k;
+        const double complex a = X[k];
+        const double complex b = conj(X[j]);
+
+        X[k] = (a + b)/2;
+        Y[k] = mul_neg_i(a - b)/2;
+        X[j] = conj(X[k]);
+        Y[j] = conj(Y[k]);
+    }
+
+    return true;
+}
+
+/* Inverse FFT
+ * Inverse FFT of the num_samples complex bins in into out:
+ *   x(n) = Σ X(k)*e^(i2πnk/N), times 1/N if normalize is true
+ * Power of 2 sizes run the cached complex plan backward, reusing the forward
+ * tables, with the normalization fused into the last stage. Other sizes use
+ * IDFT(X)(n) = DFT(X)(-n mod N) with fft_dispatch(), reversing the bins and
+ * normalizing in one pass.
+ *
+ * Note: in and out must not overlap
+ * Returns false on failure.
+ */
+bool fft_inverse(long num_samples, const double complex* restrict const in,
+    double complex* restrict const out, bool normalize)
+{
+    const double scale = normalize ? (1.0/num_samples) : 1.0;
+
+    assert((NULL != in) && (NULL != out));
+    assert(0 < num_samples);
+
+    if (ispowerof2(num_samples)) {
+        struct fft_plan* const plan = fft_plan_acquire(num_samples,
+            FFT_LAYOUT_COMPLEX, option_planner);
+        if (NULL == plan)
+            return false;
+        fft_plan_execute_inverse(plan, in, out, normalize);
+        fft_plan_release(plan);
+        return true;
+    }
+
+    if (!fft_dispatch(num_samples, NULL, in, out))
+        return false;
+
+    out[0] *= scale;
+    for (size_t n=1; n<=(num_samples/2); n++) {
+        const size_t j = num_samples - n;
+        const double complex t = out[n];
+
+        out[n] = out[j]*scale;
+        if (j != n)
+            out[j] = t*scale;
+    }
+
+    return true;
+}
+
+/* Inverse Real FFT (in-place, packed)
+ * Inverse of fft_real_inplace(): overwrites the packed half spectrum in buf,
+ * in the same "perm" layout, with the num_samples real samples
+ *   x(n) = Σ X(k)*e^(i2πnk/N), times 1/N if normalize is true
+ * The spectra of the even and odd samples are recombined into
+ *   Z(k) = E(k) + i·O(k), E(k) = X(k) + conj(X(N/2-k)),
+ *   O(k) = (X(k) - conj(X(N/2-k)))*e^(i2πk/N)
+ * (twice the forward E and O) for bins k and N/2-k together, and the inverse
+ * complex FFT of Z gives z(n) = x(2n) + i·x(2n+1) in place. It runs the
+ * cached forward plan of N/2 backward with the normalization fused.
+ * Returns false if num_samples is not a power of 2 or on allocation failure.
+ */
+bool fft_c2r_inplace(long num_samples, double* const buf, bool normalize)
+{
+    const size_t half_n = num_samples/2;
+    double complex* const z = (double complex*)buf;
+    struct fft_plan* plan;
+    struct twiddle_gen gen;
+    double x0, xh;
+
+    assert(NULL != buf);
+
+    if ((num_samples < 1) || !ispowerof2(num_samples))
+        return false;
+    if (1 == num_samples)
+        return true;
+
+    //X(0) and X(N/2) are both real
+    x0 = buf[0];
+    xh = buf[1];
+    z[0] = CMPLX(x0 + xh, x0 - xh);
+
+    twiddle_gen_init(&gen, num_samples);
+    twiddle_gen_reset(&gen);
+    for (size_t k=1; k<=(half_n/2); k++) {
+        const size_t j = half_n - k;
+        const double complex w = twiddle_gen_next(&gen);
+        const double complex a = z[k];
+        const double complex b = conj(z[j]);
+        const double complex e = a + b;
+        //multiply by conj(w) = e^(i2πk/N)
+        const double complex o = mul_twiddle(a - b, creal(w), cimag(w));
+
+        //E(N/2-k) = conj(E(k)) and O(N/2-k) = conj(O(k))
+        z[j] = conj(e) - mul_neg_i(conj(o));
+        z[k] = e - mul_neg_i(o);
+    }
+
+    plan = fft_plan_acquire(half_n, FFT_LAYOUT_COMPLEX, option_planner);
+    if (NULL == plan)
+        return false;
+    fft_tables_complex(plan, z, z, FFT_BACKWARD,
+        normalize ? (1.0/num_samples) : 1.0);
+    fft_plan_release(plan);
+
+    return true;
+}
+
+/* power of 2 engine chosen by the FFT_ESTIMATE planner, following cfg.h */
+enum fft_engine fft_estimate_engine(long num_samples)
+{
+#if defined(FEATURE_FFT_PLAN)
+    return FFT_ENGINE_TABLES;
+#elif defined(FEATURE_NONRECURSIVE)
+    return default_precomputed(num_samples) ?
+        FFT_ENGINE_ITERATIVE_PRECOMPUTED : FFT_ENGINE_ITERATIVE;
+#else
+    return default_precomputed(num_samples) ?
+        FFT_ENGINE_RECURSIVE_PRECOMPUTED : FFT_ENGINE_RECURSIVE;
+#endif
+}
+
+/* Planner Candidates
+ * Lists the choices the FFT_MEASURE planner times for num_samples and returns
+ * how many there are (at most MAX_CANDIDATES):
+ * - powers of 2: the tables engine with each Winograd leaf size, the
+ *   iterative and recursive engines with runtime and (if N fits in
+ *   twiddle.h) precomputed twiddle factors, the engines for the twiddle.h
+ *   layouts that twiddle.py emitted, and the mixed-radix engine
+ * - other sizes: each algorithm that applies to num_samples, Bluestein's
+ *   applies to all of them
+ */
+size_t fft_plan_candidates(long num_samples,
+    struct fft_plan candidates[MAX_CANDIDATES])
+{
+    int radices[MAX_FACTORS];
+    size_t count = 0;
+
+    memset(candidates, 0, MAX_CANDIDATES * sizeof(*candidates));
+
+#define add_candidate(alg, eng, lf) \
+    do { \
+        candidates[count].algorithm = (alg); \
+        candidates[count].engine = (eng); \
+        candidates[count].leaf = (lf); \
+        count++; \
+    } while(0)
+
+    if (ispowerof2(num_samples)) {
+        for (size_t leaf=2; leaf<=MAX_LEAF; leaf*=2) {
+            add_candidate(FFT_RADIX2, FFT_ENGINE_TABLES,
+                ((size_t)num_samples < leaf) ? (size_t)num_samples : leaf);
+            if ((size_t)num_samples <= leaf)
+/*BREAK*/       break;
+        }
+        add_candidate(FFT_RADIX2, FFT_ENGINE_ITERATIVE, 0);
+        add_candidate(FFT_RADIX2, FFT_ENGINE_RECURSIVE, 0);
+        if (num_samples <= TWIDDLE_MAX_SAMPLES) {
+            add_candidate(FFT_RADIX2, FFT_ENGINE_ITERATIVE_PRECOMPUTED, 0);
+            add_candidate(FFT_RADIX2, FFT_ENGINE_RECURSIVE_PRECOMPUTED, 0);
+#ifdef TWIDDLE_LAYOUT_SPLIT
+            add_candidate(FFT_RADIX2, FFT_ENGINE_SPLIT, 0);
+#endif
+#ifdef TWIDDLE_LAYOUT_DUP
+            add_candidate(FFT_RADIX2, FFT_ENGINE_DUP, 0);
+#endif
+#ifdef TWIDDLE_LAYOUT_RADIX4
+            add_candidate(FFT_RADIX2, FFT_ENGINE_RADIX4, 0);
+#endif
+        }
+        if (num_samples > 1)
+            add_candidate(FFT_RADIX2, FFT_ENGINE_MIXED_RADIX, 0);
+    } else {
+        if (0 < factorize(num_samples, radices))
+            add_candidate(FFT_MIXED_RADIX, 0, 0);
+        if (isprime(num_samples) && (0 < factorize(num_samples-1, radices)))
+            add_candidate(FFT_RADER, 0, 0);
+        if (0 < pfa_split(num_samples))
+            add_candidate(FFT_PFA, 0, 0);
+        add_candidate(FFT_BLUESTEIN, 0, 0);
+    }
+
+#undef add_candidate
+
+    return count;
+}
+
+/* seconds per execution of plan, the best of MEASURE_ROUNDS timings */
+double fft_plan_time(const struct fft_plan* const plan,
+    const double* const input_buf, double complex* const transform_buf)
+{
+    double best = HUGE_VAL;
+
+    //warm up the caches before timing
+    if (!fft_plan_execute(plan, input_buf, transform_buf))
+        return HUGE_VAL;
+
+    for (int round=0; round<MEASURE_ROUNDS; round++) {
+        size_t reps = 1;
+        double elapsed = 0;
+
+        //double the repetitions until the clock resolution does not matter
+        while (true) {
+            struct timespec start, stop;
+
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            for (size_t r=0; r<reps; r++)
+                fft_plan_execute(plan, input_buf, transform_buf);
+            clock_gettime(CLOCK_MONOTONIC, &stop);
+
+            elapsed = (stop.tv_sec - start.tv_sec) +
+                (stop.tv_nsec - start.tv_nsec)*1e-9;
+            if (elapsed >= MEASURE_MIN_TIME)
+/*BREAK*/       break;
+            reps *= 2;
+        }
+
+        if (elapsed/reps < best)
+            best = elapsed/reps;
+    }
+
+    return best;
+}
+
+/* FFT_MEASURE Planner
+ * Builds and times a plan for every candidate from fft_plan_candidates() on
+ * a synthetic input and returns the fastest one.
+ * Returns NULL on allocation failure.
+ */
+struct fft_plan* fft_plan_measure(long num_samples)
+{
+    struct fft_plan candidates[MAX_CANDIDATES];
+    const size_t num_candidates = fft_plan_candidates(num_samples, candidates);
+    struct fft_plan* best = NULL;
+    double best_time = HUGE_VAL;
+    double* input_buf = malloc(num_samples * sizeof(*input_buf));
+    double complex* transform_buf = malloc(num_samples * sizeof(*transform_buf));
+
+    if ((NULL == input_buf) || (NULL == transform_buf)) {
+        error("Error allocating %ld samples for the planner\n", num_samples);
+        free(input_buf);
+        free(transform_buf);
+        return NULL;
+    }
+
+    for (size_t i=0; i<num_samples; i++)
+        input_buf[i] = ((i*7919) % 1021)/1021.0 - 0.5;
+
+    for (size_t c=0; c<num_candidates; c++) {
+        struct fft_plan* plan = fft_plan_new(num_samples,
+            candidates[c].algorithm, candidates[c].engine, candidates[c].leaf);
+        double t;
+
+        if (NULL == plan)
+            continue;
+
+        //the debug output of the engines would swamp the timing, so the
+        //trials are quiet on this thread only (and on the pool they use)
+        verbose_quiet = true;
+        t = fft_plan_time(plan, input_buf, transform_buf);
+        verbose_quiet = false;
+        verbose("measure %ld samples: %s, engine %s, leaf %zd: %.3lf us\n", num_samples, fft_algorithm_names[plan->algorithm], (FFT_RADIX2 == plan->algorithm) ? fft_engine_names[plan->engine] : "-", plan->leaf, t*1e6);
+
+        if (t < best_time) {
+            fft_plan_destroy(best);
+            best = plan;
+            best_time = t;
+        } else {
+            fft_plan_destroy(plan);
+        }
+    }
+
+    free(input_buf);
+    free(transform_buf);
+
+    return best;
+}
+
+/* machine key of the wisdom, see wisdom_machine() */
+char wisdom_machine_key[256] = "";
+
+/* fill in wisdom_machine_key, called once by wisdom_machine() */
+void wisdom_machine_init(void)
+{
+    char model[192] = "unknown";
+    FILE* cpuinfo;
+
+    cpuinfo = fopen("/proc/cpuinfo", "r");
+    if (NULL != cpuinfo) {
+        char line[256];
+
+        while (NULL != fgets(line, sizeof(line), cpuinfo)) {
+            char* colon = strchr(line, ':');
+
+            if ((0 == strncmp(line, "model name", 10)) && (NULL != colon)) {
+                colon += strspn(colon, ": \t");
+                colon[strcspn(colon, "\r\n")] = '\0';
+                snprintf(model, sizeof(model), "%s", colon);
+/*BREAK*/       break;
+            }
+        }
+        fclose(cpuinfo);
+    }
+
+    snprintf(wisdom_machine_key, sizeof(wisdom_machine_key), "%s\t%s\t%s",
+        model, WISDOM_ISA, WISDOM_PRECISION);
+}
+
+/* Wisdom Machine Key
+ * Returns "CPU model\tISA\tprecision" for the current machine and build.
+ * The CPU model is the "model name" from /proc/cpuinfo, or "unknown".
+ */
+const char* wisdom_machine(void)
+{
+    static pthread_once_t once = PTHREAD_ONCE_INIT;
+
+    pthread_once(&once, wisdom_machine_init);
+    return wisdom_machine_key;
+}
+
+/* release all of the wisdom */
+void wisdom_free(void)
+{
+    for (size_t i=0; i<wisdom_count; i++)
+        free(wisdom[i].machine);
+    free(wisdom);
+    wisdom = NULL;
+    wisdom_count = 0;
+    wisdom_capacity = 0;
+}
+
+/* Wisdom Lookup
+ * Returns the wisdom entry for num_samples on machine or NULL if there is
+ * none.
+ */
+struct wisdom_entry* wisdom_lookup(const char* machine, long num_samples)
+{
+    for (size_t i=0; i<wisdom_count; i++) {
+        if ((num_samples == wisdom[i].num_samples) &&
+            (0 == strcmp(machine, wisdom[i].machine)))
+            return &wisdom[i];
+    }
+
+    return NULL;
+}
+
+/* Wisdom Add
+ * Remembers the decision of plan for num_samples on machine, replacing an
+ * older decision for the same key.
+ * Returns false on allocation failure.
+ */
+bool wisdom_add(const char* machine, const struct fft_plan* const plan)
+{
+    struct wisdom_entry* entry = wisdom_lookup(machine, plan->num_samples);
+
+    if (NULL == entry) {
+        char* machine_copy = strdup(machine);
+
+        if (NULL == machine_copy)
+            return false;
+
+        if (wisdom_count == wisdom_capacity) {
+            size_t capacity = (0 == wisdom_capacity) ? 16 : 2*wisdom_capacity;
+            struct wisdom_entry* grown =
+                realloc(wisdom, capacity * sizeof(*wisdom));
+
+            if (NULL == grown) {
+                free(machine_copy);
+                return false;
+            }
+            wisdom = grown;
+            wisdom_capacity = capacity;
+        }
+
+        entry = &wisdom[wisdom_count++];
+        entry->machine = machine_copy;
+        entry->num_samples = plan->num_samples;
+    }
+
+    entry->algorithm = plan->algorithm;
+    entry->engine = plan->engine;
+    entry->leaf = plan->leaf;
+    return true;
+}
+
+/* find name in the array of count names, return its index or -1 */
+int wisdom_name_index(const char* name, const char* const names[],
+    size_t count)
+{
+    for (size_t i=0; i<count; i++) {
+        if (0 == strcmp(name, names[i]))
+            return i;
+    }
+
+    return -1;
+}
+
+/* Wisdom Import
+ * Reads the wisdom file, one decision per line with tab-separated fields:
+ *   CPU model, ISA, precision, size, algorithm, engine, leaf
+ * Lines beginning with # are comments. A missing file is not an error since
+ * it will be created by wisdom_export().
+ * Returns false if the file exists but can not be parsed.
+ */
+bool wisdom_import(const char* filename)
+{
+    FILE* file = fopen(filename, "r");
+    char line[512];
+    size_t line_number = 0;
+    bool retval = true;
+
+    if (NULL == file) {
+        verbose("no wisdom in %s\n", filename);
+        return true;
+    }
+
+    while (retval && (NULL != fgets(line, sizeof(line), file))) {
+        char* field[7];
+        size_t num_fields = 0;
+        struct fft_plan decision = {0};
+        int algorithm = -1;
+        int engine = -1;
+
+        line_number++;
+        line[strcspn(line, "\r\n")] = '\0';
+        if (('#' == line[0]) || ('\0' == line[0]))
+            continue;
+
+        for (char* f=strtok(line, "\t"); (NULL != f) && (num_fields < 7);
+            f=strtok(NULL, "\t"))
+            field[num_fields++] = f;
+
+        if (7 == num_fields) {
+            decision.num_samples = strtol(field[3], NULL, 10);
+            algorithm = wisdom_name_index(field[4], fft_algorithm_names,
+                sizeof(fft_algorithm_names)/sizeof(fft_algorithm_names[0]));
+            engine = wisdom_name_index(field[5], fft_engine_names,
+                sizeof(fft_engine_names)/sizeof(fft_engine_names[0]));
+            if ((FFT_RADIX2 != algorithm) && (0 == strcmp(field[5], "-")))
+                engine = 0; //only powers of 2 have an engine
+        }
+        if ((decision.num_samples <= 0) || (algorithm <= 0) || (engine < 0)) {
+            error("Error parsing wisdom file %s line %zd\n", filename, line_number);
+            retval = false;
+/*BREAK*/   break;
+        }
+
+        decision.algorithm = algorithm;
+        decision.engine = engine;
+        decision.leaf = strtoul(field[6], NULL, 10);
+
+        //restore the tabs between the machine fields
+        field[1][-1] = '\t';
+        field[2][-1] = '\t';
+        if (!wisdom_add(field[0], &decision)) {
+            error("Error allocating wisdom\n");
+            retval = false;
+        }
+    }
+
+    fclose(file);
+    verbose("imported %zd wisdom entries from %s\n", wisdom_count, filename);
+
+    return retval;
+}
+
+/* Wisdom Export
+ * Writes all of the wisdom, including that of other machines, to the wisdom
+ * file in the format read by wisdom_import().
+ * Returns false on failure.
+ */
+bool wisdom_export(const char* filename)
+{
+    FILE* file = fopen(filename, "w");
+
+    if (NULL == file) {
+        error("Failed to open wisdom file %s\n", filename);
+        return false;
+    }
+
+    fprintf(file, "# fft wisdom: CPU model, ISA, precision, size, algorithm, engine, leaf\n");
+    for (size_t i=0; i<wisdom_count; i++) {
+        fprintf(file, "%s\t%ld\t%s\t%s\t%zd\n", wisdom[i].machine,
+            wisdom[i].num_samples, fft_algorithm_names[wisdom[i].algorithm],
+            (FFT_RADIX2 == wisdom[i].algorithm) ?
+                fft_engine_names[wisdom[i].engine] : "-", wisdom[i].leaf);
+    }
+
+    fclose(file);
+    verbose("exported %zd wisdom entries to %s\n", wisdom_count, filename);
+    wisdom_changed = false;
+
+    return true;
+}
+
+/* Wisdom Plan
+ * Builds the plan remembered in the wisdom for num_samples on this machine.
+ * The entry is ignored if it is not one of the fft_plan_candidates() for
+ * num_samples (for example if the wisdom file was edited).
+ * Returns NULL if there is no usable wisdom or on allocation failure.
+ */
+struct fft_plan* fft_plan_wisdom(long num_samples)
+{
+    const char* const machine = wisdom_machine();
+    struct wisdom_entry decision;
+    struct wisdom_entry* entry;
+    struct fft_plan candidates[MAX_CANDIDATES];
+    size_t num_candidates;
+
+    //copy the decision since wisdom may be reallocated by another thread
+    pthread_mutex_lock(&wisdom_lock);
+    entry = wisdom_lookup(machine, num_samples);
+    if (NULL != entry)
+        decision = *entry;
+    pthread_mutex_unlock(&wisdom_lock);
+
+    if (NULL == entry)
+        return NULL;
+
+    num_candidates = fft_plan_candidates(num_samples, candidates);
+    for (size_t c=0; c<num_candidates; c++) {
+        if ((decision.algorithm == candidates[c].algorithm) &&
+            ((FFT_RADIX2 != decision.algorithm) ||
+            ((decision.engine == candidates[c].engine) &&
+            (decision.leaf == candidates[c].leaf)))) {
+            verbose("using wisdom for %ld samples\n", num_samples);
+            return fft_plan_new(num_samples, candidates[c].algorithm,
+                candidates[c].engine, candidates[c].leaf);
+        }
+    }
+
+    error("Warning: ignoring invalid wisdom for %ld samples\n", num_samples);
+    return NULL;
+}
+
+/* Engine Plan
+ * Builds the plan of the engine selected with -e for the power of 2
+ * num_samples, the tables engine with its largest leaf.
+ * Returns NULL if the engine is not one of the fft_plan_candidates() for
+ * num_samples (a twiddle.h layout that was not generated, or a size beyond
+ * twiddle.h for the precomputed engines) or on allocation failure.
+ */
+struct fft_plan* fft_plan_engine(long num_samples, enum fft_engine engine)
+{
+    struct fft_plan candidates[MAX_CANDIDATES];
+    const size_t num_candidates = fft_plan_candidates(num_samples, candidates);
+    const struct fft_plan* chosen = NULL;
+
+    for (size_t c=0; c<num_candidates; c++) {
+        if ((FFT_RADIX2 == candidates[c].algorithm) &&
+            (engine == candidates[c].engine))
+            chosen = &candidates[c];
+    }
+
+    if (NULL == chosen) {
+        error("Error: engine %s is not available for %ld samples\n", fft_engine_names[engine], num_samples);
+        return NULL;
+    }
+
+    return fft_plan_new(num_samples, chosen->algorithm, chosen->engine,
+        chosen->leaf);
+}
+
+/* FFT Plan Creation
+ * Validates num_samples and chooses how to transform it:
+ * - for powers of 2, the engine selected with -e is always used
+ * - a decision in the wisdom for this machine is used with either planner
+ * - FFT_ESTIMATE uses fft_plan_algorithm() and, for powers of 2, the engine
+ *   selected in cfg.h
+ * - FFT_MEASURE times the candidate algorithms, engines and leaf sizes on
+ *   this machine and keeps the fastest, see fft_plan_measure(), and adds the
+ *   decision to the wisdom
+ * Returns NULL if num_samples is not supported or on allocation failure.
+ * Release the plan with fft_plan_destroy().
+ */
+struct fft_plan* fft_plan_create(long num_samples, enum fft_planner planner)
+{
+    const enum fft_algorithm algorithm = fft_plan_algorithm(num_samples);
+    struct fft_plan* plan;
+
+    if (FFT_UNSUPPORTED == algorithm) {
+        error("Error: unsupported number of samples: %ld\n", num_samples);
+        return NULL;
+    }
+
+    if ((FFT_RADIX2 == algorithm) && (option_engine >= 0)) {
+        plan = fft_plan_engine(num_samples, option_engine);
+    } else {
+        plan = fft_plan_wisdom(num_samples);
+        if ((NULL == plan) && (FFT_MEASURE == planner)) {
+            plan = fft_plan_measure(num_samples);
+            pthread_mutex_lock(&wisdom_lock);
+            if ((NULL != plan) && wisdom_add(wisdom_machine(), plan))
+                wisdom_changed = true;
+            pthread_mutex_unlock(&wisdom_lock);
+        } else if (NULL == plan) {
+            plan = fft_plan_new(num_samples, algorithm,
+                fft_estimate_engine(num_samples), MAX_LEAF);
+        }
+    }
+
+    if (NULL != plan)
+        verbose("fft_plan: %ld samples, %s, engine %s, leaf %zd\n", num_samples, fft_algorithm_names[plan->algorithm], (FFT_RADIX2 == plan->algorithm) ? fft_engine_names[plan->engine] : "-", plan->leaf);
+
+    return plan;
+}
+
+/* remove plan from the plan cache list, plan_cache_lock must be held */
+static void plan_cache_unlink(struct fft_plan* const plan)
+{
+    if (NULL != plan->lru_prev)
+        plan->lru_prev->lru_next = plan->lru_next;
+    else
+        plan_cache_head = plan->lru_next;
+
+    if (NULL != plan->lru_next)
+        plan->lru_next->lru_prev = plan->lru_prev;
+    else
+        plan_cache_tail = plan->lru_prev;
+
+    plan->lru_prev = NULL;
+    plan->lru_next = NULL;
+}
+
+/* make plan the most recently used, plan_cache_lock must be held */
+static void plan_cache_push(struct fft_plan* const plan)
+{
+    plan->lru_prev = NULL;
+    plan->lru_next = plan_cache_head;
+    if (NULL != plan_cache_head)
+        plan_cache_head->lru_prev = plan;
+    else
+        plan_cache_tail = plan;
+    plan_cache_head = plan;
+}
+
+/* Plan Cache Eviction
+ * Unlinks the least recently used plans that are not acquired until the
+ * cache is within PLAN_CACHE_MAX_BYTES and returns them as a list linked by
+ * lru_next, to be destroyed by plan_cache_destroy() once plan_cache_lock is
+ * released, since destroying a plan releases the plans it holds. Plans in use
+ * are never evicted, so the cache may exceed the limit while they are
+ * acquired.
+ * plan_cache_lock must be held.
+ */
+static struct fft_plan* plan_cache_evict(void)
+{
+    struct fft_plan* plan = plan_cache_tail;
+    struct fft_plan* evicted = NULL;
+
+    while ((plan_cache_bytes > PLAN_CACHE_MAX_BYTES) && (NULL != plan)) {
+        struct fft_plan* const prev = plan->lru_prev;
+
+        if (0 == plan->refcount) {
+            verbose("plan cache: evicting %zd samples\n", plan->num_samples);
+            plan_cache_unlink(plan);
+            plan_cache_bytes -= plan->bytes;
+            plan->lru_next = evicted;
+            evicted = plan;
+        }
+        plan = prev;
+    }
+
+    return evicted;
+}
+
+/* destroy a list of plans from plan_cache_evict(), plan_cache_lock must not
+   be held */
+static void plan_cache_destroy(struct fft_plan* plan)
+{
+    while (NULL != plan) {
+        struct fft_plan* const next = plan->lru_next;
+
+        fft_plan_destroy(plan);
+        plan = next;
+    }
+}
+
+/* Plan Cache Lookup
+ * Finds a cached plan for a key that can be acquired. A plan with scratch is
+ * working space for one execution at a time, so it is only handed to one user
+ * at a time and another user gets a plan of its own.
+ * plan_cache_lock must be held.
+ */
+static struct fft_plan* plan_cache_find(long num_samples,
+    enum fft_layout layout, enum fft_planner planner)
+{
+    for (struct fft_plan* plan=plan_cache_head; NULL!=plan; plan=plan->lru_next) {
+        if ((num_samples == plan->num_samples) &&
+            (layout == plan->layout) && (planner == plan->planner) &&
+            ((0 == plan->refcount) || (NULL == plan->scratch)))
+            return plan;
+    }
+
+    return NULL;
+}
+
+/* Plan Cache Acquire
+ * Returns the plan for (num_samples, layout, planner) from the process-wide
+ * plan cache, creating it with the planner if it is not cached (the precision
+ * is always double). The planner is part of the key so that an FFT_MEASURE
+ * request never gets an estimated plan; FFT_LAYOUT_COMPLEX plans always use
+ * the tables engine, so they are shared by both planners. Plans serve both
+ * directions, the backward transforms run the forward tables backward.
+ * The plan must be handed back with fft_plan_release() and stays in the
+ * cache afterwards until it is evicted as the least recently used plan.
+ * FFT_LAYOUT_COMPLEX plans are only available for powers of 2.
+ * Plans with scratch (Rader, Bluestein and PFA, and the tables of the
+ * fft_simd_batch() sizes) are acquired by one user at a time, a concurrent
+ * request for the same key gets a plan of its own.
+ * Safe to call from multiple threads; plans are created outside of the lock
+ * so a measuring planner does not block lookups of other sizes.
+ * Returns NULL if num_samples is not supported or on allocation failure.
+ */
+struct fft_plan* fft_plan_acquire(long num_samples, enum fft_layout layout,
+    enum fft_planner planner)
+{
+    struct fft_plan* plan;
+    struct fft_plan* cached;
+    struct fft_plan* duplicate = NULL;
+    struct fft_plan* evicted;
+
+    if (FFT_LAYOUT_COMPLEX == layout)
+        planner = FFT_ESTIMATE;
+
+    pthread_mutex_lock(&plan_cache_lock);
+    plan = plan_cache_find(num_samples, layout, planner);
+    if (NULL != plan) {
+        plan->refcount++;
+        plan_cache_unlink(plan);
+        plan_cache_push(plan);
+    }
+    pthread_mutex_unlock(&plan_cache_lock);
+
+    if (NULL != plan)
+        return plan;
+
+    if (FFT_LAYOUT_REAL == layout) {
+        plan = fft_plan_create(num_samples, planner);
+    } else if ((num_samples > 0) && ispowerof2(num_samples)) {
+        plan = fft_plan_new(num_samples, FFT_RADIX2, FFT_ENGINE_TABLES,
+            MAX_LEAF);
+    } else {
+        error("Error: unsupported number of complex samples: %ld\n", num_samples);
+    }
+    if (NULL == plan)
+        return NULL;
+    plan->layout = layout;
+    plan->planner = planner;
+
+    //another thread may have created the same plan in the meantime
+    pthread_mutex_lock(&plan_cache_lock);
+    cached = plan_cache_find(num_samples, layout, planner);
+    if (NULL != cached) {
+        //destroyed with the evicted plans, outside of the lock
+        plan->lru_next = NULL;
+        duplicate = plan;
+        plan = cached;
+        plan_cache_unlink(plan);
+    } else {
+        plan_cache_bytes += plan->bytes;
+    }
+    plan->refcount++;
+    plan_cache_push(plan);
+    evicted = plan_cache_evict();
+    pthread_mutex_unlock(&plan_cache_lock);
+
+    plan_cache_destroy(duplicate);
+    plan_cache_destroy(evicted);
+
+    return plan;
+}
+
+/* hand back a plan from fft_plan_acquire(), plan may be NULL */
+void fft_plan_release(struct fft_plan* const plan)
+{
+    struct fft_plan* evicted;
+
+    if (NULL == plan)
+        return;
+
+    pthread_mutex_lock(&plan_cache_lock);
+    assert(0 < plan->refcount);
+    plan->refcount--;
+    evicted = plan_cache_evict();
+    pthread_mutex_unlock(&plan_cache_lock);
+
+    plan_cache_destroy(evicted);
+}
+
+/* Plan Cache Free
+ * Destroys all of the cached plans, none of them may be in use other than by
+ * the cached plans that hold them: a plan is destroyed before the plans it
+ * holds, which it releases.
+ */
+void plan_cache_free(void)
+{
+    while (true) {
+        struct fft_plan* plan;
+
+        pthread_mutex_lock(&plan_cache_lock);
+        for (plan=plan_cache_head; NULL!=plan; plan=plan->lru_next) {
+            if (0 == plan->refcount)
+/*BREAK*/       break;
+        }
+        if (NULL != plan) {
+            plan_cache_unlink(plan);
+            plan_cache_bytes -= plan->bytes;
+        }
+        pthread_mutex_unlock(&plan_cache_lock);
+
+        if (NULL == plan)
+/*BREAK*/   break;
+        fft_plan_destroy(plan);
+    }
+
+    assert(NULL == plan_cache_head);
+}
+
+/* bin k of the N bins in the packed half spectrum from fft_real_inplace() */
+static inline double complex packed_bin(long num_samples,
+    const double* const packed, size_t k)
+{
+    const size_t half_n = num_samples/2;
+
+    if (0 == k)
+        return CMPLX(packed[0], 0);
+    if (half_n == k)
+        return CMPLX(packed[1], 0);
+    if (k > half_n)
+        return conj(packed_bin(num_samples, packed, num_samples - k));
+    return CMPLX(packed[2*k], packed[2*k+1]);
+}
+
+/* print out the packed half spectrum from fft_real_inplace() in the test case
+   output format, unpacked to all of the bins */
+void print_packed_result(long num_bins, const double* const packed)
+{
+    printf("# %ld Frequency Bins\n", num_bins);
+    for (size_t i=0; i<num_bins; i++) {
+        const double complex bin = packed_bin(num_bins, packed, i);
+        printf("%.16lf%+.16lfj\n", creal(bin), cimag(bin));
+    }
+
+    if ((NULL != option_output_file) && (option_verbose)) {
+        verbose("# %ld Frequency Bins\n", num_bins);
+        for (size_t i=0; i< num_bins; i++) {
+            const double complex bin = packed_bin(num_bins, packed, i);
+            verbose("%.16lf%+.16lfj\n", creal(bin), cimag(bin));
+        }
+    }
+}
+
+/* print out the result in the test case output format */
+void print_result(long num_bins, const double complex* const bins)
+{
+    printf("# %ld Frequency Bins\n", num_bins);
+    for (size_t i=0; i<num_bins; i++)
         printf("%.16lf%+.16lfj\n", creal(bins[i]), cimag(bins[i]));
 
     if ((NULL != option_output_file) && (option_verbose)) {
@@ -487,10 +4523,78 @@ void print_result(long num_bins, const double complex* const bins)
     }
 }
 
+/* Multi-Channel Transform
+ * Transforms each of the num_channels channels of num_samples interleaved in
+ * input_buf and prints the spectrum of each channel, one after the other.
+ * The forward FFT hands the interleaved frames to fft_plan_execute_batch()
+ * (stride num_channels, distance 1), which reads each channel with that
+ * stride except for Bluestein, Rader and PFA plans. The backward FFT copies
+ * each channel anyway: fft_inverse() takes the bins as complex numbers, and
+ * fft_c2r_inplace() with -r overwrites the packed half spectrum.
+ * Returns 0 on success or the exit code for main().
+ */
+int transform_channels(long num_samples, long num_channels,
+    const double* const input_buf)
+{
+    const size_t total = num_samples*num_channels;
+    double complex* transform_buf = NULL;
+    double complex* bins = NULL;
+    struct fft_plan* plan = NULL;
+    int retval = 0;
+
+    if (memory_check(total + num_samples, sizeof(*transform_buf), "output")) {
+        transform_buf = malloc(total * sizeof(*transform_buf));
+        bins = malloc(num_samples * sizeof(*bins));
+    }
+    if ((NULL == transform_buf) || (NULL == bins))
+        retval = 3;
+
+    if ((0 == retval) && (FFT_FORWARD == option_direction)) {
+        plan = fft_plan_acquire(num_samples, FFT_LAYOUT_REAL, option_planner);
+        if ((NULL == plan) || !fft_plan_execute_batch(plan, num_channels,
+            input_buf, num_channels, 1, transform_buf))
+            retval = 3;
+        fft_plan_release(plan);
+    } else if ((0 == retval) && option_real_inplace) {
+        // the packed half spectrum of a channel is transformed in place
+        double* const x = (double*)bins;
+
+        for (long c=0; (c<num_channels) && (0 == retval); c++) {
+            for (size_t n=0; n<num_samples; n++)
+                x[n] = input_buf[n*num_channels + c];
+            if (!fft_c2r_inplace(num_samples, x, option_normalize))
+                retval = 3;
+            for (size_t n=0; n<num_samples; n++)
+                transform_buf[c*num_samples + n] = CMPLX(x[n], 0);
+        }
+    } else if (0 == retval) {
+        for (long c=0; (c<num_channels) && (0 == retval); c++) {
+            for (size_t n=0; n<num_samples; n++)
+                bins[n] = CMPLX(input_buf[n*num_channels + c], 0);
+            if (!fft_inverse(num_samples, bins,
+                &transform_buf[c*num_samples], option_normalize))
+                retval = 3;
+        }
+    }
+
+    for (long c=0; (c<num_channels) && (0 == retval); c++)
+        print_result(num_samples, &transform_buf[c*num_samples]);
+
+    free(bins);
+    free(transform_buf);
+
+    return retval;
+}
+
 /* main logic */
 int main(int argc, char* const argv[])
 {
     int retval = 0;
+    const char* threads_env = getenv(THREADS_ENV);
+
+    // the number of threads defaults to $FFT_THREADS, -t overrides it
+    if ((NULL != threads_env) && (strtol(threads_env, NULL, 10) > 0))
+        option_threads = strtol(threads_env, NULL, 10);
 
     // parse arguments
     retval = parse_args(argc, argv);
@@ -510,45 +4614,151 @@ int main(int argc, char* const argv[])
         }
     }
 
+    // load the planner wisdom
+    if (NULL == option_wisdom_file)
+        option_wisdom_file = getenv(WISDOM_ENV);
+    if ((0 == retval) && (NULL != option_wisdom_file)) {
+        if (!wisdom_import(option_wisdom_file))
+            retval = -1;
+    }
+
     if (0 == retval) {
         long num_samples = 0;
+        long num_channels = 1;
+        long frame_samples = 0; //samples per signal with -m
         double* input_buf = NULL; //note: free when going out of scope
         double complex* transform_buf = NULL; //note: malloc in this function
+        struct fft_plan* plan = NULL; //note: created in this function
 
         // read samples from input
-        num_samples = parse_input(&input_buf);
-        if ((num_samples <= 0) || (num_samples > 40960)) {
+        num_samples = parse_input(&input_buf, &num_channels);
+        frame_samples = num_samples/option_howmany;
+        if (num_samples <= 0) {
+            retval = 2;
+        } else if (0 != (num_samples % option_howmany)) {
+            error("Error: %ld samples do not split into %ld signals\n", num_samples, option_howmany);
+            retval = 2;
+        } else if ((1 < option_howmany) && (option_stereo ||
+            option_real_inplace || (FFT_BACKWARD == option_direction))) {
+            error("Error: -m only supports the default forward transform\n");
             retval = 2;
+        } else if (!fft_supported(frame_samples)) {
+            error("Error: unsupported number of samples: %ld\n", frame_samples);
+            retval = 2;
+        } else if (option_real_inplace && !ispowerof2(num_samples)) {
+            error("Error: -r only supports power of 2 sizes, not %ld samples\n", num_samples);
+            retval = 2;
+        } else if (option_real_inplace && option_stereo) {
+            error("Error: -r and -s cannot be combined\n");
+            retval = 2;
+        } else if ((1 < num_channels) && option_real_inplace &&
+            (FFT_FORWARD == option_direction)) {
+            error("Error: -r only supports multi-channel input with -d backward\n");
+            retval = 2;
+        } else if ((1 < num_channels) && (option_stereo ||
+            (1 < option_howmany))) {
+            error("Error: -s and -m do not support multi-channel input\n");
+            retval = 2;
+        } else if (1 < num_channels) {
+            // one spectrum per channel of the interleaved frames
+            retval = transform_channels(num_samples, num_channels, input_buf);
+        } else if ((FFT_BACKWARD == option_direction) && option_stereo) {
+            error("Error: -s only supports the forward direction\n");
+            retval = 2;
+        } else if ((FFT_BACKWARD == option_direction) &&
+            option_real_inplace) {
+            // the input is a packed half spectrum, transformed in place
+            if (fft_c2r_inplace(num_samples, input_buf, option_normalize)) {
+                printf("# %ld Samples\n", num_samples);
+                for (size_t i=0; i<num_samples; i++)
+                    printf("%.16lf%+.16lfj\n", input_buf[i], 0.0);
+            } else {
+                retval = 3;
+            }
+        } else if (FFT_BACKWARD == option_direction) {
+            // the real samples are the bins of the inverse FFT
+            double complex* bins = NULL;
+
+            if (memory_check(2*num_samples, sizeof(*transform_buf),
+                "inverse")) {
+                bins = malloc(num_samples * sizeof(*bins));
+                transform_buf = malloc(num_samples * sizeof(*transform_buf));
+            }
+            if ((NULL == bins) || (NULL == transform_buf)) {
+                retval = 3;
+            } else {
+                for (size_t i=0; i<num_samples; i++)
+                    bins[i] = CMPLX(input_buf[i], 0);
+                if (fft_inverse(num_samples, bins, transform_buf,
+                    option_normalize))
+                    print_result(num_samples, transform_buf);
+                else
+                    retval = 3;
+            }
+            free(bins);
+            free(transform_buf);
+        } else if (option_stereo) {
+            // both channels in one complex FFT, no real FFT plan needed
+            const long num_bins = num_samples/2;
+
+            if (0 != (num_samples % 2)) {
+                error("Error: stereo input needs an even number of samples: %ld\n", num_samples);
+                retval = 2;
+            } else if (memory_check(num_samples, sizeof(*transform_buf),
+                "output")) {
+                transform_buf = malloc(num_samples * sizeof(*transform_buf));
+            }
+            if ((0 == retval) && ((NULL == transform_buf) ||
+                !fft_two_real(num_bins, &input_buf[0], &input_buf[1], 2,
+                    &transform_buf[0], &transform_buf[num_bins])))
+                retval = 3;
+            if (0 == retval) {
+                print_result(num_bins, &transform_buf[0]);
+                print_result(num_bins, &transform_buf[num_bins]);
+            }
+            free(transform_buf);
+        } else if (option_real_inplace) {
+            // the in-place transform consumes its input, so it is not
+            // repeated for TIMING_TEST
+            if (fft_real_inplace(num_samples, input_buf))
+                print_packed_result(num_samples, input_buf);
+            else
+                retval = 3;
         } else {
-#if (TIMING_TEST > 0)
-            double* input_copy = malloc(num_samples * sizeof(*input_buf));
-            memcpy(input_copy, input_buf, (num_samples * sizeof(*input_buf)));
-#endif
+            if (memory_check(num_samples, sizeof(*transform_buf), "output"))
+                transform_buf = malloc(num_samples * sizeof(*transform_buf));
 
-            transform_buf = malloc(num_samples * sizeof(*transform_buf));
+            // plan once, outside of the timing loop
+            plan = fft_plan_acquire(frame_samples, FFT_LAYOUT_REAL,
+                option_planner);
+            if ((NULL == plan) || (NULL == transform_buf))
+                retval = 3;
 
 #if (TIMING_TEST > 0)
             for (
               size_t timing_counter = 0;
-              timing_counter < (size_t)TIMING_TEST;
+              (timing_counter < (size_t)TIMING_TEST) && (0 == retval);
               timing_counter++
             ) {
-                // replace input with a clean copy
-                memcpy(input_buf, input_copy,
-                    (num_samples * sizeof(*input_buf)));
 #endif
-                // peform FFT processing (corrupts input_buf)
-                fft(num_samples, input_buf, transform_buf);
+                // peform FFT processing (input_buf is not modified)
+                if ((0 == retval) &&
+                    !fft_plan_execute_batch(plan, option_howmany, input_buf,
+                        1, frame_samples, transform_buf))
+                    retval = 3;
 #if (TIMING_TEST > 0)
             }
 #endif
-            if (NULL != transform_buf) {
+            if ((NULL != transform_buf) && (0 == retval)) {
                 // write output
-                print_result(num_samples, transform_buf);
-                free(transform_buf);
+                for (long t=0; t<option_howmany; t++)
+                    print_result(frame_samples,
+                        &transform_buf[t*frame_samples]);
             } else {
                 retval = 3;
             }
+            free(transform_buf);
+            fft_plan_release(plan);
         }
 
         if (NULL != input_buf)
@@ -558,5 +4768,13 @@ int main(int argc, char* const argv[])
     if (NULL != ril_lineptr)
         free(ril_lineptr);
 
+    // save what the planner learned
+    if ((0 == retval) && (NULL != option_wisdom_file) && wisdom_changed)
+        wisdom_export(option_wisdom_file);
+
+    thread_pool_stop();
+    plan_cache_free();
+    wisdom_free();
+
     return retval;
 }
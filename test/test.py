@@ -10,6 +10,12 @@ def _v():
     global args
     return args.verbose
 
+def bin_list(strlist) -> list:
+    try:
+        return [int(b, 0) for b in strlist.split(",")]
+    except ValueError:
+        raise(argparse.ArgumentTypeError("Argument is not a list of bins"))
+
 def parse_args(inargs) -> argparse.Namespace:
     parser = argparse.ArgumentParser(
         description="This script will read a test case .tc file from stdin and pass it through numpy.fft before printing the output to stdout.",
@@ -19,10 +25,73 @@ def parse_args(inargs) -> argparse.Namespace:
         help="specify an input file")
     parser.add_argument("-o", "--output", default=sys.stdout,
         type=argparse.FileType('w'), help="specify an output file")
+    parser.add_argument("-b", "--bins", type=bin_list,
+        help="only output the comma-separated list of bins")
+    parser.add_argument("-p", "--planner", choices=["estimate", "measure"],
+        help="accepted for compatibility with fft, does not change the result")
+    parser.add_argument("-e", "--engine",
+        help="accepted for compatibility with fft, does not change the result")
+    parser.add_argument("-w", "--wisdom",
+        help="accepted for compatibility with fft, does not change the result")
+    parser.add_argument("-t", "--threads",
+        help="accepted for compatibility with fft, does not change the result")
+    parser.add_argument("-a", "--affinity", action="store_true",
+        help="accepted for compatibility with fft, does not change the result")
+    parser.add_argument("-s", "--stereo", action="store_true",
+        help="the samples are interleaved pairs of two channels, output the "
+        "spectrum of each channel")
+    parser.add_argument("-r", "--real-inplace", action="store_true",
+        help="with -d backward, the samples are a packed half spectrum "
+        "(otherwise accepted for compatibility with fft)")
+    parser.add_argument("-d", "--direction", choices=["forward", "backward"],
+        default="forward", help="backward computes the inverse FFT of the "
+        "samples taken as bins")
+    parser.add_argument("-n", "--normalize", action="store_true",
+        help="scale the backward transform by 1/N")
+    parser.add_argument("-m", "--howmany", type=int, default=1,
+        help="the samples are HOWMANY consecutive signals of equal size, "
+        "output the spectrum of each signal")
+    parser.add_argument("-g", "--generate", nargs=3,
+        metavar=("WAVE", "FREQ", "N"), help="instead of reading a test case, "
+        "write one of N samples of a WAVE (square) at frequency FREQ/N")
     parser.add_argument("-v", "--verbose", action="store_true",
         help="extra output for debug")
     return(parser.parse_args(inargs))
 
+def channel_spectra(samples) -> list:
+    if (args.direction == "backward"):
+        n = len(samples)
+        if (args.real_inplace and (n > 1) and (0 == (n & (n-1)))):
+            # unpack Re X(0), Re X(N/2), Re X(k), Im X(k), ...
+            half = [complex(samples[0])]
+            half += [complex(samples[2*k], samples[2*k+1])
+                for k in range(1, n//2)]
+            half += [complex(samples[1])]
+            sp = np.fft.irfft(half, n) * n
+        else:
+            sp = np.fft.ifft(samples) * n
+        if (args.normalize):
+            sp = sp / n
+        spectra = [sp]
+    elif (args.stereo):
+        spectra = [np.fft.fft(samples[0::2]), np.fft.fft(samples[1::2])]
+    else:
+        n = len(samples)//args.howmany
+        spectra = [np.fft.fft(samples[t*n:(t+1)*n])
+            for t in range(args.howmany)]
+    return spectra
+
+def generate(wave, freq, n) -> None:
+    if (wave != "square"):
+        raise(ValueError("Unknown wave: {}".format(wave)))
+    # lines end with \r\n like the checked-in test cases
+    print("# {}-sample test case of a square wave at frequency {}/{}".format(
+        n, freq, n), end="\r\n", file=args.output)
+    print(n, end="\r\n", file=args.output)
+    for i in range(n):
+        v = 1 if ((i*freq % n) < n/2) else -1
+        print(v, end="\r\n", file=args.output)
+
 def main(inargs) -> int:
     global args
     global stats
@@ -32,37 +101,56 @@ def main(inargs) -> int:
     if (_v()):
         print(args, file=sys.stderr)
 
+    if (args.generate is not None):
+        generate(args.generate[0], int(args.generate[1], 0),
+            int(args.generate[2], 0))
+        return 0
+
     num_samples=0
-    samples=[]
+    num_channels=1
+    frames=[]
 
+    # the number of samples may be followed by the number of channels
     for line in args.input:
         try:
             if (_v()):
                 print(line, end='', file=sys.stderr)
-            num_samples=int(line)
+            header=[int(v, 0) for v in line.split()[:2]]
+            num_samples=header[0]
+            if (len(header) > 1):
+                num_channels=header[1]
             break
-        except ValueError:
+        except (ValueError, IndexError):
             continue
 
+    # each line is a frame of one sample per channel
     for line in args.input:
         try:
             if (_v()):
                 print(line, end='', file=sys.stderr)
-            samples.append(float(line))
-            if (len(samples) == num_samples):
+            frame=[float(v) for v in line.split()[:num_channels]]
+            if (len(frame) != num_channels):
+                raise ValueError
+            frames.append(frame)
+            if (len(frames) == num_samples):
                 break
         except ValueError:
             continue
     if (_v()):
-        print("collected samples:", samples, file=sys.stderr)
+        print("collected samples:", frames, file=sys.stderr)
 
-    if (len(samples) != num_samples):
+    if (len(frames) != num_samples):
         print("Format Error: not enough samples received, expected {}".format(num_samples), file=sys.stderr)
 
-    sp = np.fft.fft(samples)
-    print("# {} Frequency Bins".format(len(sp)), file=args.output)
-    for v in sp:
-        print("{:.16f}".format(v), file=args.output)
+    spectra = []
+    for c in range(num_channels):
+        spectra += channel_spectra([f[c] for f in frames])
+    for sp in spectra:
+        if (args.bins is not None):
+            sp = sp[args.bins]
+        print("# {} Frequency Bins".format(len(sp)), file=args.output)
+        for v in sp:
+            print("{:.16f}".format(v), file=args.output)
 
 if __name__ == "__main__":
     sys.exit(main(sys.argv[1:]))
@@ -1,4167 +1,2064 @@
-/* Precomputed Twiddle Factors for FFT up to 4096 bins */
+/* Precomputed Twiddle Factors for FFT up to 8192 bins */
 /* NOTE: THIS IS A GENERATED FILE, DO NOT EDIT */
 #ifndef FFT_TWIDDLE_H
 #define FFT_TWIDDLE_H
 
 #include <complex.h>
 
-const double complex W₂²[1] =
-{
-	(1+0j),
-};
-
-const double complex W₄²[2] =
-{
-	(1+0j),
-	(6.123233995736766e-17-1j),
-};
-
-const double complex W₈²[4] =
-{
-	(1+0j),
-	(0.7071067811865476-0.7071067811865475j),
-	(6.123233995736766e-17-1j),
-	(-0.7071067811865475-0.7071067811865476j),
-};
-
-const double complex W₁₆²[8] =
-{
-	(1+0j),
-	(0.9238795325112867-0.3826834323650898j),
-	(0.7071067811865476-0.7071067811865475j),
-	(0.38268343236508984-0.9238795325112867j),
-	(6.123233995736766e-17-1j),
-	(-0.3826834323650897-0.9238795325112867j),
-	(-0.7071067811865475-0.7071067811865476j),
-	(-0.9238795325112867-0.3826834323650899j),
-};
-
-const double complex W₃₂²[16] =
-{
-	(1+0j),
-	(0.9807852804032304-0.19509032201612825j),
-	(0.9238795325112867-0.3826834323650898j),
-	(0.8314696123025452-0.5555702330196022j),
-	(0.7071067811865476-0.7071067811865475j),
-	(0.5555702330196023-0.8314696123025452j),
-	(0.38268343236508984-0.9238795325112867j),
-	(0.19509032201612833-0.9807852804032304j),
-	(6.123233995736766e-17-1j),
-	(-0.1950903220161282-0.9807852804032304j),
-	(-0.3826834323650897-0.9238795325112867j),
-	(-0.555570233019602-0.8314696123025455j),
-	(-0.7071067811865475-0.7071067811865476j),
-	(-0.8314696123025453-0.5555702330196022j),
-	(-0.9238795325112867-0.3826834323650899j),
-	(-0.9807852804032304-0.1950903220161286j),
-};
-
-const double complex W₆₄²[32] =
-{
-	(1+0j),
-	(0.9951847266721969-0.0980171403295606j),
-	(0.9807852804032304-0.19509032201612825j),
-	(0.9569403357322088-0.29028467725446233j),
-	(0.9238795325112867-0.3826834323650898j),
-	(0.881921264348355-0.47139673682599764j),
-	(0.8314696123025452-0.5555702330196022j),
-	(0.773010453362737-0.6343932841636455j),
-	(0.7071067811865476-0.7071067811865475j),
-	(0.6343932841636455-0.773010453362737j),
-	(0.5555702330196023-0.8314696123025452j),
-	(0.4713967368259978-0.8819212643483549j),
-	(0.38268343236508984-0.9238795325112867j),
-	(0.29028467725446233-0.9569403357322089j),
-	(0.19509032201612833-0.9807852804032304j),
-	(0.09801714032956077-0.9951847266721968j),
-	(6.123233995736766e-17-1j),
-	(-0.09801714032956065-0.9951847266721969j),
-	(-0.1950903220161282-0.9807852804032304j),
-	(-0.29028467725446216-0.9569403357322089j),
-	(-0.3826834323650897-0.9238795325112867j),
-	(-0.4713967368259977-0.881921264348355j),
-	(-0.555570233019602-0.8314696123025455j),
-	(-0.6343932841636454-0.7730104533627371j),
-	(-0.7071067811865475-0.7071067811865476j),
-	(-0.773010453362737-0.6343932841636455j),
-	(-0.8314696123025453-0.5555702330196022j),
-	(-0.8819212643483549-0.47139673682599786j),
-	(-0.9238795325112867-0.3826834323650899j),
-	(-0.9569403357322088-0.2902846772544624j),
-	(-0.9807852804032304-0.1950903220161286j),
-	(-0.9951847266721968-0.09801714032956083j),
-};
-
-const double complex W₁₂₈²[64] =
-{
-	(1+0j),
-	(0.9987954562051724-0.049067674327418015j),
-	(0.9951847266721969-0.0980171403295606j),
-	(0.989176509964781-0.14673047445536175j),
-	(0.9807852804032304-0.19509032201612825j),
-	(0.970031253194544-0.24298017990326387j),
-	(0.9569403357322088-0.29028467725446233j),
-	(0.9415440651830208-0.33688985339222005j),
-	(0.9238795325112867-0.3826834323650898j),
-	(0.9039892931234433-0.4275550934302821j),
-	(0.881921264348355-0.47139673682599764j),
-	(0.8577286100002721-0.5141027441932217j),
-	(0.8314696123025452-0.5555702330196022j),
-	(0.8032075314806449-0.5956993044924334j),
-	(0.773010453362737-0.6343932841636455j),
-	(0.7409511253549591-0.6715589548470183j),
-	(0.7071067811865476-0.7071067811865475j),
-	(0.6715589548470183-0.7409511253549591j),
-	(0.6343932841636455-0.773010453362737j),
-	(0.5956993044924335-0.8032075314806448j),
-	(0.5555702330196023-0.8314696123025452j),
-	(0.5141027441932217-0.8577286100002721j),
-	(0.4713967368259978-0.8819212643483549j),
-	(0.4275550934302822-0.9039892931234433j),
-	(0.38268343236508984-0.9238795325112867j),
-	(0.33688985339222005-0.9415440651830208j),
-	(0.29028467725446233-0.9569403357322089j),
-	(0.24298017990326398-0.970031253194544j),
-	(0.19509032201612833-0.9807852804032304j),
-	(0.14673047445536175-0.989176509964781j),
-	(0.09801714032956077-0.9951847266721968j),
-	(0.049067674327418126-0.9987954562051724j),
-	(6.123233995736766e-17-1j),
-	(-0.04906767432741801-0.9987954562051724j),
-	(-0.09801714032956065-0.9951847266721969j),
-	(-0.14673047445536164-0.989176509964781j),
-	(-0.1950903220161282-0.9807852804032304j),
-	(-0.24298017990326387-0.970031253194544j),
-	(-0.29028467725446216-0.9569403357322089j),
-	(-0.33688985339221994-0.9415440651830208j),
-	(-0.3826834323650897-0.9238795325112867j),
-	(-0.42755509343028186-0.9039892931234434j),
-	(-0.4713967368259977-0.881921264348355j),
-	(-0.5141027441932217-0.8577286100002721j),
-	(-0.555570233019602-0.8314696123025455j),
-	(-0.5956993044924334-0.8032075314806449j),
-	(-0.6343932841636454-0.7730104533627371j),
-	(-0.6715589548470184-0.740951125354959j),
-	(-0.7071067811865475-0.7071067811865476j),
-	(-0.7409511253549589-0.6715589548470186j),
-	(-0.773010453362737-0.6343932841636455j),
-	(-0.8032075314806448-0.5956993044924335j),
-	(-0.8314696123025453-0.5555702330196022j),
-	(-0.857728610000272-0.5141027441932218j),
-	(-0.8819212643483549-0.47139673682599786j),
-	(-0.9039892931234433-0.42755509343028203j),
-	(-0.9238795325112867-0.3826834323650899j),
-	(-0.9415440651830207-0.33688985339222033j),
-	(-0.9569403357322088-0.2902846772544624j),
-	(-0.970031253194544-0.24298017990326407j),
-	(-0.9807852804032304-0.1950903220161286j),
-	(-0.989176509964781-0.1467304744553618j),
-	(-0.9951847266721968-0.09801714032956083j),
-	(-0.9987954562051724-0.049067674327417966j),
-};
-
-const double complex W₂₅₆²[128] =
-{
-	(1+0j),
-	(0.9996988186962042-0.024541228522912288j),
-	(0.9987954562051724-0.049067674327418015j),
-	(0.9972904566786902-0.07356456359966743j),
-	(0.9951847266721969-0.0980171403295606j),
-	(0.99247953459871-0.1224106751992162j),
-	(0.989176509964781-0.14673047445536175j),
-	(0.9852776423889412-0.17096188876030122j),
-	(0.9807852804032304-0.19509032201612825j),
-	(0.9757021300385286-0.2191012401568698j),
-	(0.970031253194544-0.24298017990326387j),
-	(0.9637760657954398-0.26671275747489837j),
-	(0.9569403357322088-0.29028467725446233j),
-	(0.9495281805930367-0.3136817403988915j),
-	(0.9415440651830208-0.33688985339222005j),
-	(0.932992798834739-0.3598950365349881j),
-	(0.9238795325112867-0.3826834323650898j),
-	(0.9142097557035307-0.40524131400498986j),
-	(0.9039892931234433-0.4275550934302821j),
-	(0.8932243011955153-0.44961132965460654j),
-	(0.881921264348355-0.47139673682599764j),
-	(0.8700869911087115-0.49289819222978404j),
-	(0.8577286100002721-0.5141027441932217j),
-	(0.8448535652497071-0.5349976198870972j),
-	(0.8314696123025452-0.5555702330196022j),
-	(0.8175848131515837-0.5758081914178453j),
-	(0.8032075314806449-0.5956993044924334j),
-	(0.7883464276266063-0.6152315905806268j),
-	(0.773010453362737-0.6343932841636455j),
-	(0.7572088465064846-0.6531728429537768j),
-	(0.7409511253549591-0.6715589548470183j),
-	(0.724247082951467-0.6895405447370668j),
-	(0.7071067811865476-0.7071067811865475j),
-	(0.6895405447370669-0.7242470829514669j),
-	(0.6715589548470183-0.7409511253549591j),
-	(0.6531728429537768-0.7572088465064845j),
-	(0.6343932841636455-0.773010453362737j),
-	(0.6152315905806268-0.7883464276266062j),
-	(0.5956993044924335-0.8032075314806448j),
-	(0.5758081914178453-0.8175848131515837j),
-	(0.5555702330196023-0.8314696123025452j),
-	(0.5349976198870973-0.844853565249707j),
-	(0.5141027441932217-0.8577286100002721j),
-	(0.4928981922297841-0.8700869911087113j),
-	(0.4713967368259978-0.8819212643483549j),
-	(0.4496113296546066-0.8932243011955153j),
-	(0.4275550934302822-0.9039892931234433j),
-	(0.40524131400498986-0.9142097557035307j),
-	(0.38268343236508984-0.9238795325112867j),
-	(0.3598950365349883-0.9329927988347388j),
-	(0.33688985339222005-0.9415440651830208j),
-	(0.3136817403988916-0.9495281805930367j),
-	(0.29028467725446233-0.9569403357322089j),
-	(0.2667127574748984-0.9637760657954398j),
-	(0.24298017990326398-0.970031253194544j),
-	(0.21910124015686977-0.9757021300385286j),
-	(0.19509032201612833-0.9807852804032304j),
-	(0.17096188876030136-0.9852776423889412j),
-	(0.14673047445536175-0.989176509964781j),
-	(0.12241067519921628-0.99247953459871j),
-	(0.09801714032956077-0.9951847266721968j),
-	(0.07356456359966745-0.9972904566786902j),
-	(0.049067674327418126-0.9987954562051724j),
-	(0.024541228522912264-0.9996988186962042j),
-	(6.123233995736766e-17-1j),
-	(-0.024541228522912142-0.9996988186962042j),
-	(-0.04906767432741801-0.9987954562051724j),
-	(-0.07356456359966733-0.9972904566786902j),
-	(-0.09801714032956065-0.9951847266721969j),
-	(-0.12241067519921615-0.99247953459871j),
-	(-0.14673047445536164-0.989176509964781j),
-	(-0.17096188876030124-0.9852776423889412j),
-	(-0.1950903220161282-0.9807852804032304j),
-	(-0.21910124015686966-0.9757021300385286j),
-	(-0.24298017990326387-0.970031253194544j),
-	(-0.2667127574748983-0.9637760657954398j),
-	(-0.29028467725446216-0.9569403357322089j),
-	(-0.3136817403988914-0.9495281805930367j),
-	(-0.33688985339221994-0.9415440651830208j),
-	(-0.35989503653498817-0.9329927988347388j),
-	(-0.3826834323650897-0.9238795325112867j),
-	(-0.40524131400498975-0.9142097557035307j),
-	(-0.42755509343028186-0.9039892931234434j),
-	(-0.4496113296546067-0.8932243011955152j),
-	(-0.4713967368259977-0.881921264348355j),
-	(-0.492898192229784-0.8700869911087115j),
-	(-0.5141027441932217-0.8577286100002721j),
-	(-0.534997619887097-0.8448535652497072j),
-	(-0.555570233019602-0.8314696123025455j),
-	(-0.5758081914178453-0.8175848131515837j),
-	(-0.5956993044924334-0.8032075314806449j),
-	(-0.6152315905806267-0.7883464276266063j),
-	(-0.6343932841636454-0.7730104533627371j),
-	(-0.6531728429537765-0.7572088465064847j),
-	(-0.6715589548470184-0.740951125354959j),
-	(-0.6895405447370669-0.7242470829514669j),
-	(-0.7071067811865475-0.7071067811865476j),
-	(-0.7242470829514668-0.689540544737067j),
-	(-0.7409511253549589-0.6715589548470186j),
-	(-0.7572088465064846-0.6531728429537766j),
-	(-0.773010453362737-0.6343932841636455j),
-	(-0.7883464276266062-0.6152315905806269j),
-	(-0.8032075314806448-0.5956993044924335j),
-	(-0.8175848131515836-0.5758081914178454j),
-	(-0.8314696123025453-0.5555702330196022j),
-	(-0.8448535652497071-0.5349976198870972j),
-	(-0.857728610000272-0.5141027441932218j),
-	(-0.8700869911087113-0.49289819222978415j),
-	(-0.8819212643483549-0.47139673682599786j),
-	(-0.8932243011955152-0.4496113296546069j),
-	(-0.9039892931234433-0.42755509343028203j),
-	(-0.9142097557035307-0.4052413140049899j),
-	(-0.9238795325112867-0.3826834323650899j),
-	(-0.9329927988347388-0.35989503653498833j),
-	(-0.9415440651830207-0.33688985339222033j),
-	(-0.9495281805930367-0.3136817403988914j),
-	(-0.9569403357322088-0.2902846772544624j),
-	(-0.9637760657954398-0.2667127574748985j),
-	(-0.970031253194544-0.24298017990326407j),
-	(-0.9757021300385285-0.21910124015687005j),
-	(-0.9807852804032304-0.1950903220161286j),
-	(-0.9852776423889412-0.17096188876030122j),
-	(-0.989176509964781-0.1467304744553618j),
-	(-0.99247953459871-0.12241067519921635j),
-	(-0.9951847266721968-0.09801714032956083j),
-	(-0.9972904566786902-0.07356456359966773j),
-	(-0.9987954562051724-0.049067674327417966j),
-	(-0.9996988186962042-0.024541228522912326j),
-};
-
-const double complex W₅₁₂²[256] =
-{
-	(1+0j),
-	(0.9999247018391445-0.012271538285719925j),
-	(0.9996988186962042-0.024541228522912288j),
-	(0.9993223845883495-0.03680722294135883j),
-	(0.9987954562051724-0.049067674327418015j),
-	(0.9981181129001492-0.06132073630220858j),
-	(0.9972904566786902-0.07356456359966743j),
-	(0.996312612182778-0.0857973123444399j),
-	(0.9951847266721969-0.0980171403295606j),
-	(0.9939069700023561-0.11022220729388306j),
-	(0.99247953459871-0.1224106751992162j),
-	(0.99090263542778-0.13458070850712617j),
-	(0.989176509964781-0.14673047445536175j),
-	(0.9873014181578584-0.15885814333386145j),
-	(0.9852776423889412-0.17096188876030122j),
-	(0.9831054874312163-0.18303988795514095j),
-	(0.9807852804032304-0.19509032201612825j),
-	(0.9783173707196277-0.20711137619221856j),
-	(0.9757021300385286-0.2191012401568698j),
-	(0.9729399522055602-0.2310581082806711j),
-	(0.970031253194544-0.24298017990326387j),
-	(0.9669764710448521-0.25486565960451457j),
-	(0.9637760657954398-0.26671275747489837j),
-	(0.9604305194155658-0.27851968938505306j),
-	(0.9569403357322088-0.29028467725446233j),
-	(0.9533060403541939-0.3020059493192281j),
-	(0.9495281805930367-0.3136817403988915j),
-	(0.9456073253805213-0.3253102921622629j),
-	(0.9415440651830208-0.33688985339222005j),
-	(0.937339011912575-0.34841868024943456j),
-	(0.932992798834739-0.3598950365349881j),
-	(0.9285060804732156-0.37131719395183754j),
-	(0.9238795325112867-0.3826834323650898j),
-	(0.9191138516900578-0.3939920400610481j),
-	(0.9142097557035307-0.40524131400498986j),
-	(0.9091679830905224-0.41642956009763715j),
-	(0.9039892931234433-0.4275550934302821j),
-	(0.8986744656939538-0.43861623853852766j),
-	(0.8932243011955153-0.44961132965460654j),
-	(0.8876396204028539-0.46053871095824j),
-	(0.881921264348355-0.47139673682599764j),
-	(0.8760700941954066-0.4821837720791227j),
-	(0.8700869911087115-0.49289819222978404j),
-	(0.8639728561215868-0.5035383837257176j),
-	(0.8577286100002721-0.5141027441932217j),
-	(0.8513551931052652-0.524589682678469j),
-	(0.8448535652497071-0.5349976198870972j),
-	(0.8382247055548381-0.5453249884220465j),
-	(0.8314696123025452-0.5555702330196022j),
-	(0.8245893027850253-0.5657318107836131j),
-	(0.8175848131515837-0.5758081914178453j),
-	(0.8104571982525948-0.5857978574564389j),
-	(0.8032075314806449-0.5956993044924334j),
-	(0.7958369046088836-0.6055110414043255j),
-	(0.7883464276266063-0.6152315905806268j),
-	(0.7807372285720945-0.6248594881423863j),
-	(0.773010453362737-0.6343932841636455j),
-	(0.765167265622459-0.6438315428897914j),
-	(0.7572088465064846-0.6531728429537768j),
-	(0.7491363945234594-0.6624157775901718j),
-	(0.7409511253549591-0.6715589548470183j),
-	(0.7326542716724128-0.680600997795453j),
-	(0.724247082951467-0.6895405447370668j),
-	(0.7157308252838186-0.6983762494089729j),
-	(0.7071067811865476-0.7071067811865475j),
-	(0.6983762494089729-0.7157308252838186j),
-	(0.6895405447370669-0.7242470829514669j),
-	(0.6806009977954531-0.7326542716724128j),
-	(0.6715589548470183-0.7409511253549591j),
-	(0.6624157775901718-0.7491363945234593j),
-	(0.6531728429537768-0.7572088465064845j),
-	(0.6438315428897915-0.765167265622459j),
-	(0.6343932841636455-0.773010453362737j),
-	(0.6248594881423865-0.7807372285720944j),
-	(0.6152315905806268-0.7883464276266062j),
-	(0.6055110414043255-0.7958369046088835j),
-	(0.5956993044924335-0.8032075314806448j),
-	(0.5857978574564389-0.8104571982525948j),
-	(0.5758081914178453-0.8175848131515837j),
-	(0.5657318107836132-0.8245893027850253j),
-	(0.5555702330196023-0.8314696123025452j),
-	(0.5453249884220465-0.838224705554838j),
-	(0.5349976198870973-0.844853565249707j),
-	(0.5245896826784688-0.8513551931052652j),
-	(0.5141027441932217-0.8577286100002721j),
-	(0.5035383837257176-0.8639728561215867j),
-	(0.4928981922297841-0.8700869911087113j),
-	(0.48218377207912283-0.8760700941954066j),
-	(0.4713967368259978-0.8819212643483549j),
-	(0.46053871095824-0.8876396204028539j),
-	(0.4496113296546066-0.8932243011955153j),
-	(0.4386162385385277-0.8986744656939538j),
-	(0.4275550934302822-0.9039892931234433j),
-	(0.4164295600976373-0.9091679830905223j),
-	(0.40524131400498986-0.9142097557035307j),
-	(0.3939920400610481-0.9191138516900578j),
-	(0.38268343236508984-0.9238795325112867j),
-	(0.3713171939518376-0.9285060804732155j),
-	(0.3598950365349883-0.9329927988347388j),
-	(0.3484186802494345-0.937339011912575j),
-	(0.33688985339222005-0.9415440651830208j),
-	(0.325310292162263-0.9456073253805213j),
-	(0.3136817403988916-0.9495281805930367j),
-	(0.3020059493192282-0.9533060403541938j),
-	(0.29028467725446233-0.9569403357322089j),
-	(0.27851968938505306-0.9604305194155658j),
-	(0.2667127574748984-0.9637760657954398j),
-	(0.2548656596045146-0.9669764710448521j),
-	(0.24298017990326398-0.970031253194544j),
-	(0.23105810828067128-0.9729399522055601j),
-	(0.21910124015686977-0.9757021300385286j),
-	(0.20711137619221856-0.9783173707196277j),
-	(0.19509032201612833-0.9807852804032304j),
-	(0.18303988795514106-0.9831054874312163j),
-	(0.17096188876030136-0.9852776423889412j),
-	(0.1588581433338614-0.9873014181578584j),
-	(0.14673047445536175-0.989176509964781j),
-	(0.13458070850712622-0.99090263542778j),
-	(0.12241067519921628-0.99247953459871j),
-	(0.11022220729388318-0.9939069700023561j),
-	(0.09801714032956077-0.9951847266721968j),
-	(0.08579731234443988-0.996312612182778j),
-	(0.07356456359966745-0.9972904566786902j),
-	(0.06132073630220865-0.9981181129001492j),
-	(0.049067674327418126-0.9987954562051724j),
-	(0.03680722294135899-0.9993223845883495j),
-	(0.024541228522912264-0.9996988186962042j),
-	(0.012271538285719944-0.9999247018391445j),
-	(6.123233995736766e-17-1j),
-	(-0.012271538285719823-0.9999247018391445j),
-	(-0.024541228522912142-0.9996988186962042j),
-	(-0.036807222941358866-0.9993223845883495j),
-	(-0.04906767432741801-0.9987954562051724j),
-	(-0.06132073630220853-0.9981181129001492j),
-	(-0.07356456359966733-0.9972904566786902j),
-	(-0.08579731234443976-0.996312612182778j),
-	(-0.09801714032956065-0.9951847266721969j),
-	(-0.11022220729388306-0.9939069700023561j),
-	(-0.12241067519921615-0.99247953459871j),
-	(-0.1345807085071261-0.99090263542778j),
-	(-0.14673047445536164-0.989176509964781j),
-	(-0.15885814333386128-0.9873014181578584j),
-	(-0.17096188876030124-0.9852776423889412j),
-	(-0.18303988795514092-0.9831054874312163j),
-	(-0.1950903220161282-0.9807852804032304j),
-	(-0.20711137619221845-0.9783173707196277j),
-	(-0.21910124015686966-0.9757021300385286j),
-	(-0.23105810828067114-0.9729399522055602j),
-	(-0.24298017990326387-0.970031253194544j),
-	(-0.2548656596045145-0.9669764710448521j),
-	(-0.2667127574748983-0.9637760657954398j),
-	(-0.27851968938505295-0.9604305194155659j),
-	(-0.29028467725446216-0.9569403357322089j),
-	(-0.3020059493192281-0.9533060403541939j),
-	(-0.3136817403988914-0.9495281805930367j),
-	(-0.32531029216226287-0.9456073253805214j),
-	(-0.33688985339221994-0.9415440651830208j),
-	(-0.3484186802494344-0.937339011912575j),
-	(-0.35989503653498817-0.9329927988347388j),
-	(-0.3713171939518375-0.9285060804732156j),
-	(-0.3826834323650897-0.9238795325112867j),
-	(-0.393992040061048-0.9191138516900578j),
-	(-0.40524131400498975-0.9142097557035307j),
-	(-0.416429560097637-0.9091679830905225j),
-	(-0.42755509343028186-0.9039892931234434j),
-	(-0.4386162385385274-0.8986744656939539j),
-	(-0.4496113296546067-0.8932243011955152j),
-	(-0.46053871095824006-0.8876396204028539j),
-	(-0.4713967368259977-0.881921264348355j),
-	(-0.4821837720791227-0.8760700941954066j),
-	(-0.492898192229784-0.8700869911087115j),
-	(-0.5035383837257175-0.8639728561215868j),
-	(-0.5141027441932217-0.8577286100002721j),
-	(-0.5245896826784687-0.8513551931052652j),
-	(-0.534997619887097-0.8448535652497072j),
-	(-0.5453249884220462-0.8382247055548382j),
-	(-0.555570233019602-0.8314696123025455j),
-	(-0.5657318107836132-0.8245893027850252j),
-	(-0.5758081914178453-0.8175848131515837j),
-	(-0.5857978574564389-0.8104571982525948j),
-	(-0.5956993044924334-0.8032075314806449j),
-	(-0.6055110414043254-0.7958369046088836j),
-	(-0.6152315905806267-0.7883464276266063j),
-	(-0.6248594881423862-0.7807372285720946j),
-	(-0.6343932841636454-0.7730104533627371j),
-	(-0.6438315428897913-0.7651672656224591j),
-	(-0.6531728429537765-0.7572088465064847j),
-	(-0.6624157775901719-0.7491363945234593j),
-	(-0.6715589548470184-0.740951125354959j),
-	(-0.680600997795453-0.7326542716724128j),
-	(-0.6895405447370669-0.7242470829514669j),
-	(-0.6983762494089728-0.7157308252838187j),
-	(-0.7071067811865475-0.7071067811865476j),
-	(-0.7157308252838186-0.6983762494089729j),
-	(-0.7242470829514668-0.689540544737067j),
-	(-0.7326542716724127-0.6806009977954532j),
-	(-0.7409511253549589-0.6715589548470186j),
-	(-0.7491363945234591-0.662415777590172j),
-	(-0.7572088465064846-0.6531728429537766j),
-	(-0.765167265622459-0.6438315428897914j),
-	(-0.773010453362737-0.6343932841636455j),
-	(-0.7807372285720945-0.6248594881423863j),
-	(-0.7883464276266062-0.6152315905806269j),
-	(-0.7958369046088835-0.6055110414043257j),
-	(-0.8032075314806448-0.5956993044924335j),
-	(-0.8104571982525947-0.585797857456439j),
-	(-0.8175848131515836-0.5758081914178454j),
-	(-0.8245893027850251-0.5657318107836135j),
-	(-0.8314696123025453-0.5555702330196022j),
-	(-0.8382247055548381-0.5453249884220464j),
-	(-0.8448535652497071-0.5349976198870972j),
-	(-0.8513551931052652-0.524589682678469j),
-	(-0.857728610000272-0.5141027441932218j),
-	(-0.8639728561215867-0.5035383837257177j),
-	(-0.8700869911087113-0.49289819222978415j),
-	(-0.8760700941954065-0.4821837720791229j),
-	(-0.8819212643483549-0.47139673682599786j),
-	(-0.8876396204028538-0.4605387109582402j),
-	(-0.8932243011955152-0.4496113296546069j),
-	(-0.8986744656939539-0.43861623853852755j),
-	(-0.9039892931234433-0.42755509343028203j),
-	(-0.9091679830905224-0.41642956009763715j),
-	(-0.9142097557035307-0.4052413140049899j),
-	(-0.9191138516900578-0.39399204006104815j),
-	(-0.9238795325112867-0.3826834323650899j),
-	(-0.9285060804732155-0.3713171939518377j),
-	(-0.9329927988347388-0.35989503653498833j),
-	(-0.9373390119125748-0.3484186802494348j),
-	(-0.9415440651830207-0.33688985339222033j),
-	(-0.9456073253805212-0.32531029216226326j),
-	(-0.9495281805930367-0.3136817403988914j),
-	(-0.9533060403541939-0.30200594931922803j),
-	(-0.9569403357322088-0.2902846772544624j),
-	(-0.9604305194155658-0.27851968938505317j),
-	(-0.9637760657954398-0.2667127574748985j),
-	(-0.9669764710448521-0.2548656596045147j),
-	(-0.970031253194544-0.24298017990326407j),
-	(-0.9729399522055601-0.23105810828067133j),
-	(-0.9757021300385285-0.21910124015687005j),
-	(-0.9783173707196275-0.20711137619221884j),
-	(-0.9807852804032304-0.1950903220161286j),
-	(-0.9831054874312163-0.1830398879551409j),
-	(-0.9852776423889412-0.17096188876030122j),
-	(-0.9873014181578584-0.15885814333386147j),
-	(-0.989176509964781-0.1467304744553618j),
-	(-0.99090263542778-0.13458070850712628j),
-	(-0.99247953459871-0.12241067519921635j),
-	(-0.9939069700023561-0.11022220729388324j),
-	(-0.9951847266721968-0.09801714032956083j),
-	(-0.996312612182778-0.08579731234444016j),
-	(-0.9972904566786902-0.07356456359966773j),
-	(-0.9981181129001492-0.06132073630220849j),
-	(-0.9987954562051724-0.049067674327417966j),
-	(-0.9993223845883495-0.03680722294135883j),
-	(-0.9996988186962042-0.024541228522912326j),
-	(-0.9999247018391445-0.012271538285720007j),
-};
-
-const double complex W₁₀₂₄²[512] =
-{
-	(1+0j),
-	(0.9999811752826011-0.006135884649154475j),
-	(0.9999247018391445-0.012271538285719925j),
-	(0.9998305817958234-0.01840672990580482j),
-	(0.9996988186962042-0.024541228522912288j),
-	(0.9995294175010931-0.030674803176636626j),
-	(0.9993223845883495-0.03680722294135883j),
-	(0.9990777277526454-0.04293825693494082j),
-	(0.9987954562051724-0.049067674327418015j),
-	(0.9984755805732948-0.055195244349689934j),
-	(0.9981181129001492-0.06132073630220858j),
-	(0.9977230666441916-0.06744391956366405j),
-	(0.9972904566786902-0.07356456359966743j),
-	(0.9968202992911657-0.07968243797143013j),
-	(0.996312612182778-0.0857973123444399j),
-	(0.9957674144676598-0.09190895649713272j),
-	(0.9951847266721969-0.0980171403295606j),
-	(0.9945645707342554-0.10412163387205459j),
-	(0.9939069700023561-0.11022220729388306j),
-	(0.9932119492347945-0.11631863091190475j),
-	(0.99247953459871-0.1224106751992162j),
-	(0.9917097536690995-0.12849811079379317j),
-	(0.99090263542778-0.13458070850712617j),
-	(0.9900582102622971-0.1406582393328492j),
-	(0.989176509964781-0.14673047445536175j),
-	(0.9882575677307495-0.15279718525844344j),
-	(0.9873014181578584-0.15885814333386145j),
-	(0.9863080972445987-0.16491312048996992j),
-	(0.9852776423889412-0.17096188876030122j),
-	(0.984210092386929-0.17700422041214875j),
-	(0.9831054874312163-0.18303988795514095j),
-	(0.9819638691095552-0.1890686641498062j),
-	(0.9807852804032304-0.19509032201612825j),
-	(0.9795697656854405-0.2011046348420919j),
-	(0.9783173707196277-0.20711137619221856j),
-	(0.9770281426577544-0.21311031991609136j),
-	(0.9757021300385286-0.2191012401568698j),
-	(0.9743393827855759-0.22508391135979283j),
-	(0.9729399522055602-0.2310581082806711j),
-	(0.9715038909862518-0.2370236059943672j),
-	(0.970031253194544-0.24298017990326387j),
-	(0.9685220942744174-0.24892760574572015j),
-	(0.9669764710448521-0.25486565960451457j),
-	(0.9653944416976894-0.2607941179152755j),
-	(0.9637760657954398-0.26671275747489837j),
-	(0.9621214042690416-0.272621355449949j),
-	(0.9604305194155658-0.27851968938505306j),
-	(0.9587034748958716-0.2844075372112719j),
-	(0.9569403357322088-0.29028467725446233j),
-	(0.9551411683057708-0.2961508882436238j),
-	(0.9533060403541939-0.3020059493192281j),
-	(0.9514350209690083-0.30784964004153487j),
-	(0.9495281805930367-0.3136817403988915j),
-	(0.9475855910177411-0.3195020308160157j),
-	(0.9456073253805213-0.3253102921622629j),
-	(0.9435934581619604-0.33110630575987643j),
-	(0.9415440651830208-0.33688985339222005j),
-	(0.9394592236021899-0.3426607173119944j),
-	(0.937339011912575-0.34841868024943456j),
-	(0.9351835099389476-0.35416352542049034j),
-	(0.932992798834739-0.3598950365349881j),
-	(0.9307669610789837-0.36561299780477385j),
-	(0.9285060804732156-0.37131719395183754j),
-	(0.9262102421383114-0.37700741021641826j),
-	(0.9238795325112867-0.3826834323650898j),
-	(0.921514039342042-0.38834504669882625j),
-	(0.9191138516900578-0.3939920400610481j),
-	(0.9166790599210427-0.3996241998456468j),
-	(0.9142097557035307-0.40524131400498986j),
-	(0.9117060320054299-0.4108431710579039j),
-	(0.9091679830905224-0.41642956009763715j),
-	(0.9065957045149153-0.4220002707997997j),
-	(0.9039892931234433-0.4275550934302821j),
-	(0.901348847046022-0.43309381885315196j),
-	(0.8986744656939538-0.43861623853852766j),
-	(0.8959662497561852-0.4441221445704292j),
-	(0.8932243011955153-0.44961132965460654j),
-	(0.8904487232447579-0.45508358712634384j),
-	(0.8876396204028539-0.46053871095824j),
-	(0.8847970984309378-0.4659764957679662j),
-	(0.881921264348355-0.47139673682599764j),
-	(0.8790122264286335-0.4767992300633221j),
-	(0.8760700941954066-0.4821837720791227j),
-	(0.8730949784182901-0.487550160148436j),
-	(0.8700869911087115-0.49289819222978404j),
-	(0.8670462455156926-0.49822766697278187j),
-	(0.8639728561215868-0.5035383837257176j),
-	(0.8608669386377673-0.508830142543107j),
-	(0.8577286100002721-0.5141027441932217j),
-	(0.8545579883654005-0.5193559901655896j),
-	(0.8513551931052652-0.524589682678469j),
-	(0.8481203448032972-0.5298036246862946j),
-	(0.8448535652497071-0.5349976198870972j),
-	(0.8415549774368984-0.5401714727298929j),
-	(0.8382247055548381-0.5453249884220465j),
-	(0.83486287498638-0.5504579729366048j),
-	(0.8314696123025452-0.5555702330196022j),
-	(0.8280450452577558-0.560661576197336j),
-	(0.8245893027850253-0.5657318107836131j),
-	(0.8211025149911046-0.5707807458869673j),
-	(0.8175848131515837-0.5758081914178453j),
-	(0.8140363297059484-0.5808139580957645j),
-	(0.8104571982525948-0.5857978574564389j),
-	(0.8068475535437993-0.5907597018588742j),
-	(0.8032075314806449-0.5956993044924334j),
-	(0.799537269107905-0.600616479383869j),
-	(0.7958369046088836-0.6055110414043255j),
-	(0.7921065773002124-0.6103828062763095j),
-	(0.7883464276266063-0.6152315905806268j),
-	(0.7845565971555752-0.6200572117632891j),
-	(0.7807372285720945-0.6248594881423863j),
-	(0.7768884656732324-0.629638238914927j),
-	(0.773010453362737-0.6343932841636455j),
-	(0.7691033376455797-0.6391244448637757j),
-	(0.765167265622459-0.6438315428897914j),
-	(0.7612023854842618-0.6485144010221124j),
-	(0.7572088465064846-0.6531728429537768j),
-	(0.7531867990436125-0.6578066932970786j),
-	(0.7491363945234594-0.6624157775901718j),
-	(0.7450577854414661-0.6669999223036375j),
-	(0.7409511253549591-0.6715589548470183j),
-	(0.7368165688773699-0.6760927035753159j),
-	(0.7326542716724128-0.680600997795453j),
-	(0.7284643904482252-0.6850836677727004j),
-	(0.724247082951467-0.6895405447370668j),
-	(0.7200025079613817-0.693971460889654j),
-	(0.7157308252838186-0.6983762494089729j),
-	(0.7114321957452164-0.7027547444572253j),
-	(0.7071067811865476-0.7071067811865475j),
-	(0.7027547444572253-0.7114321957452164j),
-	(0.6983762494089729-0.7157308252838186j),
-	(0.693971460889654-0.7200025079613817j),
-	(0.6895405447370669-0.7242470829514669j),
-	(0.6850836677727004-0.7284643904482252j),
-	(0.6806009977954531-0.7326542716724128j),
-	(0.676092703575316-0.7368165688773698j),
-	(0.6715589548470183-0.7409511253549591j),
-	(0.6669999223036375-0.745057785441466j),
-	(0.6624157775901718-0.7491363945234593j),
-	(0.6578066932970786-0.7531867990436124j),
-	(0.6531728429537768-0.7572088465064845j),
-	(0.6485144010221126-0.7612023854842618j),
-	(0.6438315428897915-0.765167265622459j),
-	(0.6391244448637757-0.7691033376455796j),
-	(0.6343932841636455-0.773010453362737j),
-	(0.6296382389149271-0.7768884656732324j),
-	(0.6248594881423865-0.7807372285720944j),
-	(0.6200572117632892-0.7845565971555752j),
-	(0.6152315905806268-0.7883464276266062j),
-	(0.6103828062763095-0.7921065773002124j),
-	(0.6055110414043255-0.7958369046088835j),
-	(0.600616479383869-0.799537269107905j),
-	(0.5956993044924335-0.8032075314806448j),
-	(0.5907597018588743-0.8068475535437992j),
-	(0.5857978574564389-0.8104571982525948j),
-	(0.5808139580957645-0.8140363297059483j),
-	(0.5758081914178453-0.8175848131515837j),
-	(0.5707807458869674-0.8211025149911046j),
-	(0.5657318107836132-0.8245893027850253j),
-	(0.560661576197336-0.8280450452577558j),
-	(0.5555702330196023-0.8314696123025452j),
-	(0.5504579729366048-0.83486287498638j),
-	(0.5453249884220465-0.838224705554838j),
-	(0.540171472729893-0.8415549774368983j),
-	(0.5349976198870973-0.844853565249707j),
-	(0.5298036246862948-0.8481203448032971j),
-	(0.5245896826784688-0.8513551931052652j),
-	(0.5193559901655895-0.8545579883654005j),
-	(0.5141027441932217-0.8577286100002721j),
-	(0.508830142543107-0.8608669386377673j),
-	(0.5035383837257176-0.8639728561215867j),
-	(0.49822766697278187-0.8670462455156926j),
-	(0.4928981922297841-0.8700869911087113j),
-	(0.48755016014843605-0.8730949784182901j),
-	(0.48218377207912283-0.8760700941954066j),
-	(0.47679923006332225-0.8790122264286334j),
-	(0.4713967368259978-0.8819212643483549j),
-	(0.4659764957679661-0.8847970984309378j),
-	(0.46053871095824-0.8876396204028539j),
-	(0.45508358712634384-0.8904487232447579j),
-	(0.4496113296546066-0.8932243011955153j),
-	(0.44412214457042926-0.8959662497561851j),
-	(0.4386162385385277-0.8986744656939538j),
-	(0.433093818853152-0.901348847046022j),
-	(0.4275550934302822-0.9039892931234433j),
-	(0.4220002707997998-0.9065957045149153j),
-	(0.4164295600976373-0.9091679830905223j),
-	(0.4108431710579039-0.9117060320054299j),
-	(0.40524131400498986-0.9142097557035307j),
-	(0.3996241998456468-0.9166790599210427j),
-	(0.3939920400610481-0.9191138516900578j),
-	(0.3883450466988263-0.9215140393420419j),
-	(0.38268343236508984-0.9238795325112867j),
-	(0.3770074102164183-0.9262102421383113j),
-	(0.3713171939518376-0.9285060804732155j),
-	(0.36561299780477396-0.9307669610789837j),
-	(0.3598950365349883-0.9329927988347388j),
-	(0.3541635254204905-0.9351835099389475j),
-	(0.3484186802494345-0.937339011912575j),
-	(0.3426607173119944-0.9394592236021899j),
-	(0.33688985339222005-0.9415440651830208j),
-	(0.33110630575987643-0.9435934581619604j),
-	(0.325310292162263-0.9456073253805213j),
-	(0.31950203081601575-0.9475855910177411j),
-	(0.3136817403988916-0.9495281805930367j),
-	(0.307849640041535-0.9514350209690083j),
-	(0.3020059493192282-0.9533060403541938j),
-	(0.29615088824362396-0.9551411683057707j),
-	(0.29028467725446233-0.9569403357322089j),
-	(0.2844075372112718-0.9587034748958716j),
-	(0.27851968938505306-0.9604305194155658j),
-	(0.272621355449949-0.9621214042690416j),
-	(0.2667127574748984-0.9637760657954398j),
-	(0.26079411791527557-0.9653944416976894j),
-	(0.2548656596045146-0.9669764710448521j),
-	(0.24892760574572026-0.9685220942744173j),
-	(0.24298017990326398-0.970031253194544j),
-	(0.23702360599436734-0.9715038909862518j),
-	(0.23105810828067128-0.9729399522055601j),
-	(0.22508391135979278-0.9743393827855759j),
-	(0.21910124015686977-0.9757021300385286j),
-	(0.21311031991609136-0.9770281426577544j),
-	(0.20711137619221856-0.9783173707196277j),
-	(0.20110463484209196-0.9795697656854405j),
-	(0.19509032201612833-0.9807852804032304j),
-	(0.18906866414980628-0.9819638691095552j),
-	(0.18303988795514106-0.9831054874312163j),
-	(0.17700422041214886-0.984210092386929j),
-	(0.17096188876030136-0.9852776423889412j),
-	(0.1649131204899701-0.9863080972445987j),
-	(0.1588581433338614-0.9873014181578584j),
-	(0.1527971852584434-0.9882575677307495j),
-	(0.14673047445536175-0.989176509964781j),
-	(0.14065823933284924-0.9900582102622971j),
-	(0.13458070850712622-0.99090263542778j),
-	(0.12849811079379322-0.9917097536690995j),
-	(0.12241067519921628-0.99247953459871j),
-	(0.11631863091190488-0.9932119492347945j),
-	(0.11022220729388318-0.9939069700023561j),
-	(0.10412163387205473-0.9945645707342554j),
-	(0.09801714032956077-0.9951847266721968j),
-	(0.0919089564971327-0.9957674144676598j),
-	(0.08579731234443988-0.996312612182778j),
-	(0.07968243797143013-0.9968202992911657j),
-	(0.07356456359966745-0.9972904566786902j),
-	(0.0674439195636641-0.9977230666441916j),
-	(0.06132073630220865-0.9981181129001492j),
-	(0.05519524434969003-0.9984755805732948j),
-	(0.049067674327418126-0.9987954562051724j),
-	(0.04293825693494096-0.9990777277526454j),
-	(0.03680722294135899-0.9993223845883495j),
-	(0.03067480317663658-0.9995294175010931j),
-	(0.024541228522912264-0.9996988186962042j),
-	(0.01840672990580482-0.9998305817958234j),
-	(0.012271538285719944-0.9999247018391445j),
-	(0.006135884649154515-0.9999811752826011j),
-	(6.123233995736766e-17-1j),
-	(-0.006135884649154393-0.9999811752826011j),
-	(-0.012271538285719823-0.9999247018391445j),
-	(-0.018406729905804695-0.9998305817958234j),
-	(-0.024541228522912142-0.9996988186962042j),
-	(-0.03067480317663646-0.9995294175010931j),
-	(-0.036807222941358866-0.9993223845883495j),
-	(-0.042938256934940834-0.9990777277526454j),
-	(-0.04906767432741801-0.9987954562051724j),
-	(-0.05519524434968991-0.9984755805732948j),
-	(-0.06132073630220853-0.9981181129001492j),
-	(-0.06744391956366398-0.9977230666441916j),
-	(-0.07356456359966733-0.9972904566786902j),
-	(-0.07968243797143001-0.9968202992911658j),
-	(-0.08579731234443976-0.996312612182778j),
-	(-0.09190895649713257-0.9957674144676598j),
-	(-0.09801714032956065-0.9951847266721969j),
-	(-0.1041216338720546-0.9945645707342554j),
-	(-0.11022220729388306-0.9939069700023561j),
-	(-0.11631863091190475-0.9932119492347945j),
-	(-0.12241067519921615-0.99247953459871j),
-	(-0.1284981107937931-0.9917097536690995j),
-	(-0.1345807085071261-0.99090263542778j),
-	(-0.14065823933284913-0.9900582102622971j),
-	(-0.14673047445536164-0.989176509964781j),
-	(-0.1527971852584433-0.9882575677307495j),
-	(-0.15885814333386128-0.9873014181578584j),
-	(-0.16491312048996995-0.9863080972445987j),
-	(-0.17096188876030124-0.9852776423889412j),
-	(-0.17700422041214875-0.984210092386929j),
-	(-0.18303988795514092-0.9831054874312163j),
-	(-0.18906866414980616-0.9819638691095552j),
-	(-0.1950903220161282-0.9807852804032304j),
-	(-0.20110463484209182-0.9795697656854405j),
-	(-0.20711137619221845-0.9783173707196277j),
-	(-0.21311031991609125-0.9770281426577544j),
-	(-0.21910124015686966-0.9757021300385286j),
-	(-0.22508391135979267-0.9743393827855759j),
-	(-0.23105810828067114-0.9729399522055602j),
-	(-0.23702360599436723-0.9715038909862518j),
-	(-0.24298017990326387-0.970031253194544j),
-	(-0.24892760574572012-0.9685220942744174j),
-	(-0.2548656596045145-0.9669764710448521j),
-	(-0.26079411791527546-0.9653944416976894j),
-	(-0.2667127574748983-0.9637760657954398j),
-	(-0.27262135544994887-0.9621214042690416j),
-	(-0.27851968938505295-0.9604305194155659j),
-	(-0.2844075372112717-0.9587034748958716j),
-	(-0.29028467725446216-0.9569403357322089j),
-	(-0.29615088824362384-0.9551411683057707j),
-	(-0.3020059493192281-0.9533060403541939j),
-	(-0.30784964004153487-0.9514350209690083j),
-	(-0.3136817403988914-0.9495281805930367j),
-	(-0.31950203081601564-0.9475855910177412j),
-	(-0.32531029216226287-0.9456073253805214j),
-	(-0.3311063057598763-0.9435934581619604j),
-	(-0.33688985339221994-0.9415440651830208j),
-	(-0.34266071731199427-0.9394592236021899j),
-	(-0.3484186802494344-0.937339011912575j),
-	(-0.3541635254204904-0.9351835099389476j),
-	(-0.35989503653498817-0.9329927988347388j),
-	(-0.36561299780477385-0.9307669610789837j),
-	(-0.3713171939518375-0.9285060804732156j),
-	(-0.3770074102164182-0.9262102421383114j),
-	(-0.3826834323650897-0.9238795325112867j),
-	(-0.3883450466988262-0.921514039342042j),
-	(-0.393992040061048-0.9191138516900578j),
-	(-0.3996241998456467-0.9166790599210427j),
-	(-0.40524131400498975-0.9142097557035307j),
-	(-0.4108431710579038-0.9117060320054299j),
-	(-0.416429560097637-0.9091679830905225j),
-	(-0.4220002707997997-0.9065957045149153j),
-	(-0.42755509343028186-0.9039892931234434j),
-	(-0.4330938188531519-0.901348847046022j),
-	(-0.4386162385385274-0.8986744656939539j),
-	(-0.44412214457042914-0.8959662497561852j),
-	(-0.4496113296546067-0.8932243011955152j),
-	(-0.4550835871263437-0.890448723244758j),
-	(-0.46053871095824006-0.8876396204028539j),
-	(-0.465976495767966-0.8847970984309379j),
-	(-0.4713967368259977-0.881921264348355j),
-	(-0.4767992300633219-0.8790122264286335j),
-	(-0.4821837720791227-0.8760700941954066j),
-	(-0.4875501601484357-0.8730949784182902j),
-	(-0.492898192229784-0.8700869911087115j),
-	(-0.4982276669727816-0.8670462455156928j),
-	(-0.5035383837257175-0.8639728561215868j),
-	(-0.5088301425431071-0.8608669386377672j),
-	(-0.5141027441932217-0.8577286100002721j),
-	(-0.5193559901655896-0.8545579883654005j),
-	(-0.5245896826784687-0.8513551931052652j),
-	(-0.5298036246862947-0.8481203448032972j),
-	(-0.534997619887097-0.8448535652497072j),
-	(-0.5401714727298929-0.8415549774368984j),
-	(-0.5453249884220462-0.8382247055548382j),
-	(-0.5504579729366047-0.8348628749863801j),
-	(-0.555570233019602-0.8314696123025455j),
-	(-0.5606615761973359-0.8280450452577558j),
-	(-0.5657318107836132-0.8245893027850252j),
-	(-0.5707807458869671-0.8211025149911048j),
-	(-0.5758081914178453-0.8175848131515837j),
-	(-0.5808139580957644-0.8140363297059485j),
-	(-0.5857978574564389-0.8104571982525948j),
-	(-0.590759701858874-0.8068475535437994j),
-	(-0.5956993044924334-0.8032075314806449j),
-	(-0.6006164793838688-0.7995372691079052j),
-	(-0.6055110414043254-0.7958369046088836j),
-	(-0.6103828062763096-0.7921065773002123j),
-	(-0.6152315905806267-0.7883464276266063j),
-	(-0.6200572117632892-0.7845565971555751j),
-	(-0.6248594881423862-0.7807372285720946j),
-	(-0.6296382389149271-0.7768884656732324j),
-	(-0.6343932841636454-0.7730104533627371j),
-	(-0.6391244448637757-0.7691033376455796j),
-	(-0.6438315428897913-0.7651672656224591j),
-	(-0.6485144010221124-0.7612023854842619j),
-	(-0.6531728429537765-0.7572088465064847j),
-	(-0.6578066932970786-0.7531867990436125j),
-	(-0.6624157775901719-0.7491363945234593j),
-	(-0.6669999223036374-0.7450577854414661j),
-	(-0.6715589548470184-0.740951125354959j),
-	(-0.6760927035753158-0.73681656887737j),
-	(-0.680600997795453-0.7326542716724128j),
-	(-0.6850836677727002-0.7284643904482253j),
-	(-0.6895405447370669-0.7242470829514669j),
-	(-0.6939714608896538-0.7200025079613818j),
-	(-0.6983762494089728-0.7157308252838187j),
-	(-0.7027547444572251-0.7114321957452167j),
-	(-0.7071067811865475-0.7071067811865476j),
-	(-0.7114321957452165-0.7027547444572252j),
-	(-0.7157308252838186-0.6983762494089729j),
-	(-0.7200025079613817-0.693971460889654j),
-	(-0.7242470829514668-0.689540544737067j),
-	(-0.7284643904482252-0.6850836677727004j),
-	(-0.7326542716724127-0.6806009977954532j),
-	(-0.7368165688773699-0.6760927035753159j),
-	(-0.7409511253549589-0.6715589548470186j),
-	(-0.745057785441466-0.6669999223036376j),
-	(-0.7491363945234591-0.662415777590172j),
-	(-0.7531867990436124-0.6578066932970787j),
-	(-0.7572088465064846-0.6531728429537766j),
-	(-0.7612023854842617-0.6485144010221126j),
-	(-0.765167265622459-0.6438315428897914j),
-	(-0.7691033376455795-0.6391244448637758j),
-	(-0.773010453362737-0.6343932841636455j),
-	(-0.7768884656732323-0.6296382389149272j),
-	(-0.7807372285720945-0.6248594881423863j),
-	(-0.784556597155575-0.6200572117632894j),
-	(-0.7883464276266062-0.6152315905806269j),
-	(-0.7921065773002122-0.6103828062763097j),
-	(-0.7958369046088835-0.6055110414043257j),
-	(-0.7995372691079051-0.6006164793838689j),
-	(-0.8032075314806448-0.5956993044924335j),
-	(-0.8068475535437993-0.5907597018588742j),
-	(-0.8104571982525947-0.585797857456439j),
-	(-0.8140363297059484-0.5808139580957645j),
-	(-0.8175848131515836-0.5758081914178454j),
-	(-0.8211025149911046-0.5707807458869673j),
-	(-0.8245893027850251-0.5657318107836135j),
-	(-0.8280450452577557-0.5606615761973361j),
-	(-0.8314696123025453-0.5555702330196022j),
-	(-0.83486287498638-0.5504579729366049j),
-	(-0.8382247055548381-0.5453249884220464j),
-	(-0.8415549774368983-0.540171472729893j),
-	(-0.8448535652497071-0.5349976198870972j),
-	(-0.8481203448032971-0.5298036246862948j),
-	(-0.8513551931052652-0.524589682678469j),
-	(-0.8545579883654004-0.5193559901655898j),
-	(-0.857728610000272-0.5141027441932218j),
-	(-0.8608669386377671-0.5088301425431073j),
-	(-0.8639728561215867-0.5035383837257177j),
-	(-0.8670462455156928-0.49822766697278176j),
-	(-0.8700869911087113-0.49289819222978415j),
-	(-0.8730949784182901-0.4875501601484359j),
-	(-0.8760700941954065-0.4821837720791229j),
-	(-0.8790122264286335-0.4767992300633221j),
-	(-0.8819212643483549-0.47139673682599786j),
-	(-0.8847970984309378-0.4659764957679662j),
-	(-0.8876396204028538-0.4605387109582402j),
-	(-0.8904487232447579-0.4550835871263439j),
-	(-0.8932243011955152-0.4496113296546069j),
-	(-0.8959662497561851-0.4441221445704293j),
-	(-0.8986744656939539-0.43861623853852755j),
-	(-0.9013488470460219-0.43309381885315207j),
-	(-0.9039892931234433-0.42755509343028203j),
-	(-0.9065957045149153-0.42200027079979985j),
-	(-0.9091679830905224-0.41642956009763715j),
-	(-0.9117060320054298-0.41084317105790413j),
-	(-0.9142097557035307-0.4052413140049899j),
-	(-0.9166790599210426-0.39962419984564707j),
-	(-0.9191138516900578-0.39399204006104815j),
-	(-0.9215140393420418-0.3883450466988266j),
-	(-0.9238795325112867-0.3826834323650899j),
-	(-0.9262102421383114-0.37700741021641815j),
-	(-0.9285060804732155-0.3713171939518377j),
-	(-0.9307669610789837-0.3656129978047738j),
-	(-0.9329927988347388-0.35989503653498833j),
-	(-0.9351835099389476-0.3541635254204904j),
-	(-0.9373390119125748-0.3484186802494348j),
-	(-0.9394592236021899-0.34266071731199443j),
-	(-0.9415440651830207-0.33688985339222033j),
-	(-0.9435934581619604-0.3311063057598765j),
-	(-0.9456073253805212-0.32531029216226326j),
-	(-0.9475855910177411-0.3195020308160158j),
-	(-0.9495281805930367-0.3136817403988914j),
-	(-0.9514350209690083-0.30784964004153503j),
-	(-0.9533060403541939-0.30200594931922803j),
-	(-0.9551411683057707-0.296150888243624j),
-	(-0.9569403357322088-0.2902846772544624j),
-	(-0.9587034748958715-0.2844075372112721j),
-	(-0.9604305194155658-0.27851968938505317j),
-	(-0.9621214042690415-0.27262135544994925j),
-	(-0.9637760657954398-0.2667127574748985j),
-	(-0.9653944416976893-0.26079411791527585j),
-	(-0.9669764710448521-0.2548656596045147j),
-	(-0.9685220942744174-0.2489276057457201j),
-	(-0.970031253194544-0.24298017990326407j),
-	(-0.9715038909862518-0.23702360599436717j),
-	(-0.9729399522055601-0.23105810828067133j),
-	(-0.9743393827855759-0.22508391135979283j),
-	(-0.9757021300385285-0.21910124015687005j),
-	(-0.9770281426577544-0.21311031991609142j),
-	(-0.9783173707196275-0.20711137619221884j),
-	(-0.9795697656854405-0.201104634842092j),
-	(-0.9807852804032304-0.1950903220161286j),
-	(-0.9819638691095552-0.18906866414980636j),
-	(-0.9831054874312163-0.1830398879551409j),
-	(-0.984210092386929-0.17700422041214894j),
-	(-0.9852776423889412-0.17096188876030122j),
-	(-0.9863080972445986-0.16491312048997014j),
-	(-0.9873014181578584-0.15885814333386147j),
-	(-0.9882575677307495-0.15279718525844369j),
-	(-0.989176509964781-0.1467304744553618j),
-	(-0.990058210262297-0.14065823933284954j),
-	(-0.99090263542778-0.13458070850712628j),
-	(-0.9917097536690995-0.12849811079379309j),
-	(-0.99247953459871-0.12241067519921635j),
-	(-0.9932119492347945-0.11631863091190471j),
-	(-0.9939069700023561-0.11022220729388324j),
-	(-0.9945645707342554-0.10412163387205457j),
-	(-0.9951847266721968-0.09801714032956083j),
-	(-0.9957674144676598-0.09190895649713275j),
-	(-0.996312612182778-0.08579731234444016j),
-	(-0.9968202992911657-0.0796824379714302j),
-	(-0.9972904566786902-0.07356456359966773j),
-	(-0.9977230666441916-0.06744391956366418j),
-	(-0.9981181129001492-0.06132073630220849j),
-	(-0.9984755805732948-0.055195244349690094j),
-	(-0.9987954562051724-0.049067674327417966j),
-	(-0.9990777277526454-0.04293825693494102j),
-	(-0.9993223845883495-0.03680722294135883j),
-	(-0.9995294175010931-0.030674803176636865j),
-	(-0.9996988186962042-0.024541228522912326j),
-	(-0.9998305817958234-0.0184067299058051j),
-	(-0.9999247018391445-0.012271538285720007j),
-	(-0.9999811752826011-0.006135884649154799j),
-};
-
-const double complex W₂₀₄₈²[1024] =
-{
-	(1+0j),
-	(0.9999952938095762-0.003067956762965976j),
-	(0.9999811752826011-0.006135884649154475j),
-	(0.9999576445519639-0.00920375478205982j),
-	(0.9999247018391445-0.012271538285719925j),
-	(0.9998823474542126-0.0153392062849881j),
-	(0.9998305817958234-0.01840672990580482j),
-	(0.9997694053512153-0.021474080275469508j),
-	(0.9996988186962042-0.024541228522912288j),
-	(0.9996188224951786-0.02760814577896574j),
-	(0.9995294175010931-0.030674803176636626j),
-	(0.9994306045554617-0.03374117185137758j),
-	(0.9993223845883495-0.03680722294135883j),
-	(0.9992047586183639-0.03987292758773981j),
-	(0.9990777277526454-0.04293825693494082j),
-	(0.9989412931868569-0.04600318213091462j),
-	(0.9987954562051724-0.049067674327418015j),
-	(0.9986402181802653-0.052131704680283324j),
-	(0.9984755805732948-0.055195244349689934j),
-	(0.9983015449338929-0.05825826450043575j),
-	(0.9981181129001492-0.06132073630220858j),
-	(0.997925286198596-0.06438263092985747j),
-	(0.9977230666441916-0.06744391956366405j),
-	(0.9975114561403035-0.07050457338961386j),
-	(0.9972904566786902-0.07356456359966743j),
-	(0.997060070339483-0.07662386139203149j),
-	(0.9968202992911657-0.07968243797143013j),
-	(0.9965711457905548-0.08274026454937569j),
-	(0.996312612182778-0.0857973123444399j),
-	(0.996044700901252-0.0888535525825246j),
-	(0.9957674144676598-0.09190895649713272j),
-	(0.9954807554919269-0.09496349532963899j),
-	(0.9951847266721969-0.0980171403295606j),
-	(0.9948793307948056-0.10106986275482782j),
-	(0.9945645707342554-0.10412163387205459j),
-	(0.9942404494531879-0.10717242495680884j),
-	(0.9939069700023561-0.11022220729388306j),
-	(0.9935641355205953-0.11327095217756435j),
-	(0.9932119492347945-0.11631863091190475j),
-	(0.9928504144598651-0.11936521481099135j),
-	(0.99247953459871-0.1224106751992162j),
-	(0.9920993131421918-0.12545498341154623j),
-	(0.9917097536690995-0.12849811079379317j),
-	(0.9913108598461154-0.13154002870288312j),
-	(0.99090263542778-0.13458070850712617j),
-	(0.9904850842564571-0.13762012158648604j),
-	(0.9900582102622971-0.1406582393328492j),
-	(0.9896220174632009-0.14369503315029447j),
-	(0.989176509964781-0.14673047445536175j),
-	(0.9887216919603238-0.1497645346773215j),
-	(0.9882575677307495-0.15279718525844344j),
-	(0.9877841416445722-0.15582839765426523j),
-	(0.9873014181578584-0.15885814333386145j),
-	(0.9868094018141855-0.16188639378011183j),
-	(0.9863080972445987-0.16491312048996992j),
-	(0.9857975091675675-0.16793829497473117j),
-	(0.9852776423889412-0.17096188876030122j),
-	(0.9847485018019042-0.17398387338746382j),
-	(0.984210092386929-0.17700422041214875j),
-	(0.9836624192117303-0.18002290140569951j),
-	(0.9831054874312163-0.18303988795514095j),
-	(0.9825393022874412-0.18605515166344663j),
-	(0.9819638691095552-0.1890686641498062j),
-	(0.9813791933137546-0.19208039704989244j),
-	(0.9807852804032304-0.19509032201612825j),
-	(0.9801821359681174-0.19809841071795356j),
-	(0.9795697656854405-0.2011046348420919j),
-	(0.9789481753190622-0.20410896609281687j),
-	(0.9783173707196277-0.20711137619221856j),
-	(0.9776773578245099-0.2101118368804696j),
-	(0.9770281426577544-0.21311031991609136j),
-	(0.9763697313300211-0.21610679707621952j),
-	(0.9757021300385286-0.2191012401568698j),
-	(0.9750253450669941-0.2220936209732035j),
-	(0.9743393827855759-0.22508391135979283j),
-	(0.973644249650812-0.22807208317088573j),
-	(0.9729399522055602-0.2310581082806711j),
-	(0.9722264970789363-0.23404195858354343j),
-	(0.9715038909862518-0.2370236059943672j),
-	(0.9707721407289504-0.2400030224487415j),
-	(0.970031253194544-0.24298017990326387j),
-	(0.9692812353565485-0.2459550503357946j),
-	(0.9685220942744174-0.24892760574572015j),
-	(0.9677538370934755-0.25189781815421697j),
-	(0.9669764710448521-0.25486565960451457j),
-	(0.9661900034454125-0.257831102162159j),
-	(0.9653944416976894-0.2607941179152755j),
-	(0.9645897932898128-0.26375467897483135j),
-	(0.9637760657954398-0.26671275747489837j),
-	(0.9629532668736839-0.2696683255729151j),
-	(0.9621214042690416-0.272621355449949j),
-	(0.9612804858113206-0.27557181931095814j),
-	(0.9604305194155658-0.27851968938505306j),
-	(0.9595715130819845-0.28146493792575794j),
-	(0.9587034748958716-0.2844075372112719j),
-	(0.9578264130275329-0.2873474595447295j),
-	(0.9569403357322088-0.29028467725446233j),
-	(0.9560452513499964-0.29321916269425863j),
-	(0.9551411683057708-0.2961508882436238j),
-	(0.9542280951091057-0.2990798263080405j),
-	(0.9533060403541939-0.3020059493192281j),
-	(0.9523750127197659-0.3049292297354024j),
-	(0.9514350209690083-0.30784964004153487j),
-	(0.9504860739494817-0.3107671527496115j),
-	(0.9495281805930367-0.3136817403988915j),
-	(0.9485613499157303-0.31659337555616585j),
-	(0.9475855910177411-0.3195020308160157j),
-	(0.9466009130832835-0.32240767880106985j),
-	(0.9456073253805213-0.3253102921622629j),
-	(0.9446048372614803-0.3282098435790925j),
-	(0.9435934581619604-0.33110630575987643j),
-	(0.9425731976014469-0.3339996514420094j),
-	(0.9415440651830208-0.33688985339222005j),
-	(0.9405060705932683-0.33977688440682685j),
-	(0.9394592236021899-0.3426607173119944j),
-	(0.9384035340631081-0.3455413249639891j),
-	(0.937339011912575-0.34841868024943456j),
-	(0.9362656671702783-0.3512927560855671j),
-	(0.9351835099389476-0.35416352542049034j),
-	(0.934092550404259-0.35703096123343j),
-	(0.932992798834739-0.3598950365349881j),
-	(0.9318842655816681-0.3627557243673972j),
-	(0.9307669610789837-0.36561299780477385j),
-	(0.9296408958431813-0.3684668299533723j),
-	(0.9285060804732156-0.37131719395183754j),
-	(0.9273625256504011-0.37416406297145793j),
-	(0.9262102421383114-0.37700741021641826j),
-	(0.9250492407826776-0.37984720892405116j),
-	(0.9238795325112867-0.3826834323650898j),
-	(0.9227011283338786-0.38551605384391885j),
-	(0.921514039342042-0.38834504669882625j),
-	(0.9203182767091106-0.39117038430225387j),
-	(0.9191138516900578-0.3939920400610481j),
-	(0.9179007756213905-0.3968099874167103j),
-	(0.9166790599210427-0.3996241998456468j),
-	(0.9154487160882678-0.40243465085941843j),
-	(0.9142097557035307-0.40524131400498986j),
-	(0.9129621904283982-0.4080441628649787j),
-	(0.9117060320054299-0.4108431710579039j),
-	(0.9104412922580672-0.4136383122384345j),
-	(0.9091679830905224-0.41642956009763715j),
-	(0.9078861164876663-0.4192168883632239j),
-	(0.9065957045149153-0.4220002707997997j),
-	(0.9052967593181188-0.4247796812091088j),
-	(0.9039892931234433-0.4275550934302821j),
-	(0.9026733182372588-0.4303264813400826j),
-	(0.901348847046022-0.43309381885315196j),
-	(0.9000158920161603-0.4358570799222555j),
-	(0.8986744656939538-0.43861623853852766j),
-	(0.8973245807054183-0.44137126873171667j),
-	(0.8959662497561852-0.4441221445704292j),
-	(0.8945994856313827-0.44686884016237416j),
-	(0.8932243011955153-0.44961132965460654j),
-	(0.8918407093923427-0.4523495872337709j),
-	(0.8904487232447579-0.45508358712634384j),
-	(0.8890483558546646-0.4578133035988772j),
-	(0.8876396204028539-0.46053871095824j),
-	(0.8862225301488806-0.46325978355186015j),
-	(0.8847970984309378-0.4659764957679662j),
-	(0.8833633386657316-0.4686888220358279j),
-	(0.881921264348355-0.47139673682599764j),
-	(0.8804708890521608-0.47410021465054997j),
-	(0.8790122264286335-0.4767992300633221j),
-	(0.8775452902072614-0.479493757660153j),
-	(0.8760700941954066-0.4821837720791227j),
-	(0.8745866522781761-0.48486924800079106j),
-	(0.8730949784182901-0.487550160148436j),
-	(0.871595086655951-0.49022648328829116j),
-	(0.8700869911087115-0.49289819222978404j),
-	(0.8685707059713409-0.49556526182577254j),
-	(0.8670462455156926-0.49822766697278187j),
-	(0.8655136240905691-0.5008853826112407j),
-	(0.8639728561215868-0.5035383837257176j),
-	(0.8624239561110406-0.5061866453451552j),
-	(0.8608669386377673-0.508830142543107j),
-	(0.8593018183570085-0.5114688504379703j),
-	(0.8577286100002721-0.5141027441932217j),
-	(0.8561473283751945-0.5167317990176499j),
-	(0.8545579883654005-0.5193559901655896j),
-	(0.8529606049303636-0.5219752929371544j),
-	(0.8513551931052652-0.524589682678469j),
-	(0.8497417680008525-0.5271991347819013j),
-	(0.8481203448032972-0.5298036246862946j),
-	(0.8464909387740521-0.5324031278771979j),
-	(0.8448535652497071-0.5349976198870972j),
-	(0.8432082396418454-0.5375870762956454j),
-	(0.8415549774368984-0.5401714727298929j),
-	(0.8398937941959995-0.5427507848645159j),
-	(0.8382247055548381-0.5453249884220465j),
-	(0.836547727223512-0.5478940591731002j),
-	(0.83486287498638-0.5504579729366048j),
-	(0.8331701647019132-0.5530167055800275j),
-	(0.8314696123025452-0.5555702330196022j),
-	(0.829761233794523-0.5581185312205561j),
-	(0.8280450452577558-0.560661576197336j),
-	(0.8263210628456635-0.5631993440138341j),
-	(0.8245893027850253-0.5657318107836131j),
-	(0.8228497813758264-0.5682589526701315j),
-	(0.8211025149911046-0.5707807458869673j),
-	(0.8193475200767969-0.5732971666980422j),
-	(0.8175848131515837-0.5758081914178453j),
-	(0.8158144108067338-0.5783137964116556j),
-	(0.8140363297059484-0.5808139580957645j),
-	(0.8122505865852039-0.5833086529376983j),
-	(0.8104571982525948-0.5857978574564389j),
-	(0.808656181588175-0.5882815482226452j),
-	(0.8068475535437993-0.5907597018588742j),
-	(0.8050313311429637-0.5932322950397998j),
-	(0.8032075314806449-0.5956993044924334j),
-	(0.8013761717231402-0.5981607069963423j),
-	(0.799537269107905-0.600616479383869j),
-	(0.7976908409433912-0.6030665985403482j),
-	(0.7958369046088836-0.6055110414043255j),
-	(0.7939754775543372-0.6079497849677736j),
-	(0.7921065773002124-0.6103828062763095j),
-	(0.79023022143731-0.6128100824294097j),
-	(0.7883464276266063-0.6152315905806268j),
-	(0.7864552135990858-0.6176473079378039j),
-	(0.7845565971555752-0.6200572117632891j),
-	(0.7826505961665757-0.62246127937415j),
-	(0.7807372285720945-0.6248594881423863j),
-	(0.778816512381476-0.6272518154951441j),
-	(0.7768884656732324-0.629638238914927j),
-	(0.7749531065948739-0.6320187359398091j),
-	(0.773010453362737-0.6343932841636455j),
-	(0.7710605242618138-0.6367618612362842j),
-	(0.7691033376455797-0.6391244448637757j),
-	(0.7671389119358204-0.6414810128085832j),
-	(0.765167265622459-0.6438315428897914j),
-	(0.7631884172633813-0.6461760129833163j),
-	(0.7612023854842618-0.6485144010221124j),
-	(0.7592091889783881-0.6508466849963809j),
-	(0.7572088465064846-0.6531728429537768j),
-	(0.7552013768965365-0.6554928529996153j),
-	(0.7531867990436125-0.6578066932970786j),
-	(0.7511651319096865-0.6601143420674205j),
-	(0.7491363945234594-0.6624157775901718j),
-	(0.7471006059801801-0.6647109782033448j),
-	(0.7450577854414661-0.6669999223036375j),
-	(0.7430079521351217-0.669282588346636j),
-	(0.7409511253549591-0.6715589548470183j),
-	(0.7388873244606151-0.673829000378756j),
-	(0.7368165688773699-0.6760927035753159j),
-	(0.7347388780959635-0.6783500431298615j),
-	(0.7326542716724128-0.680600997795453j),
-	(0.7305627692278276-0.6828455463852481j),
-	(0.7284643904482252-0.6850836677727004j),
-	(0.726359155084346-0.687315340891759j),
-	(0.724247082951467-0.6895405447370668j),
-	(0.7221281939292153-0.6917592583641577j),
-	(0.7200025079613817-0.693971460889654j),
-	(0.7178700450557317-0.696177131491463j),
-	(0.7157308252838186-0.6983762494089729j),
-	(0.7135848687807936-0.7005687939432483j),
-	(0.7114321957452164-0.7027547444572253j),
-	(0.7092728264388657-0.7049340803759049j),
-	(0.7071067811865476-0.7071067811865475j),
-	(0.704934080375905-0.7092728264388656j),
-	(0.7027547444572253-0.7114321957452164j),
-	(0.7005687939432484-0.7135848687807935j),
-	(0.6983762494089729-0.7157308252838186j),
-	(0.696177131491463-0.7178700450557317j),
-	(0.693971460889654-0.7200025079613817j),
-	(0.6917592583641577-0.7221281939292153j),
-	(0.6895405447370669-0.7242470829514669j),
-	(0.6873153408917592-0.726359155084346j),
-	(0.6850836677727004-0.7284643904482252j),
-	(0.6828455463852481-0.7305627692278276j),
-	(0.6806009977954531-0.7326542716724128j),
-	(0.6783500431298616-0.7347388780959634j),
-	(0.676092703575316-0.7368165688773698j),
-	(0.6738290003787561-0.7388873244606151j),
-	(0.6715589548470183-0.7409511253549591j),
-	(0.669282588346636-0.7430079521351217j),
-	(0.6669999223036375-0.745057785441466j),
-	(0.6647109782033449-0.7471006059801801j),
-	(0.6624157775901718-0.7491363945234593j),
-	(0.6601143420674205-0.7511651319096864j),
-	(0.6578066932970786-0.7531867990436124j),
-	(0.6554928529996155-0.7552013768965365j),
-	(0.6531728429537768-0.7572088465064845j),
-	(0.650846684996381-0.759209188978388j),
-	(0.6485144010221126-0.7612023854842618j),
-	(0.6461760129833164-0.7631884172633813j),
-	(0.6438315428897915-0.765167265622459j),
-	(0.6414810128085832-0.7671389119358204j),
-	(0.6391244448637757-0.7691033376455796j),
-	(0.6367618612362842-0.7710605242618137j),
-	(0.6343932841636455-0.773010453362737j),
-	(0.6320187359398091-0.7749531065948738j),
-	(0.6296382389149271-0.7768884656732324j),
-	(0.6272518154951442-0.7788165123814759j),
-	(0.6248594881423865-0.7807372285720944j),
-	(0.6224612793741501-0.7826505961665757j),
-	(0.6200572117632892-0.7845565971555752j),
-	(0.617647307937804-0.7864552135990858j),
-	(0.6152315905806268-0.7883464276266062j),
-	(0.6128100824294097-0.79023022143731j),
-	(0.6103828062763095-0.7921065773002124j),
-	(0.6079497849677737-0.7939754775543372j),
-	(0.6055110414043255-0.7958369046088835j),
-	(0.6030665985403483-0.797690840943391j),
-	(0.600616479383869-0.799537269107905j),
-	(0.5981607069963424-0.8013761717231401j),
-	(0.5956993044924335-0.8032075314806448j),
-	(0.5932322950397998-0.8050313311429637j),
-	(0.5907597018588743-0.8068475535437992j),
-	(0.5882815482226453-0.808656181588175j),
-	(0.5857978574564389-0.8104571982525948j),
-	(0.5833086529376983-0.8122505865852039j),
-	(0.5808139580957645-0.8140363297059483j),
-	(0.5783137964116556-0.8158144108067338j),
-	(0.5758081914178453-0.8175848131515837j),
-	(0.5732971666980423-0.8193475200767969j),
-	(0.5707807458869674-0.8211025149911046j),
-	(0.5682589526701315-0.8228497813758263j),
-	(0.5657318107836132-0.8245893027850253j),
-	(0.5631993440138341-0.8263210628456634j),
-	(0.560661576197336-0.8280450452577558j),
-	(0.5581185312205561-0.829761233794523j),
-	(0.5555702330196023-0.8314696123025452j),
-	(0.5530167055800276-0.8331701647019132j),
-	(0.5504579729366048-0.83486287498638j),
-	(0.5478940591731002-0.8365477272235119j),
-	(0.5453249884220465-0.838224705554838j),
-	(0.542750784864516-0.8398937941959994j),
-	(0.540171472729893-0.8415549774368983j),
-	(0.5375870762956455-0.8432082396418454j),
-	(0.5349976198870973-0.844853565249707j),
-	(0.532403127877198-0.846490938774052j),
-	(0.5298036246862948-0.8481203448032971j),
-	(0.5271991347819014-0.8497417680008524j),
-	(0.5245896826784688-0.8513551931052652j),
-	(0.5219752929371544-0.8529606049303636j),
-	(0.5193559901655895-0.8545579883654005j),
-	(0.51673179901765-0.8561473283751945j),
-	(0.5141027441932217-0.8577286100002721j),
-	(0.5114688504379705-0.8593018183570084j),
-	(0.508830142543107-0.8608669386377673j),
-	(0.5061866453451555-0.8624239561110405j),
-	(0.5035383837257176-0.8639728561215867j),
-	(0.5008853826112409-0.865513624090569j),
-	(0.49822766697278187-0.8670462455156926j),
-	(0.4955652618257725-0.8685707059713409j),
-	(0.4928981922297841-0.8700869911087113j),
-	(0.4902264832882911-0.8715950866559511j),
-	(0.48755016014843605-0.8730949784182901j),
-	(0.4848692480007911-0.8745866522781761j),
-	(0.48218377207912283-0.8760700941954066j),
-	(0.479493757660153-0.8775452902072612j),
-	(0.47679923006332225-0.8790122264286334j),
-	(0.47410021465055-0.8804708890521608j),
-	(0.4713967368259978-0.8819212643483549j),
-	(0.46868882203582796-0.8833633386657316j),
-	(0.4659764957679661-0.8847970984309378j),
-	(0.46325978355186026-0.8862225301488806j),
-	(0.46053871095824-0.8876396204028539j),
-	(0.4578133035988773-0.8890483558546646j),
-	(0.45508358712634384-0.8904487232447579j),
-	(0.452349587233771-0.8918407093923427j),
-	(0.4496113296546066-0.8932243011955153j),
-	(0.4468688401623743-0.8945994856313826j),
-	(0.44412214457042926-0.8959662497561851j),
-	(0.4413712687317166-0.8973245807054183j),
-	(0.4386162385385277-0.8986744656939538j),
-	(0.4358570799222555-0.9000158920161603j),
-	(0.433093818853152-0.901348847046022j),
-	(0.4303264813400826-0.9026733182372588j),
-	(0.4275550934302822-0.9039892931234433j),
-	(0.4247796812091088-0.9052967593181188j),
-	(0.4220002707997998-0.9065957045149153j),
-	(0.41921688836322396-0.9078861164876662j),
-	(0.4164295600976373-0.9091679830905223j),
-	(0.41363831223843456-0.9104412922580671j),
-	(0.4108431710579039-0.9117060320054299j),
-	(0.40804416286497874-0.9129621904283981j),
-	(0.40524131400498986-0.9142097557035307j),
-	(0.40243465085941854-0.9154487160882678j),
-	(0.3996241998456468-0.9166790599210427j),
-	(0.3968099874167104-0.9179007756213904j),
-	(0.3939920400610481-0.9191138516900578j),
-	(0.391170384302254-0.9203182767091105j),
-	(0.3883450466988263-0.9215140393420419j),
-	(0.385516053843919-0.9227011283338785j),
-	(0.38268343236508984-0.9238795325112867j),
-	(0.3798472089240511-0.9250492407826776j),
-	(0.3770074102164183-0.9262102421383113j),
-	(0.374164062971458-0.9273625256504011j),
-	(0.3713171939518376-0.9285060804732155j),
-	(0.3684668299533723-0.9296408958431813j),
-	(0.36561299780477396-0.9307669610789837j),
-	(0.3627557243673972-0.9318842655816681j),
-	(0.3598950365349883-0.9329927988347388j),
-	(0.35703096123343003-0.9340925504042589j),
-	(0.3541635254204905-0.9351835099389475j),
-	(0.35129275608556715-0.9362656671702783j),
-	(0.3484186802494345-0.937339011912575j),
-	(0.34554132496398915-0.9384035340631081j),
-	(0.3426607173119944-0.9394592236021899j),
-	(0.33977688440682696-0.9405060705932683j),
-	(0.33688985339222005-0.9415440651830208j),
-	(0.3339996514420095-0.9425731976014469j),
-	(0.33110630575987643-0.9435934581619604j),
-	(0.32820984357909266-0.9446048372614803j),
-	(0.325310292162263-0.9456073253805213j),
-	(0.32240767880107-0.9466009130832835j),
-	(0.31950203081601575-0.9475855910177411j),
-	(0.31659337555616585-0.9485613499157303j),
-	(0.3136817403988916-0.9495281805930367j),
-	(0.3107671527496115-0.9504860739494817j),
-	(0.307849640041535-0.9514350209690083j),
-	(0.30492922973540243-0.9523750127197659j),
-	(0.3020059493192282-0.9533060403541938j),
-	(0.2990798263080405-0.9542280951091057j),
-	(0.29615088824362396-0.9551411683057707j),
-	(0.2932191626942587-0.9560452513499964j),
-	(0.29028467725446233-0.9569403357322089j),
-	(0.28734745954472957-0.9578264130275329j),
-	(0.2844075372112718-0.9587034748958716j),
-	(0.28146493792575805-0.9595715130819845j),
-	(0.27851968938505306-0.9604305194155658j),
-	(0.27557181931095825-0.9612804858113206j),
-	(0.272621355449949-0.9621214042690416j),
-	(0.2696683255729152-0.9629532668736839j),
-	(0.2667127574748984-0.9637760657954398j),
-	(0.2637546789748315-0.9645897932898126j),
-	(0.26079411791527557-0.9653944416976894j),
-	(0.25783110216215893-0.9661900034454126j),
-	(0.2548656596045146-0.9669764710448521j),
-	(0.2518978181542169-0.9677538370934755j),
-	(0.24892760574572026-0.9685220942744173j),
-	(0.2459550503357946-0.9692812353565485j),
-	(0.24298017990326398-0.970031253194544j),
-	(0.2400030224487415-0.9707721407289504j),
-	(0.23702360599436734-0.9715038909862518j),
-	(0.23404195858354346-0.9722264970789363j),
-	(0.23105810828067128-0.9729399522055601j),
-	(0.2280720831708858-0.9736442496508119j),
-	(0.22508391135979278-0.9743393827855759j),
-	(0.2220936209732036-0.9750253450669941j),
-	(0.21910124015686977-0.9757021300385286j),
-	(0.2161067970762196-0.9763697313300211j),
-	(0.21311031991609136-0.9770281426577544j),
-	(0.21011183688046972-0.9776773578245099j),
-	(0.20711137619221856-0.9783173707196277j),
-	(0.204108966092817-0.9789481753190622j),
-	(0.20110463484209196-0.9795697656854405j),
-	(0.19809841071795373-0.9801821359681173j),
-	(0.19509032201612833-0.9807852804032304j),
-	(0.19208039704989238-0.9813791933137546j),
-	(0.18906866414980628-0.9819638691095552j),
-	(0.18605515166344663-0.9825393022874412j),
-	(0.18303988795514106-0.9831054874312163j),
-	(0.18002290140569951-0.9836624192117303j),
-	(0.17700422041214886-0.984210092386929j),
-	(0.17398387338746385-0.9847485018019042j),
-	(0.17096188876030136-0.9852776423889412j),
-	(0.16793829497473123-0.9857975091675674j),
-	(0.1649131204899701-0.9863080972445987j),
-	(0.16188639378011188-0.9868094018141854j),
-	(0.1588581433338614-0.9873014181578584j),
-	(0.15582839765426532-0.9877841416445722j),
-	(0.1527971852584434-0.9882575677307495j),
-	(0.14976453467732162-0.9887216919603238j),
-	(0.14673047445536175-0.989176509964781j),
-	(0.14369503315029458-0.9896220174632008j),
-	(0.14065823933284924-0.9900582102622971j),
-	(0.13762012158648618-0.990485084256457j),
-	(0.13458070850712622-0.99090263542778j),
-	(0.13154002870288328-0.9913108598461154j),
-	(0.12849811079379322-0.9917097536690995j),
-	(0.1254549834115462-0.9920993131421918j),
-	(0.12241067519921628-0.99247953459871j),
-	(0.11936521481099135-0.9928504144598651j),
-	(0.11631863091190488-0.9932119492347945j),
-	(0.11327095217756436-0.9935641355205953j),
-	(0.11022220729388318-0.9939069700023561j),
-	(0.10717242495680887-0.9942404494531879j),
-	(0.10412163387205473-0.9945645707342554j),
-	(0.10106986275482788-0.9948793307948056j),
-	(0.09801714032956077-0.9951847266721968j),
-	(0.09496349532963906-0.9954807554919269j),
-	(0.0919089564971327-0.9957674144676598j),
-	(0.08885355258252468-0.996044700901252j),
-	(0.08579731234443988-0.996312612182778j),
-	(0.0827402645493758-0.9965711457905548j),
-	(0.07968243797143013-0.9968202992911657j),
-	(0.07662386139203162-0.997060070339483j),
-	(0.07356456359966745-0.9972904566786902j),
-	(0.07050457338961401-0.9975114561403035j),
-	(0.0674439195636641-0.9977230666441916j),
-	(0.06438263092985741-0.997925286198596j),
-	(0.06132073630220865-0.9981181129001492j),
-	(0.05825826450043573-0.9983015449338929j),
-	(0.05519524434969003-0.9984755805732948j),
-	(0.05213170468028332-0.9986402181802653j),
-	(0.049067674327418126-0.9987954562051724j),
-	(0.046003182130914644-0.9989412931868569j),
-	(0.04293825693494096-0.9990777277526454j),
-	(0.039872927587739845-0.9992047586183639j),
-	(0.03680722294135899-0.9993223845883495j),
-	(0.03374117185137764-0.9994306045554617j),
-	(0.03067480317663658-0.9995294175010931j),
-	(0.02760814577896582-0.9996188224951786j),
-	(0.024541228522912264-0.9996988186962042j),
-	(0.021474080275469605-0.9997694053512153j),
-	(0.01840672990580482-0.9998305817958234j),
-	(0.01533920628498822-0.9998823474542126j),
-	(0.012271538285719944-0.9999247018391445j),
-	(0.00920375478205996-0.9999576445519639j),
-	(0.006135884649154515-0.9999811752826011j),
-	(0.003067956762966138-0.9999952938095762j),
-	(6.123233995736766e-17-1j),
-	(-0.0030679567629660156-0.9999952938095762j),
-	(-0.006135884649154393-0.9999811752826011j),
-	(-0.009203754782059837-0.9999576445519639j),
-	(-0.012271538285719823-0.9999247018391445j),
-	(-0.015339206284988098-0.9998823474542126j),
-	(-0.018406729905804695-0.9998305817958234j),
-	(-0.021474080275469484-0.9997694053512153j),
-	(-0.024541228522912142-0.9996988186962042j),
-	(-0.027608145778965698-0.9996188224951786j),
-	(-0.03067480317663646-0.9995294175010931j),
-	(-0.03374117185137752-0.9994306045554617j),
-	(-0.036807222941358866-0.9993223845883495j),
-	(-0.03987292758773973-0.9992047586183639j),
-	(-0.042938256934940834-0.9990777277526454j),
-	(-0.04600318213091452-0.9989412931868569j),
-	(-0.04906767432741801-0.9987954562051724j),
-	(-0.05213170468028319-0.9986402181802653j),
-	(-0.05519524434968991-0.9984755805732948j),
-	(-0.05825826450043561-0.9983015449338929j),
-	(-0.06132073630220853-0.9981181129001492j),
-	(-0.06438263092985728-0.997925286198596j),
-	(-0.06744391956366398-0.9977230666441916j),
-	(-0.0705045733896139-0.9975114561403035j),
-	(-0.07356456359966733-0.9972904566786902j),
-	(-0.0766238613920315-0.997060070339483j),
-	(-0.07968243797143001-0.9968202992911658j),
-	(-0.08274026454937568-0.9965711457905548j),
-	(-0.08579731234443976-0.996312612182778j),
-	(-0.08885355258252456-0.996044700901252j),
-	(-0.09190895649713257-0.9957674144676598j),
-	(-0.09496349532963895-0.9954807554919269j),
-	(-0.09801714032956065-0.9951847266721969j),
-	(-0.10106986275482775-0.9948793307948056j),
-	(-0.1041216338720546-0.9945645707342554j),
-	(-0.10717242495680876-0.9942404494531879j),
-	(-0.11022220729388306-0.9939069700023561j),
-	(-0.11327095217756424-0.9935641355205953j),
-	(-0.11631863091190475-0.9932119492347945j),
-	(-0.11936521481099123-0.9928504144598651j),
-	(-0.12241067519921615-0.99247953459871j),
-	(-0.12545498341154607-0.9920993131421918j),
-	(-0.1284981107937931-0.9917097536690995j),
-	(-0.13154002870288314-0.9913108598461154j),
-	(-0.1345807085071261-0.99090263542778j),
-	(-0.13762012158648607-0.990485084256457j),
-	(-0.14065823933284913-0.9900582102622971j),
-	(-0.14369503315029444-0.9896220174632009j),
-	(-0.14673047445536164-0.989176509964781j),
-	(-0.1497645346773215-0.9887216919603238j),
-	(-0.1527971852584433-0.9882575677307495j),
-	(-0.1558283976542652-0.9877841416445722j),
-	(-0.15885814333386128-0.9873014181578584j),
-	(-0.16188639378011177-0.9868094018141855j),
-	(-0.16491312048996995-0.9863080972445987j),
-	(-0.1679382949747311-0.9857975091675675j),
-	(-0.17096188876030124-0.9852776423889412j),
-	(-0.1739838733874637-0.9847485018019042j),
-	(-0.17700422041214875-0.984210092386929j),
-	(-0.1800229014056994-0.9836624192117303j),
-	(-0.18303988795514092-0.9831054874312163j),
-	(-0.1860551516634465-0.9825393022874412j),
-	(-0.18906866414980616-0.9819638691095552j),
-	(-0.19208039704989227-0.9813791933137546j),
-	(-0.1950903220161282-0.9807852804032304j),
-	(-0.19809841071795362-0.9801821359681174j),
-	(-0.20110463484209182-0.9795697656854405j),
-	(-0.2041089660928169-0.9789481753190622j),
-	(-0.20711137619221845-0.9783173707196277j),
-	(-0.2101118368804696-0.9776773578245099j),
-	(-0.21311031991609125-0.9770281426577544j),
-	(-0.2161067970762195-0.9763697313300211j),
-	(-0.21910124015686966-0.9757021300385286j),
-	(-0.22209362097320348-0.9750253450669941j),
-	(-0.22508391135979267-0.9743393827855759j),
-	(-0.22807208317088568-0.973644249650812j),
-	(-0.23105810828067114-0.9729399522055602j),
-	(-0.23404195858354332-0.9722264970789364j),
-	(-0.23702360599436723-0.9715038909862518j),
-	(-0.2400030224487414-0.9707721407289504j),
-	(-0.24298017990326387-0.970031253194544j),
-	(-0.24595505033579448-0.9692812353565485j),
-	(-0.24892760574572012-0.9685220942744174j),
-	(-0.2518978181542168-0.9677538370934755j),
-	(-0.2548656596045145-0.9669764710448521j),
-	(-0.2578311021621588-0.9661900034454126j),
-	(-0.26079411791527546-0.9653944416976894j),
-	(-0.2637546789748314-0.9645897932898128j),
-	(-0.2667127574748983-0.9637760657954398j),
-	(-0.2696683255729151-0.9629532668736839j),
-	(-0.27262135544994887-0.9621214042690416j),
-	(-0.27557181931095814-0.9612804858113206j),
-	(-0.27851968938505295-0.9604305194155659j),
-	(-0.28146493792575794-0.9595715130819845j),
-	(-0.2844075372112717-0.9587034748958716j),
-	(-0.28734745954472946-0.9578264130275329j),
-	(-0.29028467725446216-0.9569403357322089j),
-	(-0.2932191626942586-0.9560452513499965j),
-	(-0.29615088824362384-0.9551411683057707j),
-	(-0.29907982630804036-0.9542280951091057j),
-	(-0.3020059493192281-0.9533060403541939j),
-	(-0.30492922973540226-0.9523750127197659j),
-	(-0.30784964004153487-0.9514350209690083j),
-	(-0.31076715274961136-0.9504860739494818j),
-	(-0.3136817403988914-0.9495281805930367j),
-	(-0.31659337555616573-0.9485613499157304j),
-	(-0.31950203081601564-0.9475855910177412j),
-	(-0.32240767880106985-0.9466009130832835j),
-	(-0.32531029216226287-0.9456073253805214j),
-	(-0.32820984357909255-0.9446048372614803j),
-	(-0.3311063057598763-0.9435934581619604j),
-	(-0.3339996514420094-0.9425731976014469j),
-	(-0.33688985339221994-0.9415440651830208j),
-	(-0.33977688440682685-0.9405060705932683j),
-	(-0.34266071731199427-0.9394592236021899j),
-	(-0.34554132496398904-0.9384035340631082j),
-	(-0.3484186802494344-0.937339011912575j),
-	(-0.35129275608556704-0.9362656671702783j),
-	(-0.3541635254204904-0.9351835099389476j),
-	(-0.3570309612334299-0.934092550404259j),
-	(-0.35989503653498817-0.9329927988347388j),
-	(-0.3627557243673971-0.9318842655816681j),
-	(-0.36561299780477385-0.9307669610789837j),
-	(-0.3684668299533722-0.9296408958431813j),
-	(-0.3713171939518375-0.9285060804732156j),
-	(-0.3741640629714579-0.9273625256504011j),
-	(-0.3770074102164182-0.9262102421383114j),
-	(-0.379847208924051-0.9250492407826777j),
-	(-0.3826834323650897-0.9238795325112867j),
-	(-0.3855160538439189-0.9227011283338785j),
-	(-0.3883450466988262-0.921514039342042j),
-	(-0.39117038430225387-0.9203182767091106j),
-	(-0.393992040061048-0.9191138516900578j),
-	(-0.3968099874167103-0.9179007756213905j),
-	(-0.3996241998456467-0.9166790599210427j),
-	(-0.40243465085941843-0.9154487160882678j),
-	(-0.40524131400498975-0.9142097557035307j),
-	(-0.40804416286497863-0.9129621904283982j),
-	(-0.4108431710579038-0.9117060320054299j),
-	(-0.41363831223843445-0.9104412922580672j),
-	(-0.416429560097637-0.9091679830905225j),
-	(-0.41921688836322407-0.9078861164876662j),
-	(-0.4220002707997997-0.9065957045149153j),
-	(-0.4247796812091087-0.9052967593181188j),
-	(-0.42755509343028186-0.9039892931234434j),
-	(-0.4303264813400827-0.9026733182372588j),
-	(-0.4330938188531519-0.901348847046022j),
-	(-0.43585707992225536-0.9000158920161603j),
-	(-0.4386162385385274-0.8986744656939539j),
-	(-0.4413712687317167-0.8973245807054183j),
-	(-0.44412214457042914-0.8959662497561852j),
-	(-0.446868840162374-0.8945994856313828j),
-	(-0.4496113296546067-0.8932243011955152j),
-	(-0.4523495872337709-0.8918407093923427j),
-	(-0.4550835871263437-0.890448723244758j),
-	(-0.457813303598877-0.8890483558546647j),
-	(-0.46053871095824006-0.8876396204028539j),
-	(-0.46325978355186015-0.8862225301488806j),
-	(-0.465976495767966-0.8847970984309379j),
-	(-0.4686888220358277-0.8833633386657317j),
-	(-0.4713967368259977-0.881921264348355j),
-	(-0.4741002146505499-0.8804708890521609j),
-	(-0.4767992300633219-0.8790122264286335j),
-	(-0.4794937576601531-0.8775452902072612j),
-	(-0.4821837720791227-0.8760700941954066j),
-	(-0.484869248000791-0.8745866522781762j),
-	(-0.4875501601484357-0.8730949784182902j),
-	(-0.4902264832882912-0.871595086655951j),
-	(-0.492898192229784-0.8700869911087115j),
-	(-0.4955652618257724-0.868570705971341j),
-	(-0.4982276669727816-0.8670462455156928j),
-	(-0.5008853826112408-0.8655136240905691j),
-	(-0.5035383837257175-0.8639728561215868j),
-	(-0.5061866453451551-0.8624239561110406j),
-	(-0.5088301425431071-0.8608669386377672j),
-	(-0.5114688504379704-0.8593018183570084j),
-	(-0.5141027441932217-0.8577286100002721j),
-	(-0.5167317990176497-0.8561473283751946j),
-	(-0.5193559901655896-0.8545579883654005j),
-	(-0.5219752929371543-0.8529606049303637j),
-	(-0.5245896826784687-0.8513551931052652j),
-	(-0.5271991347819011-0.8497417680008527j),
-	(-0.5298036246862947-0.8481203448032972j),
-	(-0.5324031278771979-0.8464909387740521j),
-	(-0.534997619887097-0.8448535652497072j),
-	(-0.5375870762956456-0.8432082396418454j),
-	(-0.5401714727298929-0.8415549774368984j),
-	(-0.5427507848645158-0.8398937941959996j),
-	(-0.5453249884220462-0.8382247055548382j),
-	(-0.5478940591731002-0.836547727223512j),
-	(-0.5504579729366047-0.8348628749863801j),
-	(-0.5530167055800274-0.8331701647019133j),
-	(-0.555570233019602-0.8314696123025455j),
-	(-0.5581185312205561-0.829761233794523j),
-	(-0.5606615761973359-0.8280450452577558j),
-	(-0.563199344013834-0.8263210628456636j),
-	(-0.5657318107836132-0.8245893027850252j),
-	(-0.5682589526701315-0.8228497813758263j),
-	(-0.5707807458869671-0.8211025149911048j),
-	(-0.573297166698042-0.8193475200767971j),
-	(-0.5758081914178453-0.8175848131515837j),
-	(-0.5783137964116555-0.8158144108067338j),
-	(-0.5808139580957644-0.8140363297059485j),
-	(-0.5833086529376984-0.8122505865852039j),
-	(-0.5857978574564389-0.8104571982525948j),
-	(-0.5882815482226452-0.8086561815881751j),
-	(-0.590759701858874-0.8068475535437994j),
-	(-0.5932322950397999-0.8050313311429635j),
-	(-0.5956993044924334-0.8032075314806449j),
-	(-0.5981607069963422-0.8013761717231404j),
-	(-0.6006164793838688-0.7995372691079052j),
-	(-0.6030665985403483-0.797690840943391j),
-	(-0.6055110414043254-0.7958369046088836j),
-	(-0.6079497849677735-0.7939754775543373j),
-	(-0.6103828062763096-0.7921065773002123j),
-	(-0.6128100824294097-0.79023022143731j),
-	(-0.6152315905806267-0.7883464276266063j),
-	(-0.6176473079378038-0.7864552135990859j),
-	(-0.6200572117632892-0.7845565971555751j),
-	(-0.62246127937415-0.7826505961665757j),
-	(-0.6248594881423862-0.7807372285720946j),
-	(-0.6272518154951439-0.7788165123814761j),
-	(-0.6296382389149271-0.7768884656732324j),
-	(-0.632018735939809-0.7749531065948739j),
-	(-0.6343932841636454-0.7730104533627371j),
-	(-0.6367618612362843-0.7710605242618137j),
-	(-0.6391244448637757-0.7691033376455796j),
-	(-0.641481012808583-0.7671389119358205j),
-	(-0.6438315428897913-0.7651672656224591j),
-	(-0.6461760129833164-0.7631884172633813j),
-	(-0.6485144010221124-0.7612023854842619j),
-	(-0.6508466849963808-0.7592091889783882j),
-	(-0.6531728429537765-0.7572088465064847j),
-	(-0.6554928529996155-0.7552013768965365j),
-	(-0.6578066932970786-0.7531867990436125j),
-	(-0.6601143420674204-0.7511651319096866j),
-	(-0.6624157775901719-0.7491363945234593j),
-	(-0.6647109782033449-0.7471006059801801j),
-	(-0.6669999223036374-0.7450577854414661j),
-	(-0.6692825883466359-0.7430079521351218j),
-	(-0.6715589548470184-0.740951125354959j),
-	(-0.673829000378756-0.7388873244606152j),
-	(-0.6760927035753158-0.73681656887737j),
-	(-0.6783500431298612-0.7347388780959636j),
-	(-0.680600997795453-0.7326542716724128j),
-	(-0.682845546385248-0.7305627692278276j),
-	(-0.6850836677727002-0.7284643904482253j),
-	(-0.6873153408917592-0.7263591550843459j),
-	(-0.6895405447370669-0.7242470829514669j),
-	(-0.6917592583641576-0.7221281939292155j),
-	(-0.6939714608896538-0.7200025079613818j),
-	(-0.696177131491463-0.7178700450557317j),
-	(-0.6983762494089728-0.7157308252838187j),
-	(-0.7005687939432482-0.7135848687807937j),
-	(-0.7027547444572251-0.7114321957452167j),
-	(-0.7049340803759049-0.7092728264388656j),
-	(-0.7071067811865475-0.7071067811865476j),
-	(-0.7092728264388655-0.7049340803759051j),
-	(-0.7114321957452165-0.7027547444572252j),
-	(-0.7135848687807936-0.7005687939432483j),
-	(-0.7157308252838186-0.6983762494089729j),
-	(-0.7178700450557316-0.6961771314914631j),
-	(-0.7200025079613817-0.693971460889654j),
-	(-0.7221281939292152-0.6917592583641579j),
-	(-0.7242470829514668-0.689540544737067j),
-	(-0.7263591550843458-0.6873153408917593j),
-	(-0.7284643904482252-0.6850836677727004j),
-	(-0.7305627692278275-0.6828455463852482j),
-	(-0.7326542716724127-0.6806009977954532j),
-	(-0.7347388780959635-0.6783500431298614j),
-	(-0.7368165688773699-0.6760927035753159j),
-	(-0.738887324460615-0.6738290003787561j),
-	(-0.7409511253549589-0.6715589548470186j),
-	(-0.7430079521351217-0.669282588346636j),
-	(-0.745057785441466-0.6669999223036376j),
-	(-0.74710060598018-0.664710978203345j),
-	(-0.7491363945234591-0.662415777590172j),
-	(-0.7511651319096865-0.6601143420674205j),
-	(-0.7531867990436124-0.6578066932970787j),
-	(-0.7552013768965364-0.6554928529996156j),
-	(-0.7572088465064846-0.6531728429537766j),
-	(-0.7592091889783881-0.650846684996381j),
-	(-0.7612023854842617-0.6485144010221126j),
-	(-0.763188417263381-0.6461760129833166j),
-	(-0.765167265622459-0.6438315428897914j),
-	(-0.7671389119358203-0.6414810128085832j),
-	(-0.7691033376455795-0.6391244448637758j),
-	(-0.7710605242618136-0.6367618612362844j),
-	(-0.773010453362737-0.6343932841636455j),
-	(-0.7749531065948738-0.6320187359398091j),
-	(-0.7768884656732323-0.6296382389149272j),
-	(-0.778816512381476-0.6272518154951441j),
-	(-0.7807372285720945-0.6248594881423863j),
-	(-0.7826505961665756-0.6224612793741501j),
-	(-0.784556597155575-0.6200572117632894j),
-	(-0.7864552135990858-0.6176473079378039j),
-	(-0.7883464276266062-0.6152315905806269j),
-	(-0.7902302214373099-0.6128100824294098j),
-	(-0.7921065773002122-0.6103828062763097j),
-	(-0.7939754775543372-0.6079497849677736j),
-	(-0.7958369046088835-0.6055110414043257j),
-	(-0.7976908409433909-0.6030665985403484j),
-	(-0.7995372691079051-0.6006164793838689j),
-	(-0.8013761717231402-0.5981607069963424j),
-	(-0.8032075314806448-0.5956993044924335j),
-	(-0.8050313311429634-0.5932322950398j),
-	(-0.8068475535437993-0.5907597018588742j),
-	(-0.808656181588175-0.5882815482226453j),
-	(-0.8104571982525947-0.585797857456439j),
-	(-0.8122505865852038-0.5833086529376985j),
-	(-0.8140363297059484-0.5808139580957645j),
-	(-0.8158144108067337-0.5783137964116557j),
-	(-0.8175848131515836-0.5758081914178454j),
-	(-0.819347520076797-0.5732971666980421j),
-	(-0.8211025149911046-0.5707807458869673j),
-	(-0.8228497813758262-0.5682589526701317j),
-	(-0.8245893027850251-0.5657318107836135j),
-	(-0.8263210628456635-0.5631993440138341j),
-	(-0.8280450452577557-0.5606615761973361j),
-	(-0.8297612337945229-0.5581185312205563j),
-	(-0.8314696123025453-0.5555702330196022j),
-	(-0.8331701647019132-0.5530167055800276j),
-	(-0.83486287498638-0.5504579729366049j),
-	(-0.8365477272235119-0.5478940591731004j),
-	(-0.8382247055548381-0.5453249884220464j),
-	(-0.8398937941959995-0.5427507848645159j),
-	(-0.8415549774368983-0.540171472729893j),
-	(-0.8432082396418453-0.5375870762956457j),
-	(-0.8448535652497071-0.5349976198870972j),
-	(-0.846490938774052-0.532403127877198j),
-	(-0.8481203448032971-0.5298036246862948j),
-	(-0.8497417680008525-0.5271991347819013j),
-	(-0.8513551931052652-0.524589682678469j),
-	(-0.8529606049303636-0.5219752929371545j),
-	(-0.8545579883654004-0.5193559901655898j),
-	(-0.8561473283751945-0.5167317990176498j),
-	(-0.857728610000272-0.5141027441932218j),
-	(-0.8593018183570084-0.5114688504379705j),
-	(-0.8608669386377671-0.5088301425431073j),
-	(-0.8624239561110405-0.5061866453451552j),
-	(-0.8639728561215867-0.5035383837257177j),
-	(-0.865513624090569-0.5008853826112409j),
-	(-0.8670462455156928-0.49822766697278176j),
-	(-0.8685707059713409-0.49556526182577254j),
-	(-0.8700869911087113-0.49289819222978415j),
-	(-0.8715950866559509-0.4902264832882914j),
-	(-0.8730949784182901-0.4875501601484359j),
-	(-0.8745866522781761-0.4848692480007911j),
-	(-0.8760700941954065-0.4821837720791229j),
-	(-0.8775452902072611-0.4794937576601533j),
-	(-0.8790122264286335-0.4767992300633221j),
-	(-0.8804708890521608-0.4741002146505501j),
-	(-0.8819212643483549-0.47139673682599786j),
-	(-0.8833633386657317-0.46868882203582785j),
-	(-0.8847970984309378-0.4659764957679662j),
-	(-0.8862225301488805-0.4632597835518603j),
-	(-0.8876396204028538-0.4605387109582402j),
-	(-0.8890483558546646-0.4578133035988772j),
-	(-0.8904487232447579-0.4550835871263439j),
-	(-0.8918407093923426-0.45234958723377106j),
-	(-0.8932243011955152-0.4496113296546069j),
-	(-0.8945994856313827-0.44686884016237416j),
-	(-0.8959662497561851-0.4441221445704293j),
-	(-0.8973245807054182-0.4413712687317169j),
-	(-0.8986744656939539-0.43861623853852755j),
-	(-0.9000158920161602-0.43585707992225553j),
-	(-0.9013488470460219-0.43309381885315207j),
-	(-0.9026733182372587-0.4303264813400829j),
-	(-0.9039892931234433-0.42755509343028203j),
-	(-0.9052967593181187-0.42477968120910886j),
-	(-0.9065957045149153-0.42200027079979985j),
-	(-0.907886116487666-0.41921688836322424j),
-	(-0.9091679830905224-0.41642956009763715j),
-	(-0.9104412922580671-0.4136383122384346j),
-	(-0.9117060320054298-0.41084317105790413j),
-	(-0.9129621904283982-0.4080441628649786j),
-	(-0.9142097557035307-0.4052413140049899j),
-	(-0.9154487160882677-0.4024346508594186j),
-	(-0.9166790599210426-0.39962419984564707j),
-	(-0.9179007756213905-0.39680998741671025j),
-	(-0.9191138516900578-0.39399204006104815j),
-	(-0.9203182767091105-0.39117038430225404j),
-	(-0.9215140393420418-0.3883450466988266j),
-	(-0.9227011283338786-0.38551605384391885j),
-	(-0.9238795325112867-0.3826834323650899j),
-	(-0.9250492407826775-0.3798472089240514j),
-	(-0.9262102421383114-0.37700741021641815j),
-	(-0.9273625256504011-0.37416406297145804j),
-	(-0.9285060804732155-0.3713171939518377j),
-	(-0.9296408958431812-0.3684668299533726j),
-	(-0.9307669610789837-0.3656129978047738j),
-	(-0.931884265581668-0.3627557243673973j),
-	(-0.9329927988347388-0.35989503653498833j),
-	(-0.9340925504042588-0.3570309612334303j),
-	(-0.9351835099389476-0.3541635254204904j),
-	(-0.9362656671702783-0.3512927560855672j),
-	(-0.9373390119125748-0.3484186802494348j),
-	(-0.9384035340631082-0.345541324963989j),
-	(-0.9394592236021899-0.34266071731199443j),
-	(-0.9405060705932683-0.339776884406827j),
-	(-0.9415440651830207-0.33688985339222033j),
-	(-0.9425731976014469-0.3339996514420094j),
-	(-0.9435934581619604-0.3311063057598765j),
-	(-0.9446048372614801-0.3282098435790927j),
-	(-0.9456073253805212-0.32531029216226326j),
-	(-0.9466009130832835-0.32240767880106985j),
-	(-0.9475855910177411-0.3195020308160158j),
-	(-0.9485613499157303-0.31659337555616607j),
-	(-0.9495281805930367-0.3136817403988914j),
-	(-0.9504860739494817-0.31076715274961153j),
-	(-0.9514350209690083-0.30784964004153503j),
-	(-0.9523750127197658-0.30492922973540265j),
-	(-0.9533060403541939-0.30200594931922803j),
-	(-0.9542280951091056-0.29907982630804053j),
-	(-0.9551411683057707-0.296150888243624j),
-	(-0.9560452513499963-0.29321916269425896j),
-	(-0.9569403357322088-0.2902846772544624j),
-	(-0.9578264130275329-0.2873474595447296j),
-	(-0.9587034748958715-0.2844075372112721j),
-	(-0.9595715130819845-0.2814649379257579j),
-	(-0.9604305194155658-0.27851968938505317j),
-	(-0.9612804858113206-0.2755718193109583j),
-	(-0.9621214042690415-0.27262135544994925j),
-	(-0.9629532668736839-0.2696683255729151j),
-	(-0.9637760657954398-0.2667127574748985j),
-	(-0.9645897932898126-0.26375467897483157j),
-	(-0.9653944416976893-0.26079411791527585j),
-	(-0.9661900034454125-0.257831102162159j),
-	(-0.9669764710448521-0.2548656596045147j),
-	(-0.9677538370934754-0.2518978181542172j),
-	(-0.9685220942744174-0.2489276057457201j),
-	(-0.9692812353565484-0.24595505033579465j),
-	(-0.970031253194544-0.24298017990326407j),
-	(-0.9707721407289502-0.24000302244874178j),
-	(-0.9715038909862518-0.23702360599436717j),
-	(-0.9722264970789363-0.2340419585835435j),
-	(-0.9729399522055601-0.23105810828067133j),
-	(-0.9736442496508119-0.22807208317088606j),
-	(-0.9743393827855759-0.22508391135979283j),
-	(-0.9750253450669941-0.22209362097320365j),
-	(-0.9757021300385285-0.21910124015687005j),
-	(-0.9763697313300211-0.21610679707621944j),
-	(-0.9770281426577544-0.21311031991609142j),
-	(-0.9776773578245099-0.2101118368804698j),
-	(-0.9783173707196275-0.20711137619221884j),
-	(-0.9789481753190622-0.20410896609281684j),
-	(-0.9795697656854405-0.201104634842092j),
-	(-0.9801821359681173-0.1980984107179538j),
-	(-0.9807852804032304-0.1950903220161286j),
-	(-0.9813791933137546-0.19208039704989247j),
-	(-0.9819638691095552-0.18906866414980636j),
-	(-0.9825393022874412-0.1860551516634469j),
-	(-0.9831054874312163-0.1830398879551409j),
-	(-0.9836624192117303-0.18002290140569957j),
-	(-0.984210092386929-0.17700422041214894j),
-	(-0.9847485018019042-0.17398387338746413j),
-	(-0.9852776423889412-0.17096188876030122j),
-	(-0.9857975091675674-0.16793829497473128j),
-	(-0.9863080972445986-0.16491312048997014j),
-	(-0.9868094018141855-0.16188639378011174j),
-	(-0.9873014181578584-0.15885814333386147j),
-	(-0.9877841416445722-0.15582839765426537j),
-	(-0.9882575677307495-0.15279718525844369j),
-	(-0.9887216919603238-0.14976453467732145j),
-	(-0.989176509964781-0.1467304744553618j),
-	(-0.9896220174632008-0.14369503315029464j),
-	(-0.990058210262297-0.14065823933284954j),
-	(-0.9904850842564571-0.13762012158648604j),
-	(-0.99090263542778-0.13458070850712628j),
-	(-0.9913108598461154-0.13154002870288334j),
-	(-0.9917097536690995-0.12849811079379309j),
-	(-0.9920993131421918-0.12545498341154626j),
-	(-0.99247953459871-0.12241067519921635j),
-	(-0.9928504144598651-0.11936521481099163j),
-	(-0.9932119492347945-0.11631863091190471j),
-	(-0.9935641355205953-0.11327095217756442j),
-	(-0.9939069700023561-0.11022220729388324j),
-	(-0.9942404494531879-0.10717242495680916j),
-	(-0.9945645707342554-0.10412163387205457j),
-	(-0.9948793307948056-0.10106986275482793j),
-	(-0.9951847266721968-0.09801714032956083j),
-	(-0.9954807554919269-0.09496349532963891j),
-	(-0.9957674144676598-0.09190895649713275j),
-	(-0.996044700901252-0.08885355258252475j),
-	(-0.996312612182778-0.08579731234444016j),
-	(-0.9965711457905548-0.08274026454937564j),
-	(-0.9968202992911657-0.0796824379714302j),
-	(-0.997060070339483-0.07662386139203169j),
-	(-0.9972904566786902-0.07356456359966773j),
-	(-0.9975114561403035-0.07050457338961386j),
-	(-0.9977230666441916-0.06744391956366418j),
-	(-0.997925286198596-0.0643826309298577j),
-	(-0.9981181129001492-0.06132073630220849j),
-	(-0.9983015449338929-0.058258264500435794j),
-	(-0.9984755805732948-0.055195244349690094j),
-	(-0.9986402181802652-0.052131704680283594j),
-	(-0.9987954562051724-0.049067674327417966j),
-	(-0.9989412931868569-0.046003182130914706j),
-	(-0.9990777277526454-0.04293825693494102j),
-	(-0.9992047586183639-0.03987292758774013j),
-	(-0.9993223845883495-0.03680722294135883j),
-	(-0.9994306045554617-0.033741171851377705j),
-	(-0.9995294175010931-0.030674803176636865j),
-	(-0.9996188224951786-0.02760814577896566j),
-	(-0.9996988186962042-0.024541228522912326j),
-	(-0.9997694053512153-0.021474080275469667j),
-	(-0.9998305817958234-0.0184067299058051j),
-	(-0.9998823474542126-0.01533920628498806j),
-	(-0.9999247018391445-0.012271538285720007j),
-	(-0.9999576445519639-0.00920375478206002j),
-	(-0.9999811752826011-0.006135884649154799j),
-	(-0.9999952938095762-0.003067956762965977j),
-};
-
-const double complex W₄₀₉₆²[2048] =
-{
-	(1+0j),
-	(0.9999988234517019-0.0015339801862847655j),
-	(0.9999952938095762-0.003067956762965976j),
-	(0.9999894110819284-0.0046019261204485705j),
-	(0.9999811752826011-0.006135884649154475j),
-	(0.9999705864309741-0.007669828739531097j),
-	(0.9999576445519639-0.00920375478205982j),
-	(0.9999423496760239-0.01073765916726449j),
-	(0.9999247018391445-0.012271538285719925j),
-	(0.9999047010828529-0.01380538852806039j),
-	(0.9998823474542126-0.0153392062849881j),
-	(0.9998576410058239-0.01687298794728171j),
-	(0.9998305817958234-0.01840672990580482j),
-	(0.9998011698878843-0.01994042855151444j),
-	(0.9997694053512153-0.021474080275469508j),
-	(0.9997352882605617-0.02300768146883937j),
-	(0.9996988186962042-0.024541228522912288j),
-	(0.9996599967439592-0.0260747178291039j),
-	(0.9996188224951786-0.02760814577896574j),
-	(0.9995752960467492-0.029141508764193722j),
-	(0.9995294175010931-0.030674803176636626j),
-	(0.999481186966167-0.032208025408304586j),
-	(0.9994306045554617-0.03374117185137758j),
-	(0.9993776703880028-0.03527423889821395j),
-	(0.9993223845883495-0.03680722294135883j),
-	(0.9992647472865944-0.038340120373552694j),
-	(0.9992047586183639-0.03987292758773981j),
-	(0.9991424187248169-0.04140564097707674j),
-	(0.9990777277526454-0.04293825693494082j),
-	(0.9990106858540734-0.04447077185493867j),
-	(0.9989412931868569-0.04600318213091462j),
-	(0.9988695499142836-0.0475354841569593j),
-	(0.9987954562051724-0.049067674327418015j),
-	(0.9987190122338729-0.05059974903689928j),
-	(0.9986402181802653-0.052131704680283324j),
-	(0.9985590742297593-0.05366353765273052j),
-	(0.9984755805732948-0.055195244349689934j),
-	(0.9983897374073402-0.05672682116690775j),
-	(0.9983015449338929-0.05825826450043575j),
-	(0.9982110033604782-0.05978957074663987j),
-	(0.9981181129001492-0.06132073630220858j),
-	(0.9980228737714862-0.0628517575641614j),
-	(0.997925286198596-0.06438263092985747j),
-	(0.9978253504111116-0.0659133527970038j),
-	(0.9977230666441916-0.06744391956366405j),
-	(0.9976184351385196-0.06897432762826675j),
-	(0.9975114561403035-0.07050457338961386j),
-	(0.9974021299012753-0.07203465324688933j),
-	(0.9972904566786902-0.07356456359966743j),
-	(0.9971764367353262-0.0750943008479213j),
-	(0.997060070339483-0.07662386139203149j),
-	(0.9969413577649822-0.07815324163279423j),
-	(0.9968202992911657-0.07968243797143013j),
-	(0.9966968952028961-0.08121144680959244j),
-	(0.9965711457905548-0.08274026454937569j),
-	(0.9964430513500426-0.08426888759332407j),
-	(0.996312612182778-0.0857973123444399j),
-	(0.996179828595697-0.08732553520619206j),
-	(0.996044700901252-0.0888535525825246j),
-	(0.9959072294174117-0.09038136087786498j),
-	(0.9957674144676598-0.09190895649713272j),
-	(0.9956252563809943-0.09343633584574779j),
-	(0.9954807554919269-0.09496349532963899j),
-	(0.9953339121404823-0.09649043135525259j),
-	(0.9951847266721969-0.0980171403295606j),
-	(0.9950331994381186-0.09954361866006932j),
-	(0.9948793307948056-0.10106986275482782j),
-	(0.9947231211043257-0.10259586902243628j),
-	(0.9945645707342554-0.10412163387205459j),
-	(0.9944036800576791-0.10564715371341062j),
-	(0.9942404494531879-0.10717242495680884j),
-	(0.9940748793048794-0.10869744401313872j),
-	(0.9939069700023561-0.11022220729388306j),
-	(0.9937367219407246-0.11174671121112659j),
-	(0.9935641355205953-0.11327095217756435j),
-	(0.9933892111480807-0.11479492660651008j),
-	(0.9932119492347945-0.11631863091190475j),
-	(0.9930323501978514-0.11784206150832498j),
-	(0.9928504144598651-0.11936521481099135j),
-	(0.992666142448948-0.12088808723577708j),
-	(0.99247953459871-0.1224106751992162j),
-	(0.9922905913482574-0.12393297511851216j),
-	(0.9920993131421918-0.12545498341154623j),
-	(0.9919057004306093-0.12697669649688587j),
-	(0.9917097536690995-0.12849811079379317j),
-	(0.9915114733187439-0.13001922272223335j),
-	(0.9913108598461154-0.13154002870288312j),
-	(0.9911079137232769-0.13306052515713906j),
-	(0.99090263542778-0.13458070850712617j),
-	(0.9906950254426646-0.1361005751757062j),
-	(0.9904850842564571-0.13762012158648604j),
-	(0.9902728123631691-0.1391393441638262j),
-	(0.9900582102622971-0.1406582393328492j),
-	(0.9898412784588205-0.14217680351944803j),
-	(0.9896220174632009-0.14369503315029447j),
-	(0.9894004277913804-0.14521292465284746j),
-	(0.989176509964781-0.14673047445536175j),
-	(0.988950264510303-0.14824767898689603j),
-	(0.9887216919603238-0.1497645346773215j),
-	(0.9884907928526966-0.15128103795733022j),
-	(0.9882575677307495-0.15279718525844344j),
-	(0.9880220171432835-0.1543129730130201j),
-	(0.9877841416445722-0.15582839765426523j),
-	(0.9875439417943592-0.15734345561623825j),
-	(0.9873014181578584-0.15885814333386145j),
-	(0.987056571305751-0.16037245724292828j),
-	(0.9868094018141855-0.16188639378011183j),
-	(0.9865599102647754-0.16339994938297323j),
-	(0.9863080972445987-0.16491312048996992j),
-	(0.9860539633461954-0.1664259035404641j),
-	(0.9857975091675675-0.16793829497473117j),
-	(0.9855387353121761-0.16945029123396796j),
-	(0.9852776423889412-0.17096188876030122j),
-	(0.9850142310122398-0.17247308399679595j),
-	(0.9847485018019042-0.17398387338746382j),
-	(0.9844804553832209-0.17549425337727143j),
-	(0.984210092386929-0.17700422041214875j),
-	(0.9839374134492189-0.1785137709389975j),
-	(0.9836624192117303-0.18002290140569951j),
-	(0.9833851103215512-0.18153160826112497j),
-	(0.9831054874312163-0.18303988795514095j),
-	(0.9828235511987052-0.18454773693861962j),
-	(0.9825393022874412-0.18605515166344663j),
-	(0.9822527413662894-0.1875621285825296j),
-	(0.9819638691095552-0.1890686641498062j),
-	(0.9816726861969831-0.19057475482025274j),
-	(0.9813791933137546-0.19208039704989244j),
-	(0.9810833911504867-0.1935855872958036j),
-	(0.9807852804032304-0.19509032201612825j),
-	(0.9804848617734694-0.19659459767008022j),
-	(0.9801821359681174-0.19809841071795356j),
-	(0.9798771036995176-0.19960175762113097j),
-	(0.9795697656854405-0.2011046348420919j),
-	(0.979260122649082-0.20260703884442113j),
-	(0.9789481753190622-0.20410896609281687j),
-	(0.9786339244294232-0.20561041305309924j),
-	(0.9783173707196277-0.20711137619221856j),
-	(0.9779985149345571-0.20861185197826349j),
-	(0.9776773578245099-0.2101118368804696j),
-	(0.9773539001452-0.21161132736922755j),
-	(0.9770281426577544-0.21311031991609136j),
-	(0.9767000861287118-0.21460881099378676j),
-	(0.9763697313300211-0.21610679707621952j),
-	(0.976037079039039-0.21760427463848364j),
-	(0.9757021300385286-0.2191012401568698j),
-	(0.975364885116657-0.2205976901088735j),
-	(0.9750253450669941-0.2220936209732035j),
-	(0.9746835106885107-0.22358902922979j),
-	(0.9743393827855759-0.22508391135979283j),
-	(0.9739929621679558-0.22657826384561j),
-	(0.973644249650812-0.22807208317088573j),
-	(0.9732932460546982-0.22956536582051887j),
-	(0.9729399522055602-0.2310581082806711j),
-	(0.9725843689347322-0.23255030703877524j),
-	(0.9722264970789363-0.23404195858354343j),
-	(0.9718663374802794-0.2355330594049755j),
-	(0.9715038909862518-0.2370236059943672j),
-	(0.9711391584497251-0.23851359484431842j),
-	(0.9707721407289504-0.2400030224487415j),
-	(0.9704028386875555-0.24149188530286933j),
-	(0.970031253194544-0.24298017990326387j),
-	(0.9696573851242924-0.24446790274782415j),
-	(0.9692812353565485-0.2459550503357946j),
-	(0.9689028047764289-0.24744161916777327j),
-	(0.9685220942744174-0.24892760574572015j),
-	(0.9681391047463624-0.2504130065729652j),
-	(0.9677538370934755-0.25189781815421697j),
-	(0.9673662922223285-0.25338203699557016j),
-	(0.9669764710448521-0.25486565960451457j),
-	(0.9665843744783331-0.2563486824899429j),
-	(0.9661900034454125-0.257831102162159j),
-	(0.9657933588740837-0.25931291513288623j),
-	(0.9653944416976894-0.2607941179152755j),
-	(0.9649932528549203-0.2622747070239136j),
-	(0.9645897932898128-0.26375467897483135j),
-	(0.9641840639517458-0.2652340302855118j),
-	(0.9637760657954398-0.26671275747489837j),
-	(0.963365799780954-0.2681908570634032j),
-	(0.9629532668736839-0.2696683255729151j),
-	(0.9625384680443592-0.271145159526808j),
-	(0.9621214042690416-0.272621355449949j),
-	(0.9617020765291225-0.2740969098687064j),
-	(0.9612804858113206-0.27557181931095814j),
-	(0.9608566331076797-0.2770460803060999j),
-	(0.9604305194155658-0.27851968938505306j),
-	(0.960002145737666-0.2799926430802732j),
-	(0.9595715130819845-0.28146493792575794j),
-	(0.9591386224618419-0.2829365704570554j),
-	(0.9587034748958716-0.2844075372112719j),
-	(0.9582660714080177-0.2858778347270806j),
-	(0.9578264130275329-0.2873474595447295j),
-	(0.9573845007889759-0.2888164082060495j),
-	(0.9569403357322088-0.29028467725446233j),
-	(0.9564939189023951-0.29175226323498926j),
-	(0.9560452513499964-0.29321916269425863j),
-	(0.9555943341307711-0.2946853721805143j),
-	(0.9551411683057708-0.2961508882436238j),
-	(0.9546857549413383-0.2976157074350862j),
-	(0.9542280951091057-0.2990798263080405j),
-	(0.9537681898859903-0.30054324141727345j),
-	(0.9533060403541939-0.3020059493192281j),
-	(0.9528416476011987-0.3034679465720113j),
-	(0.9523750127197659-0.3049292297354024j),
-	(0.9519061368079323-0.3063897953708609j),
-	(0.9514350209690083-0.30784964004153487j),
-	(0.9509616663115751-0.3093087603122687j),
-	(0.9504860739494817-0.3107671527496115j),
-	(0.950008245001843-0.3122248139218249j),
-	(0.9495281805930367-0.3136817403988915j),
-	(0.9490458818527006-0.31513792875252244j),
-	(0.9485613499157303-0.31659337555616585j),
-	(0.9480745859222762-0.31804807738501495j),
-	(0.9475855910177411-0.3195020308160157j),
-	(0.9470943663527772-0.3209552324278752j),
-	(0.9466009130832835-0.32240767880106985j),
-	(0.9461052323704034-0.32385936651785285j),
-	(0.9456073253805213-0.3253102921622629j),
-	(0.9451071932852606-0.32676045232013173j),
-	(0.9446048372614803-0.3282098435790925j),
-	(0.9441002584912727-0.3296584625285875j),
-	(0.9435934581619604-0.33110630575987643j),
-	(0.9430844374660935-0.3325533698660442j),
-	(0.9425731976014469-0.3339996514420094j),
-	(0.9420597397710173-0.3354451470845316j),
-	(0.9415440651830208-0.33688985339222005j),
-	(0.9410261750508893-0.3383337669655411j),
-	(0.9405060705932683-0.33977688440682685j),
-	(0.939983753034014-0.34121920232028236j),
-	(0.9394592236021899-0.3426607173119944j),
-	(0.9389324835320646-0.3441014259899388j),
-	(0.9384035340631081-0.3455413249639891j),
-	(0.9378723764399899-0.3469804108459237j),
-	(0.937339011912575-0.34841868024943456j),
-	(0.9368034417359216-0.3498561297901349j),
-	(0.9362656671702783-0.3512927560855671j),
-	(0.9357256894810804-0.3527285557552107j),
-	(0.9351835099389476-0.35416352542049034j),
-	(0.9346391298196808-0.35559766170478385j),
-	(0.934092550404259-0.35703096123343j),
-	(0.9335437729788362-0.35846342063373654j),
-	(0.932992798834739-0.3598950365349881j),
-	(0.9324396292684624-0.3613258055684543j),
-	(0.9318842655816681-0.3627557243673972j),
-	(0.9313267090811804-0.3641847895670799j),
-	(0.9307669610789837-0.36561299780477385j),
-	(0.9302050228922191-0.3670403457197672j),
-	(0.9296408958431813-0.3684668299533723j),
-	(0.9290745812593159-0.3698924471489341j),
-	(0.9285060804732156-0.37131719395183754j),
-	(0.9279353948226179-0.37274106700951576j),
-	(0.9273625256504011-0.37416406297145793j),
-	(0.9267874743045817-0.3755861784892172j),
-	(0.9262102421383114-0.37700741021641826j),
-	(0.9256308305098727-0.37842775480876556j),
-	(0.9250492407826776-0.37984720892405116j),
-	(0.9244654743252626-0.3812657692221624j),
-	(0.9238795325112867-0.3826834323650898j),
-	(0.9232914167195276-0.38410019501693504j),
-	(0.9227011283338786-0.38551605384391885j),
-	(0.9221086687433452-0.3869310055143886j),
-	(0.921514039342042-0.38834504669882625j),
-	(0.9209172415291895-0.3897581740698564j),
-	(0.9203182767091106-0.39117038430225387j),
-	(0.9197171462912274-0.39258167407295147j),
-	(0.9191138516900578-0.3939920400610481j),
-	(0.9185083943252123-0.39540147894781635j),
-	(0.9179007756213905-0.3968099874167103j),
-	(0.9172909970083779-0.39821756215337356j),
-	(0.9166790599210427-0.3996241998456468j),
-	(0.9160649657993317-0.4010298971835756j),
-	(0.9154487160882678-0.40243465085941843j),
-	(0.9148303122379462-0.4038384575676541j),
-	(0.9142097557035307-0.40524131400498986j),
-	(0.9135870479452508-0.40664321687036903j),
-	(0.9129621904283982-0.4080441628649787j),
-	(0.9123351846233227-0.4094441486922576j),
-	(0.9117060320054299-0.4108431710579039j),
-	(0.9110747340551764-0.4122412266698829j),
-	(0.9104412922580672-0.4136383122384345j),
-	(0.9098057081046522-0.41503442447608163j),
-	(0.9091679830905224-0.41642956009763715j),
-	(0.9085281187163061-0.41782371582021227j),
-	(0.9078861164876663-0.4192168883632239j),
-	(0.9072419779152958-0.4206090744484025j),
-	(0.9065957045149153-0.4220002707997997j),
-	(0.9059472978072685-0.42339047414379605j),
-	(0.9052967593181188-0.4247796812091088j),
-	(0.9046440905782462-0.4261678887267996j),
-	(0.9039892931234433-0.4275550934302821j),
-	(0.9033323684945118-0.4289412920553295j),
-	(0.9026733182372588-0.4303264813400826j),
-	(0.9020121439024932-0.43171065802505726j),
-	(0.901348847046022-0.43309381885315196j),
-	(0.900683429228647-0.43447596056965565j),
-	(0.9000158920161603-0.4358570799222555j),
-	(0.8993462369793416-0.4372371736610441j),
-	(0.8986744656939538-0.43861623853852766j),
-	(0.8980005797407399-0.43999427130963326j),
-	(0.8973245807054183-0.44137126873171667j),
-	(0.8966464701786802-0.44274722756457j),
-	(0.8959662497561852-0.4441221445704292j),
-	(0.8952839210385576-0.44549601651398174j),
-	(0.8945994856313827-0.44686884016237416j),
-	(0.8939129451452033-0.4482406122852199j),
-	(0.8932243011955153-0.44961132965460654j),
-	(0.8925335554027646-0.45098098904510386j),
-	(0.8918407093923427-0.4523495872337709j),
-	(0.8911457647945832-0.45371712100016387j),
-	(0.8904487232447579-0.45508358712634384j),
-	(0.8897495863830728-0.4564489823968839j),
-	(0.8890483558546646-0.4578133035988772j),
-	(0.8883450333095964-0.4591765475219441j),
-	(0.8876396204028539-0.46053871095824j),
-	(0.8869321187943422-0.46189979070246273j),
-	(0.8862225301488806-0.46325978355186015j),
-	(0.8855108561362-0.4646186863062378j),
-	(0.8847970984309378-0.4659764957679662j),
-	(0.884081258712635-0.4673332087419884j),
-	(0.8833633386657316-0.4686888220358279j),
-	(0.8826433399795628-0.4700433324595956j),
-	(0.881921264348355-0.47139673682599764j),
-	(0.8811971134712221-0.4727490319503428j),
-	(0.8804708890521608-0.47410021465054997j),
-	(0.8797425928000474-0.47545028174715587j),
-	(0.8790122264286335-0.4767992300633221j),
-	(0.8782797916565416-0.478147056424843j),
-	(0.8775452902072614-0.479493757660153j),
-	(0.8768087238091457-0.48083933060033396j),
-	(0.8760700941954066-0.4821837720791227j),
-	(0.8753294031041109-0.48352707893291874j),
-	(0.8745866522781761-0.48486924800079106j),
-	(0.8738418434653669-0.4862102761244864j),
-	(0.8730949784182901-0.487550160148436j),
-	(0.8723460588943915-0.48888889691976317j),
-	(0.871595086655951-0.49022648328829116j),
-	(0.870842063470079-0.4915629161065499j),
-	(0.8700869911087115-0.49289819222978404j),
-	(0.8693298713486068-0.4942323085159597j),
-	(0.8685707059713409-0.49556526182577254j),
-	(0.8678094967633033-0.49689704902265447j),
-	(0.8670462455156926-0.49822766697278187j),
-	(0.866280954024513-0.49955711254508184j),
-	(0.8655136240905691-0.5008853826112407j),
-	(0.8647442575194624-0.5022124740457108j),
-	(0.8639728561215868-0.5035383837257176j),
-	(0.8631994217121242-0.5048631085312676j),
-	(0.8624239561110406-0.5061866453451552j),
-	(0.8616464611430813-0.5075089910529709j),
-	(0.8608669386377673-0.508830142543107j),
-	(0.8600853904293901-0.5101500967067668j),
-	(0.8593018183570085-0.5114688504379703j),
-	(0.8585162242644427-0.512786400633563j),
-	(0.8577286100002721-0.5141027441932217j),
-	(0.8569389774178288-0.5154178780194629j),
-	(0.8561473283751945-0.5167317990176499j),
-	(0.855353664735196-0.5180445040959993j),
-	(0.8545579883654005-0.5193559901655896j),
-	(0.8537603011381114-0.5206662541403672j),
-	(0.8529606049303636-0.5219752929371544j),
-	(0.8521589016239198-0.5232831034756564j),
-	(0.8513551931052652-0.524589682678469j),
-	(0.8505494812656035-0.5258950274710846j),
-	(0.8497417680008525-0.5271991347819013j),
-	(0.8489320552116396-0.5285020015422285j),
-	(0.8481203448032972-0.5298036246862946j),
-	(0.8473066386858583-0.531104001151255j),
-	(0.8464909387740521-0.5324031278771979j),
-	(0.8456732469872991-0.533701001807153j),
-	(0.8448535652497071-0.5349976198870972j),
-	(0.8440318954900664-0.5362929790659632j),
-	(0.8432082396418454-0.5375870762956454j),
-	(0.8423825996431858-0.5388799085310084j),
-	(0.8415549774368984-0.5401714727298929j),
-	(0.8407253749704581-0.5414617658531234j),
-	(0.8398937941959995-0.5427507848645159j),
-	(0.8390602370703127-0.5440385267308838j),
-	(0.8382247055548381-0.5453249884220465j),
-	(0.8373872016156619-0.5466101669108349j),
-	(0.836547727223512-0.5478940591731002j),
-	(0.8357062843537526-0.5491766621877197j),
-	(0.83486287498638-0.5504579729366048j),
-	(0.8340175011060181-0.5517379884047073j),
-	(0.8331701647019132-0.5530167055800275j),
-	(0.8323208677679297-0.55429412145362j),
-	(0.8314696123025452-0.5555702330196022j),
-	(0.8306164003088463-0.5568450372751601j),
-	(0.829761233794523-0.5581185312205561j),
-	(0.8289041147718649-0.5593907118591361j),
-	(0.8280450452577558-0.560661576197336j),
-	(0.8271840272736691-0.5619311212446895j),
-	(0.8263210628456635-0.5631993440138341j),
-	(0.8254561540043776-0.5644662415205195j),
-	(0.8245893027850253-0.5657318107836131j),
-	(0.8237205112273914-0.5669960488251087j),
-	(0.8228497813758264-0.5682589526701315j),
-	(0.8219771152792416-0.5695205193469471j),
-	(0.8211025149911046-0.5707807458869673j),
-	(0.8202259825694347-0.572039629324757j),
-	(0.8193475200767969-0.5732971666980422j),
-	(0.8184671295802987-0.5745533550477158j),
-	(0.8175848131515837-0.5758081914178453j),
-	(0.8167005728668278-0.5770616728556794j),
-	(0.8158144108067338-0.5783137964116556j),
-	(0.8149263290565266-0.5795645591394056j),
-	(0.8140363297059484-0.5808139580957645j),
-	(0.8131444148492536-0.5820619903407754j),
-	(0.8122505865852039-0.5833086529376983j),
-	(0.8113548470170637-0.5845539429530153j),
-	(0.8104571982525948-0.5857978574564389j),
-	(0.8095576424040513-0.587040393520918j),
-	(0.808656181588175-0.5882815482226452j),
-	(0.8077528179261904-0.5895213186410639j),
-	(0.8068475535437993-0.5907597018588742j),
-	(0.8059403905711763-0.591996694962041j),
-	(0.8050313311429637-0.5932322950397998j),
-	(0.8041203773982658-0.5944664991846644j),
-	(0.8032075314806449-0.5956993044924334j),
-	(0.8022927955381157-0.5969307080621965j),
-	(0.8013761717231402-0.5981607069963423j),
-	(0.8004576621926228-0.5993892984005645j),
-	(0.799537269107905-0.600616479383869j),
-	(0.7986149946347608-0.60184224705858j),
-	(0.7976908409433912-0.6030665985403482j),
-	(0.7967648102084188-0.604289530948156j),
-	(0.7958369046088836-0.6055110414043255j),
-	(0.794907126328237-0.6067311270345245j),
-	(0.7939754775543372-0.6079497849677736j),
-	(0.7930419604794436-0.6091670123364532j),
-	(0.7921065773002124-0.6103828062763095j),
-	(0.7911693302176902-0.6115971639264619j),
-	(0.79023022143731-0.6128100824294097j),
-	(0.7892892531688857-0.6140215589310384j),
-	(0.7883464276266063-0.6152315905806268j),
-	(0.7874017470290314-0.6164401745308536j),
-	(0.7864552135990858-0.6176473079378039j),
-	(0.7855068295640539-0.6188529879609763j),
-	(0.7845565971555752-0.6200572117632891j),
-	(0.7836045186096382-0.6212599765110876j),
-	(0.7826505961665757-0.62246127937415j),
-	(0.7816948320710594-0.6236611175256945j),
-	(0.7807372285720945-0.6248594881423863j),
-	(0.7797777879230146-0.6260563884043435j),
-	(0.778816512381476-0.6272518154951441j),
-	(0.7778534042094531-0.6284457666018327j),
-	(0.7768884656732324-0.629638238914927j),
-	(0.7759216990434077-0.6308292296284245j),
-	(0.7749531065948739-0.6320187359398091j),
-	(0.7739826906068229-0.6332067550500572j),
-	(0.773010453362737-0.6343932841636455j),
-	(0.7720363971503845-0.6355783204885561j),
-	(0.7710605242618138-0.6367618612362842j),
-	(0.7700828369933479-0.637943903621844j),
-	(0.7691033376455797-0.6391244448637757j),
-	(0.7681220285233654-0.6403034821841517j),
-	(0.7671389119358204-0.6414810128085832j),
-	(0.7661539901963129-0.6426570339662269j),
-	(0.765167265622459-0.6438315428897914j),
-	(0.7641787405361167-0.6450045368155439j),
-	(0.7631884172633813-0.6461760129833163j),
-	(0.7621962981345789-0.6473459686365121j),
-	(0.7612023854842618-0.6485144010221124j),
-	(0.7602066816512024-0.6496813073906832j),
-	(0.7592091889783881-0.6508466849963809j),
-	(0.7582099098130153-0.6520105310969595j),
-	(0.7572088465064846-0.6531728429537768j),
-	(0.7562060014143945-0.6543336178318004j),
-	(0.7552013768965365-0.6554928529996153j),
-	(0.7541949753168892-0.6566505457294289j),
-	(0.7531867990436125-0.6578066932970786j),
-	(0.7521768504490428-0.6589612929820373j),
-	(0.7511651319096865-0.6601143420674205j),
-	(0.7501516458062151-0.6612658378399923j),
-	(0.7491363945234594-0.6624157775901718j),
-	(0.7481193804504036-0.6635641586120398j),
-	(0.7471006059801801-0.6647109782033448j),
-	(0.7460800735100638-0.6658562336655097j),
-	(0.7450577854414661-0.6669999223036375j),
-	(0.7440337441799293-0.6681420414265185j),
-	(0.7430079521351217-0.669282588346636j),
-	(0.7419804117208311-0.6704215603801731j),
-	(0.7409511253549591-0.6715589548470183j),
-	(0.7399200954595162-0.6726947690707729j),
-	(0.7388873244606151-0.673829000378756j),
-	(0.737852814788466-0.6749616461020119j),
-	(0.7368165688773699-0.6760927035753159j),
-	(0.7357785891657136-0.6772221701371803j),
-	(0.7347388780959635-0.6783500431298615j),
-	(0.7336974381146604-0.679476319899365j),
-	(0.7326542716724128-0.680600997795453j),
-	(0.7316093812238926-0.6817240741716497j),
-	(0.7305627692278276-0.6828455463852481j),
-	(0.729514438146997-0.6839654117973154j),
-	(0.7284643904482252-0.6850836677727004j),
-	(0.7274126286023758-0.6862003116800386j),
-	(0.726359155084346-0.687315340891759j),
-	(0.7253039723730608-0.6884287527840904j),
-	(0.724247082951467-0.6895405447370668j),
-	(0.7231884893065275-0.6906507141345346j),
-	(0.7221281939292153-0.6917592583641577j),
-	(0.7210661993145081-0.6928661748174246j),
-	(0.7200025079613817-0.693971460889654j),
-	(0.7189371223728045-0.6950751139800009j),
-	(0.7178700450557317-0.696177131491463j),
-	(0.7168012785210995-0.6972775108308865j),
-	(0.7157308252838186-0.6983762494089729j),
-	(0.7146586878627691-0.6994733446402838j),
-	(0.7135848687807936-0.7005687939432483j),
-	(0.7125093705646923-0.7016625947401685j),
-	(0.7114321957452164-0.7027547444572253j),
-	(0.7103533468570624-0.7038452405244849j),
-	(0.7092728264388657-0.7049340803759049j),
-	(0.7081906370331954-0.7060212614493397j),
-	(0.7071067811865476-0.7071067811865475j),
-	(0.7060212614493397-0.7081906370331953j),
-	(0.704934080375905-0.7092728264388656j),
-	(0.7038452405244849-0.7103533468570623j),
-	(0.7027547444572253-0.7114321957452164j),
-	(0.7016625947401686-0.7125093705646923j),
-	(0.7005687939432484-0.7135848687807935j),
-	(0.6994733446402838-0.714658687862769j),
-	(0.6983762494089729-0.7157308252838186j),
-	(0.6972775108308866-0.7168012785210995j),
-	(0.696177131491463-0.7178700450557317j),
-	(0.6950751139800009-0.7189371223728044j),
-	(0.693971460889654-0.7200025079613817j),
-	(0.6928661748174247-0.7210661993145081j),
-	(0.6917592583641577-0.7221281939292153j),
-	(0.6906507141345347-0.7231884893065273j),
-	(0.6895405447370669-0.7242470829514669j),
-	(0.6884287527840905-0.7253039723730607j),
-	(0.6873153408917592-0.726359155084346j),
-	(0.6862003116800387-0.7274126286023758j),
-	(0.6850836677727004-0.7284643904482252j),
-	(0.6839654117973155-0.7295144381469969j),
-	(0.6828455463852481-0.7305627692278276j),
-	(0.6817240741716498-0.7316093812238925j),
-	(0.6806009977954531-0.7326542716724128j),
-	(0.6794763198993651-0.7336974381146603j),
-	(0.6783500431298616-0.7347388780959634j),
-	(0.6772221701371804-0.7357785891657135j),
-	(0.676092703575316-0.7368165688773698j),
-	(0.674961646102012-0.737852814788466j),
-	(0.6738290003787561-0.7388873244606151j),
-	(0.672694769070773-0.7399200954595161j),
-	(0.6715589548470183-0.7409511253549591j),
-	(0.6704215603801731-0.741980411720831j),
-	(0.669282588346636-0.7430079521351217j),
-	(0.6681420414265186-0.7440337441799292j),
-	(0.6669999223036375-0.745057785441466j),
-	(0.6658562336655097-0.7460800735100638j),
-	(0.6647109782033449-0.7471006059801801j),
-	(0.6635641586120399-0.7481193804504035j),
-	(0.6624157775901718-0.7491363945234593j),
-	(0.6612658378399923-0.750151645806215j),
-	(0.6601143420674205-0.7511651319096864j),
-	(0.6589612929820373-0.7521768504490427j),
-	(0.6578066932970786-0.7531867990436124j),
-	(0.656650545729429-0.7541949753168892j),
-	(0.6554928529996155-0.7552013768965365j),
-	(0.6543336178318006-0.7562060014143945j),
-	(0.6531728429537768-0.7572088465064845j),
-	(0.6520105310969595-0.7582099098130153j),
-	(0.650846684996381-0.759209188978388j),
-	(0.6496813073906832-0.7602066816512024j),
-	(0.6485144010221126-0.7612023854842618j),
-	(0.6473459686365121-0.7621962981345789j),
-	(0.6461760129833164-0.7631884172633813j),
-	(0.645004536815544-0.7641787405361167j),
-	(0.6438315428897915-0.765167265622459j),
-	(0.6426570339662269-0.7661539901963128j),
-	(0.6414810128085832-0.7671389119358204j),
-	(0.6403034821841517-0.7681220285233653j),
-	(0.6391244448637757-0.7691033376455796j),
-	(0.6379439036218442-0.7700828369933479j),
-	(0.6367618612362842-0.7710605242618137j),
-	(0.6355783204885562-0.7720363971503844j),
-	(0.6343932841636455-0.773010453362737j),
-	(0.6332067550500572-0.7739826906068228j),
-	(0.6320187359398091-0.7749531065948738j),
-	(0.6308292296284245-0.7759216990434076j),
-	(0.6296382389149271-0.7768884656732324j),
-	(0.6284457666018327-0.777853404209453j),
-	(0.6272518154951442-0.7788165123814759j),
-	(0.6260563884043435-0.7797777879230144j),
-	(0.6248594881423865-0.7807372285720944j),
-	(0.6236611175256946-0.7816948320710594j),
-	(0.6224612793741501-0.7826505961665757j),
-	(0.6212599765110877-0.7836045186096382j),
-	(0.6200572117632892-0.7845565971555752j),
-	(0.6188529879609763-0.7855068295640539j),
-	(0.617647307937804-0.7864552135990858j),
-	(0.6164401745308536-0.7874017470290313j),
-	(0.6152315905806268-0.7883464276266062j),
-	(0.6140215589310385-0.7892892531688857j),
-	(0.6128100824294097-0.79023022143731j),
-	(0.611597163926462-0.7911693302176901j),
-	(0.6103828062763095-0.7921065773002124j),
-	(0.6091670123364532-0.7930419604794436j),
-	(0.6079497849677737-0.7939754775543372j),
-	(0.6067311270345245-0.794907126328237j),
-	(0.6055110414043255-0.7958369046088835j),
-	(0.6042895309481561-0.7967648102084187j),
-	(0.6030665985403483-0.797690840943391j),
-	(0.60184224705858-0.7986149946347608j),
-	(0.600616479383869-0.799537269107905j),
-	(0.5993892984005645-0.8004576621926227j),
-	(0.5981607069963424-0.8013761717231401j),
-	(0.5969307080621965-0.8022927955381157j),
-	(0.5956993044924335-0.8032075314806448j),
-	(0.5944664991846645-0.8041203773982657j),
-	(0.5932322950397998-0.8050313311429637j),
-	(0.591996694962041-0.8059403905711763j),
-	(0.5907597018588743-0.8068475535437992j),
-	(0.5895213186410639-0.8077528179261904j),
-	(0.5882815482226453-0.808656181588175j),
-	(0.5870403935209181-0.8095576424040513j),
-	(0.5857978574564389-0.8104571982525948j),
-	(0.5845539429530153-0.8113548470170637j),
-	(0.5833086529376983-0.8122505865852039j),
-	(0.5820619903407755-0.8131444148492536j),
-	(0.5808139580957645-0.8140363297059483j),
-	(0.5795645591394057-0.8149263290565266j),
-	(0.5783137964116556-0.8158144108067338j),
-	(0.5770616728556796-0.8167005728668278j),
-	(0.5758081914178453-0.8175848131515837j),
-	(0.5745533550477158-0.8184671295802987j),
-	(0.5732971666980423-0.8193475200767969j),
-	(0.572039629324757-0.8202259825694347j),
-	(0.5707807458869674-0.8211025149911046j),
-	(0.5695205193469473-0.8219771152792416j),
-	(0.5682589526701315-0.8228497813758263j),
-	(0.5669960488251087-0.8237205112273913j),
-	(0.5657318107836132-0.8245893027850253j),
-	(0.5644662415205195-0.8254561540043774j),
-	(0.5631993440138341-0.8263210628456634j),
-	(0.5619311212446895-0.827184027273669j),
-	(0.560661576197336-0.8280450452577558j),
-	(0.5593907118591361-0.8289041147718649j),
-	(0.5581185312205561-0.829761233794523j),
-	(0.5568450372751601-0.8306164003088462j),
-	(0.5555702330196023-0.8314696123025452j),
-	(0.5542941214536201-0.8323208677679297j),
-	(0.5530167055800276-0.8331701647019132j),
-	(0.5517379884047074-0.8340175011060181j),
-	(0.5504579729366048-0.83486287498638j),
-	(0.5491766621877198-0.8357062843537526j),
-	(0.5478940591731002-0.8365477272235119j),
-	(0.5466101669108349-0.8373872016156619j),
-	(0.5453249884220465-0.838224705554838j),
-	(0.5440385267308839-0.8390602370703126j),
-	(0.542750784864516-0.8398937941959994j),
-	(0.5414617658531236-0.8407253749704581j),
-	(0.540171472729893-0.8415549774368983j),
-	(0.5388799085310084-0.842382599643186j),
-	(0.5375870762956455-0.8432082396418454j),
-	(0.5362929790659632-0.8440318954900664j),
-	(0.5349976198870973-0.844853565249707j),
-	(0.533701001807153-0.8456732469872991j),
-	(0.532403127877198-0.846490938774052j),
-	(0.531104001151255-0.8473066386858583j),
-	(0.5298036246862948-0.8481203448032971j),
-	(0.5285020015422285-0.8489320552116396j),
-	(0.5271991347819014-0.8497417680008524j),
-	(0.5258950274710847-0.8505494812656034j),
-	(0.5245896826784688-0.8513551931052652j),
-	(0.5232831034756564-0.8521589016239198j),
-	(0.5219752929371544-0.8529606049303636j),
-	(0.5206662541403673-0.8537603011381113j),
-	(0.5193559901655895-0.8545579883654005j),
-	(0.5180445040959993-0.855353664735196j),
-	(0.51673179901765-0.8561473283751945j),
-	(0.5154178780194631-0.8569389774178287j),
-	(0.5141027441932217-0.8577286100002721j),
-	(0.5127864006335631-0.8585162242644427j),
-	(0.5114688504379705-0.8593018183570084j),
-	(0.5101500967067667-0.8600853904293901j),
-	(0.508830142543107-0.8608669386377673j),
-	(0.5075089910529709-0.8616464611430813j),
-	(0.5061866453451555-0.8624239561110405j),
-	(0.5048631085312675-0.8631994217121242j),
-	(0.5035383837257176-0.8639728561215867j),
-	(0.5022124740457109-0.8647442575194624j),
-	(0.5008853826112409-0.865513624090569j),
-	(0.4995571125450819-0.866280954024513j),
-	(0.49822766697278187-0.8670462455156926j),
-	(0.49689704902265464-0.8678094967633032j),
-	(0.4955652618257725-0.8685707059713409j),
-	(0.49423230851595973-0.8693298713486067j),
-	(0.4928981922297841-0.8700869911087113j),
-	(0.49156291610655006-0.8708420634700789j),
-	(0.4902264832882911-0.8715950866559511j),
-	(0.4888888969197632-0.8723460588943915j),
-	(0.48755016014843605-0.8730949784182901j),
-	(0.48621027612448653-0.8738418434653668j),
-	(0.4848692480007911-0.8745866522781761j),
-	(0.48352707893291874-0.8753294031041108j),
-	(0.48218377207912283-0.8760700941954066j),
-	(0.4808393306003339-0.8768087238091458j),
-	(0.479493757660153-0.8775452902072612j),
-	(0.4781470564248431-0.8782797916565415j),
-	(0.47679923006332225-0.8790122264286334j),
-	(0.47545028174715587-0.8797425928000474j),
-	(0.47410021465055-0.8804708890521608j),
-	(0.4727490319503429-0.881197113471222j),
-	(0.4713967368259978-0.8819212643483549j),
-	(0.4700433324595956-0.8826433399795628j),
-	(0.46868882203582796-0.8833633386657316j),
-	(0.4673332087419885-0.884081258712635j),
-	(0.4659764957679661-0.8847970984309378j),
-	(0.4646186863062378-0.8855108561362j),
-	(0.46325978355186026-0.8862225301488806j),
-	(0.46189979070246284-0.8869321187943421j),
-	(0.46053871095824-0.8876396204028539j),
-	(0.45917654752194415-0.8883450333095962j),
-	(0.4578133035988773-0.8890483558546646j),
-	(0.45644898239688386-0.8897495863830729j),
-	(0.45508358712634384-0.8904487232447579j),
-	(0.4537171210001639-0.8911457647945832j),
-	(0.452349587233771-0.8918407093923427j),
-	(0.4509809890451038-0.8925335554027647j),
-	(0.4496113296546066-0.8932243011955153j),
-	(0.44824061228522-0.8939129451452033j),
-	(0.4468688401623743-0.8945994856313826j),
-	(0.44549601651398174-0.8952839210385576j),
-	(0.44412214457042926-0.8959662497561851j),
-	(0.44274722756457013-0.8966464701786802j),
-	(0.4413712687317166-0.8973245807054183j),
-	(0.43999427130963326-0.8980005797407399j),
-	(0.4386162385385277-0.8986744656939538j),
-	(0.4372371736610442-0.8993462369793415j),
-	(0.4358570799222555-0.9000158920161603j),
-	(0.4344759605696557-0.9006834292286469j),
-	(0.433093818853152-0.901348847046022j),
-	(0.43171065802505737-0.9020121439024931j),
-	(0.4303264813400826-0.9026733182372588j),
-	(0.42894129205532955-0.9033323684945118j),
-	(0.4275550934302822-0.9039892931234433j),
-	(0.4261678887267996-0.9046440905782462j),
-	(0.4247796812091088-0.9052967593181188j),
-	(0.4233904741437961-0.9059472978072685j),
-	(0.4220002707997998-0.9065957045149153j),
-	(0.4206090744484025-0.9072419779152959j),
-	(0.41921688836322396-0.9078861164876662j),
-	(0.4178237158202124-0.9085281187163061j),
-	(0.4164295600976373-0.9091679830905223j),
-	(0.41503442447608163-0.9098057081046522j),
-	(0.41363831223843456-0.9104412922580671j),
-	(0.412241226669883-0.9110747340551762j),
-	(0.4108431710579039-0.9117060320054299j),
-	(0.4094441486922576-0.9123351846233227j),
-	(0.40804416286497874-0.9129621904283981j),
-	(0.40664321687036914-0.9135870479452508j),
-	(0.40524131400498986-0.9142097557035307j),
-	(0.40383845756765413-0.9148303122379461j),
-	(0.40243465085941854-0.9154487160882678j),
-	(0.4010298971835758-0.9160649657993316j),
-	(0.3996241998456468-0.9166790599210427j),
-	(0.3982175621533736-0.9172909970083779j),
-	(0.3968099874167104-0.9179007756213904j),
-	(0.3954014789478163-0.9185083943252123j),
-	(0.3939920400610481-0.9191138516900578j),
-	(0.3925816740729515-0.9197171462912274j),
-	(0.391170384302254-0.9203182767091105j),
-	(0.3897581740698564-0.9209172415291895j),
-	(0.3883450466988263-0.9215140393420419j),
-	(0.3869310055143887-0.9221086687433451j),
-	(0.385516053843919-0.9227011283338785j),
-	(0.38410019501693504-0.9232914167195276j),
-	(0.38268343236508984-0.9238795325112867j),
-	(0.3812657692221625-0.9244654743252626j),
-	(0.3798472089240511-0.9250492407826776j),
-	(0.3784277548087656-0.9256308305098727j),
-	(0.3770074102164183-0.9262102421383113j),
-	(0.3755861784892173-0.9267874743045817j),
-	(0.374164062971458-0.9273625256504011j),
-	(0.3727410670095158-0.9279353948226179j),
-	(0.3713171939518376-0.9285060804732155j),
-	(0.36989244714893427-0.9290745812593157j),
-	(0.3684668299533723-0.9296408958431813j),
-	(0.36704034571976724-0.9302050228922191j),
-	(0.36561299780477396-0.9307669610789837j),
-	(0.36418478956707984-0.9313267090811804j),
-	(0.3627557243673972-0.9318842655816681j),
-	(0.36132580556845434-0.9324396292684624j),
-	(0.3598950365349883-0.9329927988347388j),
-	(0.35846342063373654-0.9335437729788362j),
-	(0.35703096123343003-0.9340925504042589j),
-	(0.35559766170478396-0.9346391298196808j),
-	(0.3541635254204905-0.9351835099389475j),
-	(0.3527285557552107-0.9357256894810804j),
-	(0.35129275608556715-0.9362656671702783j),
-	(0.34985612979013503-0.9368034417359216j),
-	(0.3484186802494345-0.937339011912575j),
-	(0.3469804108459237-0.9378723764399899j),
-	(0.34554132496398915-0.9384035340631081j),
-	(0.344101425989939-0.9389324835320645j),
-	(0.3426607173119944-0.9394592236021899j),
-	(0.3412192023202824-0.9399837530340139j),
-	(0.33977688440682696-0.9405060705932683j),
-	(0.3383337669655413-0.9410261750508893j),
-	(0.33688985339222005-0.9415440651830208j),
-	(0.33544514708453166-0.9420597397710173j),
-	(0.3339996514420095-0.9425731976014469j),
-	(0.3325533698660442-0.9430844374660935j),
-	(0.33110630575987643-0.9435934581619604j),
-	(0.32965846252858755-0.9441002584912727j),
-	(0.32820984357909266-0.9446048372614803j),
-	(0.3267604523201318-0.9451071932852606j),
-	(0.325310292162263-0.9456073253805213j),
-	(0.32385936651785296-0.9461052323704033j),
-	(0.32240767880107-0.9466009130832835j),
-	(0.3209552324278752-0.9470943663527772j),
-	(0.31950203081601575-0.9475855910177411j),
-	(0.31804807738501506-0.9480745859222762j),
-	(0.31659337555616585-0.9485613499157303j),
-	(0.31513792875252244-0.9490458818527006j),
-	(0.3136817403988916-0.9495281805930367j),
-	(0.31222481392182505-0.950008245001843j),
-	(0.3107671527496115-0.9504860739494817j),
-	(0.3093087603122688-0.9509616663115751j),
-	(0.307849640041535-0.9514350209690083j),
-	(0.3063897953708611-0.9519061368079322j),
-	(0.30492922973540243-0.9523750127197659j),
-	(0.30346794657201137-0.9528416476011987j),
-	(0.3020059493192282-0.9533060403541938j),
-	(0.3005432414172734-0.9537681898859903j),
-	(0.2990798263080405-0.9542280951091057j),
-	(0.2976157074350863-0.9546857549413383j),
-	(0.29615088824362396-0.9551411683057707j),
-	(0.2946853721805143-0.9555943341307711j),
-	(0.2932191626942587-0.9560452513499964j),
-	(0.2917522632349894-0.956493918902395j),
-	(0.29028467725446233-0.9569403357322089j),
-	(0.2888164082060495-0.9573845007889759j),
-	(0.28734745954472957-0.9578264130275329j),
-	(0.2858778347270807-0.9582660714080177j),
-	(0.2844075372112718-0.9587034748958716j),
-	(0.2829365704570554-0.9591386224618419j),
-	(0.28146493792575805-0.9595715130819845j),
-	(0.2799926430802734-0.9600021457376658j),
-	(0.27851968938505306-0.9604305194155658j),
-	(0.27704608030609995-0.9608566331076797j),
-	(0.27557181931095825-0.9612804858113206j),
-	(0.27409690986870633-0.9617020765291225j),
-	(0.272621355449949-0.9621214042690416j),
-	(0.27114515952680807-0.9625384680443592j),
-	(0.2696683255729152-0.9629532668736839j),
-	(0.2681908570634032-0.963365799780954j),
-	(0.2667127574748984-0.9637760657954398j),
-	(0.2652340302855119-0.9641840639517457j),
-	(0.2637546789748315-0.9645897932898126j),
-	(0.2622747070239136-0.9649932528549203j),
-	(0.26079411791527557-0.9653944416976894j),
-	(0.25931291513288635-0.9657933588740836j),
-	(0.25783110216215893-0.9661900034454126j),
-	(0.2563486824899429-0.9665843744783331j),
-	(0.2548656596045146-0.9669764710448521j),
-	(0.25338203699557027-0.9673662922223285j),
-	(0.2518978181542169-0.9677538370934755j),
-	(0.2504130065729653-0.9681391047463623j),
-	(0.24892760574572026-0.9685220942744173j),
-	(0.24744161916777344-0.9689028047764289j),
-	(0.2459550503357946-0.9692812353565485j),
-	(0.2444679027478242-0.9696573851242924j),
-	(0.24298017990326398-0.970031253194544j),
-	(0.2414918853028693-0.9704028386875555j),
-	(0.2400030224487415-0.9707721407289504j),
-	(0.2385135948443185-0.9711391584497251j),
-	(0.23702360599436734-0.9715038909862518j),
-	(0.23553305940497546-0.9718663374802794j),
-	(0.23404195858354346-0.9722264970789363j),
-	(0.23255030703877533-0.9725843689347322j),
-	(0.23105810828067128-0.9729399522055601j),
-	(0.22956536582051887-0.9732932460546982j),
-	(0.2280720831708858-0.9736442496508119j),
-	(0.2265782638456101-0.9739929621679558j),
-	(0.22508391135979278-0.9743393827855759j),
-	(0.22358902922979002-0.9746835106885107j),
-	(0.2220936209732036-0.9750253450669941j),
-	(0.22059769010887365-0.9753648851166569j),
-	(0.21910124015686977-0.9757021300385286j),
-	(0.21760427463848367-0.976037079039039j),
-	(0.2161067970762196-0.9763697313300211j),
-	(0.21460881099378692-0.9767000861287118j),
-	(0.21311031991609136-0.9770281426577544j),
-	(0.2116113273692276-0.9773539001452j),
-	(0.21011183688046972-0.9776773578245099j),
-	(0.20861185197826346-0.9779985149345571j),
-	(0.20711137619221856-0.9783173707196277j),
-	(0.20561041305309932-0.9786339244294231j),
-	(0.204108966092817-0.9789481753190622j),
-	(0.2026070388444211-0.979260122649082j),
-	(0.20110463484209196-0.9795697656854405j),
-	(0.19960175762113105-0.9798771036995176j),
-	(0.19809841071795373-0.9801821359681173j),
-	(0.19659459767008022-0.9804848617734694j),
-	(0.19509032201612833-0.9807852804032304j),
-	(0.19358558729580375-0.9810833911504866j),
-	(0.19208039704989238-0.9813791933137546j),
-	(0.1905747548202528-0.9816726861969831j),
-	(0.18906866414980628-0.9819638691095552j),
-	(0.18756212858252974-0.9822527413662894j),
-	(0.18605515166344663-0.9825393022874412j),
-	(0.18454773693861964-0.9828235511987052j),
-	(0.18303988795514106-0.9831054874312163j),
-	(0.18153160826112513-0.9833851103215512j),
-	(0.18002290140569951-0.9836624192117303j),
-	(0.1785137709389976-0.9839374134492189j),
-	(0.17700422041214886-0.984210092386929j),
-	(0.17549425337727137-0.9844804553832209j),
-	(0.17398387338746385-0.9847485018019042j),
-	(0.17247308399679603-0.9850142310122398j),
-	(0.17096188876030136-0.9852776423889412j),
-	(0.16945029123396793-0.9855387353121761j),
-	(0.16793829497473123-0.9857975091675674j),
-	(0.16642590354046422-0.9860539633461954j),
-	(0.1649131204899701-0.9863080972445987j),
-	(0.16339994938297323-0.9865599102647754j),
-	(0.16188639378011188-0.9868094018141854j),
-	(0.1603724572429284-0.987056571305751j),
-	(0.1588581433338614-0.9873014181578584j),
-	(0.15734345561623828-0.9875439417943592j),
-	(0.15582839765426532-0.9877841416445722j),
-	(0.15431297301302024-0.9880220171432835j),
-	(0.1527971852584434-0.9882575677307495j),
-	(0.15128103795733025-0.9884907928526966j),
-	(0.14976453467732162-0.9887216919603238j),
-	(0.1482476789868962-0.988950264510303j),
-	(0.14673047445536175-0.989176509964781j),
-	(0.14521292465284752-0.9894004277913804j),
-	(0.14369503315029458-0.9896220174632008j),
-	(0.142176803519448-0.9898412784588205j),
-	(0.14065823933284924-0.9900582102622971j),
-	(0.13913934416382628-0.9902728123631691j),
-	(0.13762012158648618-0.990485084256457j),
-	(0.1361005751757062-0.9906950254426646j),
-	(0.13458070850712622-0.99090263542778j),
-	(0.13306052515713918-0.9911079137232768j),
-	(0.13154002870288328-0.9913108598461154j),
-	(0.13001922272223335-0.9915114733187439j),
-	(0.12849811079379322-0.9917097536690995j),
-	(0.12697669649688598-0.9919057004306093j),
-	(0.1254549834115462-0.9920993131421918j),
-	(0.1239329751185122-0.9922905913482574j),
-	(0.12241067519921628-0.99247953459871j),
-	(0.12088808723577722-0.992666142448948j),
-	(0.11936521481099135-0.9928504144598651j),
-	(0.11784206150832502-0.9930323501978514j),
-	(0.11631863091190488-0.9932119492347945j),
-	(0.11479492660651025-0.9933892111480807j),
-	(0.11327095217756436-0.9935641355205953j),
-	(0.11174671121112666-0.9937367219407246j),
-	(0.11022220729388318-0.9939069700023561j),
-	(0.10869744401313867-0.9940748793048794j),
-	(0.10717242495680887-0.9942404494531879j),
-	(0.1056471537134107-0.9944036800576791j),
-	(0.10412163387205473-0.9945645707342554j),
-	(0.10259586902243628-0.9947231211043257j),
-	(0.10106986275482788-0.9948793307948056j),
-	(0.09954361866006944-0.9950331994381186j),
-	(0.09801714032956077-0.9951847266721968j),
-	(0.0964904313552526-0.9953339121404823j),
-	(0.09496349532963906-0.9954807554919269j),
-	(0.09343633584574791-0.9956252563809943j),
-	(0.0919089564971327-0.9957674144676598j),
-	(0.09038136087786501-0.9959072294174117j),
-	(0.08885355258252468-0.996044700901252j),
-	(0.08732553520619223-0.9961798285956969j),
-	(0.08579731234443988-0.996312612182778j),
-	(0.08426888759332413-0.9964430513500426j),
-	(0.0827402645493758-0.9965711457905548j),
-	(0.08121144680959239-0.9966968952028961j),
-	(0.07968243797143013-0.9968202992911657j),
-	(0.07815324163279432-0.9969413577649822j),
-	(0.07662386139203162-0.997060070339483j),
-	(0.07509430084792129-0.9971764367353262j),
-	(0.07356456359966745-0.9972904566786902j),
-	(0.07203465324688942-0.9974021299012753j),
-	(0.07050457338961401-0.9975114561403035j),
-	(0.06897432762826673-0.9976184351385196j),
-	(0.0674439195636641-0.9977230666441916j),
-	(0.06591335279700393-0.9978253504111116j),
-	(0.06438263092985741-0.997925286198596j),
-	(0.06285175756416142-0.9980228737714862j),
-	(0.06132073630220865-0.9981181129001492j),
-	(0.05978957074664001-0.9982110033604782j),
-	(0.05825826450043573-0.9983015449338929j),
-	(0.05672682116690778-0.9983897374073402j),
-	(0.05519524434969003-0.9984755805732948j),
-	(0.05366353765273068-0.9985590742297593j),
-	(0.05213170468028332-0.9986402181802653j),
-	(0.05059974903689934-0.9987190122338729j),
-	(0.049067674327418126-0.9987954562051724j),
-	(0.04753548415695926-0.9988695499142836j),
-	(0.046003182130914644-0.9989412931868569j),
-	(0.044470771854938744-0.9990106858540734j),
-	(0.04293825693494096-0.9990777277526454j),
-	(0.04140564097707671-0.9991424187248169j),
-	(0.039872927587739845-0.9992047586183639j),
-	(0.03834012037355279-0.9992647472865944j),
-	(0.03680722294135899-0.9993223845883495j),
-	(0.03527423889821395-0.9993776703880028j),
-	(0.03374117185137764-0.9994306045554617j),
-	(0.032208025408304704-0.999481186966167j),
-	(0.03067480317663658-0.9995294175010931j),
-	(0.02914150876419374-0.9995752960467492j),
-	(0.02760814577896582-0.9996188224951786j),
-	(0.02607471782910404-0.9996599967439592j),
-	(0.024541228522912264-0.9996988186962042j),
-	(0.02300768146883941-0.9997352882605617j),
-	(0.021474080275469605-0.9997694053512153j),
-	(0.019940428551514598-0.9998011698878843j),
-	(0.01840672990580482-0.9998305817958234j),
-	(0.016872987947281773-0.9998576410058239j),
-	(0.01533920628498822-0.9998823474542126j),
-	(0.013805388528060349-0.9999047010828529j),
-	(0.012271538285719944-0.9999247018391445j),
-	(0.010737659167264572-0.9999423496760239j),
-	(0.00920375478205996-0.9999576445519639j),
-	(0.007669828739531077-0.9999705864309741j),
-	(0.006135884649154515-0.9999811752826011j),
-	(0.004601926120448672-0.9999894110819284j),
-	(0.003067956762966138-0.9999952938095762j),
-	(0.0015339801862847662-0.9999988234517019j),
-	(6.123233995736766e-17-1j),
-	(-0.0015339801862846436-0.9999988234517019j),
-	(-0.0030679567629660156-0.9999952938095762j),
-	(-0.00460192612044855-0.9999894110819284j),
-	(-0.006135884649154393-0.9999811752826011j),
-	(-0.007669828739530955-0.9999705864309741j),
-	(-0.009203754782059837-0.9999576445519639j),
-	(-0.010737659167264449-0.9999423496760239j),
-	(-0.012271538285719823-0.9999247018391445j),
-	(-0.013805388528060226-0.9999047010828529j),
-	(-0.015339206284988098-0.9998823474542126j),
-	(-0.01687298794728165-0.9998576410058239j),
-	(-0.018406729905804695-0.9998305817958234j),
-	(-0.019940428551514476-0.9998011698878843j),
-	(-0.021474080275469484-0.9997694053512153j),
-	(-0.02300768146883929-0.9997352882605617j),
-	(-0.024541228522912142-0.9996988186962042j),
-	(-0.026074717829103915-0.9996599967439592j),
-	(-0.027608145778965698-0.9996188224951786j),
-	(-0.029141508764193618-0.9995752960467492j),
-	(-0.03067480317663646-0.9995294175010931j),
-	(-0.03220802540830458-0.999481186966167j),
-	(-0.03374117185137752-0.9994306045554617j),
-	(-0.03527423889821382-0.9993776703880028j),
-	(-0.036807222941358866-0.9993223845883495j),
-	(-0.038340120373552666-0.9992647472865944j),
-	(-0.03987292758773973-0.9992047586183639j),
-	(-0.041405640977076594-0.9991424187248169j),
-	(-0.042938256934940834-0.9990777277526454j),
-	(-0.04447077185493862-0.9990106858540734j),
-	(-0.04600318213091452-0.9989412931868569j),
-	(-0.047535484156959136-0.9988695499142836j),
-	(-0.04906767432741801-0.9987954562051724j),
-	(-0.05059974903689921-0.9987190122338729j),
-	(-0.05213170468028319-0.9986402181802653j),
-	(-0.053663537652730554-0.9985590742297593j),
-	(-0.05519524434968991-0.9984755805732948j),
-	(-0.05672682116690766-0.9983897374073402j),
-	(-0.05825826450043561-0.9983015449338929j),
-	(-0.05978957074663988-0.9982110033604782j),
-	(-0.06132073630220853-0.9981181129001492j),
-	(-0.06285175756416131-0.9980228737714862j),
-	(-0.06438263092985728-0.997925286198596j),
-	(-0.0659133527970038-0.9978253504111116j),
-	(-0.06744391956366398-0.9977230666441916j),
-	(-0.06897432762826661-0.9976184351385196j),
-	(-0.0705045733896139-0.9975114561403035j),
-	(-0.07203465324688929-0.9974021299012753j),
-	(-0.07356456359966733-0.9972904566786902j),
-	(-0.07509430084792117-0.9971764367353262j),
-	(-0.0766238613920315-0.997060070339483j),
-	(-0.07815324163279419-0.9969413577649822j),
-	(-0.07968243797143001-0.9968202992911658j),
-	(-0.08121144680959226-0.9966968952028961j),
-	(-0.08274026454937568-0.9965711457905548j),
-	(-0.084268887593324-0.9964430513500426j),
-	(-0.08579731234443976-0.996312612182778j),
-	(-0.0873255352061921-0.9961798285956969j),
-	(-0.08885355258252456-0.996044700901252j),
-	(-0.09038136087786489-0.9959072294174117j),
-	(-0.09190895649713257-0.9957674144676598j),
-	(-0.09343633584574779-0.9956252563809943j),
-	(-0.09496349532963895-0.9954807554919269j),
-	(-0.09649043135525248-0.9953339121404823j),
-	(-0.09801714032956065-0.9951847266721969j),
-	(-0.09954361866006932-0.9950331994381186j),
-	(-0.10106986275482775-0.9948793307948056j),
-	(-0.10259586902243616-0.9947231211043257j),
-	(-0.1041216338720546-0.9945645707342554j),
-	(-0.10564715371341057-0.9944036800576791j),
-	(-0.10717242495680876-0.9942404494531879j),
-	(-0.10869744401313856-0.9940748793048795j),
-	(-0.11022220729388306-0.9939069700023561j),
-	(-0.11174671121112655-0.9937367219407246j),
-	(-0.11327095217756424-0.9935641355205953j),
-	(-0.11479492660651013-0.9933892111480807j),
-	(-0.11631863091190475-0.9932119492347945j),
-	(-0.1178420615083249-0.9930323501978514j),
-	(-0.11936521481099123-0.9928504144598651j),
-	(-0.1208880872357771-0.992666142448948j),
-	(-0.12241067519921615-0.99247953459871j),
-	(-0.12393297511851208-0.9922905913482574j),
-	(-0.12545498341154607-0.9920993131421918j),
-	(-0.12697669649688587-0.9919057004306093j),
-	(-0.1284981107937931-0.9917097536690995j),
-	(-0.13001922272223324-0.991511473318744j),
-	(-0.13154002870288314-0.9913108598461154j),
-	(-0.13306052515713904-0.9911079137232769j),
-	(-0.1345807085071261-0.99090263542778j),
-	(-0.13610057517570606-0.9906950254426646j),
-	(-0.13762012158648607-0.990485084256457j),
-	(-0.13913934416382617-0.9902728123631691j),
-	(-0.14065823933284913-0.9900582102622971j),
-	(-0.1421768035194479-0.9898412784588205j),
-	(-0.14369503315029444-0.9896220174632009j),
-	(-0.1452129246528474-0.9894004277913804j),
-	(-0.14673047445536164-0.989176509964781j),
-	(-0.1482476789868961-0.988950264510303j),
-	(-0.1497645346773215-0.9887216919603238j),
-	(-0.15128103795733014-0.9884907928526967j),
-	(-0.1527971852584433-0.9882575677307495j),
-	(-0.15431297301302013-0.9880220171432835j),
-	(-0.1558283976542652-0.9877841416445722j),
-	(-0.15734345561623816-0.9875439417943593j),
-	(-0.15885814333386128-0.9873014181578584j),
-	(-0.16037245724292826-0.987056571305751j),
-	(-0.16188639378011177-0.9868094018141855j),
-	(-0.16339994938297311-0.9865599102647755j),
-	(-0.16491312048996995-0.9863080972445987j),
-	(-0.1664259035404641-0.9860539633461954j),
-	(-0.1679382949747311-0.9857975091675675j),
-	(-0.16945029123396782-0.9855387353121761j),
-	(-0.17096188876030124-0.9852776423889412j),
-	(-0.17247308399679592-0.9850142310122398j),
-	(-0.1739838733874637-0.9847485018019042j),
-	(-0.17549425337727126-0.9844804553832209j),
-	(-0.17700422041214875-0.984210092386929j),
-	(-0.17851377093899745-0.9839374134492189j),
-	(-0.1800229014056994-0.9836624192117303j),
-	(-0.18153160826112502-0.9833851103215512j),
-	(-0.18303988795514092-0.9831054874312163j),
-	(-0.18454773693861953-0.9828235511987053j),
-	(-0.1860551516634465-0.9825393022874412j),
-	(-0.1875621285825296-0.9822527413662894j),
-	(-0.18906866414980616-0.9819638691095552j),
-	(-0.19057475482025266-0.9816726861969831j),
-	(-0.19208039704989227-0.9813791933137546j),
-	(-0.1935855872958036-0.9810833911504867j),
-	(-0.1950903220161282-0.9807852804032304j),
-	(-0.1965945976700801-0.9804848617734694j),
-	(-0.19809841071795362-0.9801821359681174j),
-	(-0.19960175762113094-0.9798771036995176j),
-	(-0.20110463484209182-0.9795697656854405j),
-	(-0.20260703884442097-0.9792601226490821j),
-	(-0.2041089660928169-0.9789481753190622j),
-	(-0.2056104130530992-0.9786339244294232j),
-	(-0.20711137619221845-0.9783173707196277j),
-	(-0.20861185197826332-0.9779985149345571j),
-	(-0.2101118368804696-0.9776773578245099j),
-	(-0.2116113273692275-0.9773539001452001j),
-	(-0.21311031991609125-0.9770281426577544j),
-	(-0.2146088109937868-0.9767000861287118j),
-	(-0.2161067970762195-0.9763697313300211j),
-	(-0.21760427463848356-0.9760370790390391j),
-	(-0.21910124015686966-0.9757021300385286j),
-	(-0.22059769010887353-0.975364885116657j),
-	(-0.22209362097320348-0.9750253450669941j),
-	(-0.22358902922978988-0.9746835106885107j),
-	(-0.22508391135979267-0.9743393827855759j),
-	(-0.22657826384561-0.9739929621679558j),
-	(-0.22807208317088568-0.973644249650812j),
-	(-0.22956536582051876-0.9732932460546982j),
-	(-0.23105810828067114-0.9729399522055602j),
-	(-0.23255030703877522-0.9725843689347322j),
-	(-0.23404195858354332-0.9722264970789364j),
-	(-0.23553305940497535-0.9718663374802794j),
-	(-0.23702360599436723-0.9715038909862518j),
-	(-0.2385135948443184-0.9711391584497251j),
-	(-0.2400030224487414-0.9707721407289504j),
-	(-0.24149188530286916-0.9704028386875555j),
-	(-0.24298017990326387-0.970031253194544j),
-	(-0.2444679027478241-0.9696573851242924j),
-	(-0.24595505033579448-0.9692812353565485j),
-	(-0.24744161916777332-0.9689028047764289j),
-	(-0.24892760574572012-0.9685220942744174j),
-	(-0.25041300657296517-0.9681391047463624j),
-	(-0.2518978181542168-0.9677538370934755j),
-	(-0.25338203699557016-0.9673662922223285j),
-	(-0.2548656596045145-0.9669764710448521j),
-	(-0.2563486824899428-0.9665843744783331j),
-	(-0.2578311021621588-0.9661900034454126j),
-	(-0.25931291513288623-0.9657933588740837j),
-	(-0.26079411791527546-0.9653944416976894j),
-	(-0.2622747070239135-0.9649932528549204j),
-	(-0.2637546789748314-0.9645897932898128j),
-	(-0.2652340302855118-0.9641840639517458j),
-	(-0.2667127574748983-0.9637760657954398j),
-	(-0.268190857063403-0.963365799780954j),
-	(-0.2696683255729151-0.9629532668736839j),
-	(-0.27114515952680796-0.9625384680443592j),
-	(-0.27262135544994887-0.9621214042690416j),
-	(-0.2740969098687062-0.9617020765291225j),
-	(-0.27557181931095814-0.9612804858113206j),
-	(-0.27704608030609984-0.9608566331076797j),
-	(-0.27851968938505295-0.9604305194155659j),
-	(-0.2799926430802733-0.9600021457376658j),
-	(-0.28146493792575794-0.9595715130819845j),
-	(-0.2829365704570553-0.959138622461842j),
-	(-0.2844075372112717-0.9587034748958716j),
-	(-0.2858778347270806-0.9582660714080177j),
-	(-0.28734745954472946-0.9578264130275329j),
-	(-0.28881640820604937-0.957384500788976j),
-	(-0.29028467725446216-0.9569403357322089j),
-	(-0.29175226323498926-0.9564939189023951j),
-	(-0.2932191626942586-0.9560452513499965j),
-	(-0.2946853721805142-0.9555943341307711j),
-	(-0.29615088824362384-0.9551411683057707j),
-	(-0.2976157074350862-0.9546857549413383j),
-	(-0.29907982630804036-0.9542280951091057j),
-	(-0.3005432414172733-0.9537681898859903j),
-	(-0.3020059493192281-0.9533060403541939j),
-	(-0.30346794657201126-0.9528416476011987j),
-	(-0.30492922973540226-0.9523750127197659j),
-	(-0.306389795370861-0.9519061368079323j),
-	(-0.30784964004153487-0.9514350209690083j),
-	(-0.3093087603122686-0.9509616663115751j),
-	(-0.31076715274961136-0.9504860739494818j),
-	(-0.31222481392182494-0.950008245001843j),
-	(-0.3136817403988914-0.9495281805930367j),
-	(-0.31513792875252233-0.9490458818527007j),
-	(-0.31659337555616573-0.9485613499157304j),
-	(-0.31804807738501495-0.9480745859222762j),
-	(-0.31950203081601564-0.9475855910177412j),
-	(-0.3209552324278751-0.9470943663527772j),
-	(-0.32240767880106985-0.9466009130832835j),
-	(-0.32385936651785285-0.9461052323704034j),
-	(-0.32531029216226287-0.9456073253805214j),
-	(-0.3267604523201316-0.9451071932852606j),
-	(-0.32820984357909255-0.9446048372614803j),
-	(-0.32965846252858744-0.9441002584912727j),
-	(-0.3311063057598763-0.9435934581619604j),
-	(-0.33255336986604406-0.9430844374660935j),
-	(-0.3339996514420094-0.9425731976014469j),
-	(-0.33544514708453155-0.9420597397710174j),
-	(-0.33688985339221994-0.9415440651830208j),
-	(-0.3383337669655412-0.9410261750508893j),
-	(-0.33977688440682685-0.9405060705932683j),
-	(-0.3412192023202823-0.939983753034014j),
-	(-0.34266071731199427-0.9394592236021899j),
-	(-0.34410142598993887-0.9389324835320645j),
-	(-0.34554132496398904-0.9384035340631082j),
-	(-0.34698041084592357-0.9378723764399899j),
-	(-0.3484186802494344-0.937339011912575j),
-	(-0.3498561297901349-0.9368034417359216j),
-	(-0.35129275608556704-0.9362656671702783j),
-	(-0.3527285557552106-0.9357256894810804j),
-	(-0.3541635254204904-0.9351835099389476j),
-	(-0.35559766170478385-0.9346391298196808j),
-	(-0.3570309612334299-0.934092550404259j),
-	(-0.35846342063373643-0.9335437729788363j),
-	(-0.35989503653498817-0.9329927988347388j),
-	(-0.36132580556845423-0.9324396292684624j),
-	(-0.3627557243673971-0.9318842655816681j),
-	(-0.3641847895670797-0.9313267090811805j),
-	(-0.36561299780477385-0.9307669610789837j),
-	(-0.3670403457197671-0.9302050228922191j),
-	(-0.3684668299533722-0.9296408958431813j),
-	(-0.36989244714893416-0.9290745812593157j),
-	(-0.3713171939518375-0.9285060804732156j),
-	(-0.3727410670095157-0.9279353948226179j),
-	(-0.3741640629714579-0.9273625256504011j),
-	(-0.3755861784892172-0.9267874743045817j),
-	(-0.3770074102164182-0.9262102421383114j),
-	(-0.37842775480876545-0.9256308305098728j),
-	(-0.379847208924051-0.9250492407826777j),
-	(-0.3812657692221624-0.9244654743252626j),
-	(-0.3826834323650897-0.9238795325112867j),
-	(-0.38410019501693493-0.9232914167195277j),
-	(-0.3855160538439189-0.9227011283338785j),
-	(-0.3869310055143886-0.9221086687433452j),
-	(-0.3883450466988262-0.921514039342042j),
-	(-0.3897581740698563-0.9209172415291895j),
-	(-0.39117038430225387-0.9203182767091106j),
-	(-0.3925816740729514-0.9197171462912274j),
-	(-0.393992040061048-0.9191138516900578j),
-	(-0.3954014789478162-0.9185083943252123j),
-	(-0.3968099874167103-0.9179007756213905j),
-	(-0.3982175621533735-0.917290997008378j),
-	(-0.3996241998456467-0.9166790599210427j),
-	(-0.4010298971835757-0.9160649657993317j),
-	(-0.40243465085941843-0.9154487160882678j),
-	(-0.403838457567654-0.9148303122379462j),
-	(-0.40524131400498975-0.9142097557035307j),
-	(-0.40664321687036903-0.9135870479452508j),
-	(-0.40804416286497863-0.9129621904283982j),
-	(-0.4094441486922575-0.9123351846233229j),
-	(-0.4108431710579038-0.9117060320054299j),
-	(-0.4122412266698829-0.9110747340551764j),
-	(-0.41363831223843445-0.9104412922580672j),
-	(-0.4150344244760815-0.9098057081046523j),
-	(-0.416429560097637-0.9091679830905225j),
-	(-0.41782371582021227-0.9085281187163061j),
-	(-0.41921688836322407-0.9078861164876662j),
-	(-0.4206090744484024-0.9072419779152959j),
-	(-0.4220002707997997-0.9065957045149153j),
-	(-0.42339047414379577-0.9059472978072686j),
-	(-0.4247796812091087-0.9052967593181188j),
-	(-0.42616788872679967-0.9046440905782461j),
-	(-0.42755509343028186-0.9039892931234434j),
-	(-0.42894129205532944-0.9033323684945118j),
-	(-0.4303264813400827-0.9026733182372588j),
-	(-0.4317106580250571-0.9020121439024933j),
-	(-0.4330938188531519-0.901348847046022j),
-	(-0.4344759605696558-0.9006834292286469j),
-	(-0.43585707992225536-0.9000158920161603j),
-	(-0.4372371736610441-0.8993462369793416j),
-	(-0.4386162385385274-0.8986744656939539j),
-	(-0.43999427130963314-0.8980005797407399j),
-	(-0.4413712687317167-0.8973245807054183j),
-	(-0.4427472275645698-0.8966464701786803j),
-	(-0.44412214457042914-0.8959662497561852j),
-	(-0.4454960165139818-0.8952839210385575j),
-	(-0.446868840162374-0.8945994856313828j),
-	(-0.4482406122852199-0.8939129451452033j),
-	(-0.4496113296546067-0.8932243011955152j),
-	(-0.4509809890451037-0.8925335554027647j),
-	(-0.4523495872337709-0.8918407093923427j),
-	(-0.4537171210001636-0.8911457647945834j),
-	(-0.4550835871263437-0.890448723244758j),
-	(-0.456448982396884-0.8897495863830728j),
-	(-0.457813303598877-0.8890483558546647j),
-	(-0.45917654752194403-0.8883450333095964j),
-	(-0.46053871095824006-0.8876396204028539j),
-	(-0.46189979070246256-0.8869321187943423j),
-	(-0.46325978355186015-0.8862225301488806j),
-	(-0.4646186863062379-0.8855108561361998j),
-	(-0.465976495767966-0.8847970984309379j),
-	(-0.4673332087419884-0.884081258712635j),
-	(-0.4686888220358277-0.8833633386657317j),
-	(-0.4700433324595955-0.8826433399795629j),
-	(-0.4713967368259977-0.881921264348355j),
-	(-0.47274903195034257-0.8811971134712222j),
-	(-0.4741002146505499-0.8804708890521609j),
-	(-0.475450281747156-0.8797425928000474j),
-	(-0.4767992300633219-0.8790122264286335j),
-	(-0.478147056424843-0.8782797916565416j),
-	(-0.4794937576601531-0.8775452902072612j),
-	(-0.4808393306003338-0.8768087238091458j),
-	(-0.4821837720791227-0.8760700941954066j),
-	(-0.48352707893291846-0.875329403104111j),
-	(-0.484869248000791-0.8745866522781762j),
-	(-0.4862102761244864-0.8738418434653669j),
-	(-0.4875501601484357-0.8730949784182902j),
-	(-0.4888888969197631-0.8723460588943915j),
-	(-0.4902264832882912-0.871595086655951j),
-	(-0.4915629161065498-0.870842063470079j),
-	(-0.492898192229784-0.8700869911087115j),
-	(-0.49423230851595984-0.8693298713486067j),
-	(-0.4955652618257724-0.868570705971341j),
-	(-0.4968970490226545-0.8678094967633032j),
-	(-0.4982276669727816-0.8670462455156928j),
-	(-0.4995571125450818-0.8662809540245131j),
-	(-0.5008853826112408-0.8655136240905691j),
-	(-0.5022124740457106-0.8647442575194625j),
-	(-0.5035383837257175-0.8639728561215868j),
-	(-0.5048631085312676-0.8631994217121242j),
-	(-0.5061866453451551-0.8624239561110406j),
-	(-0.5075089910529708-0.8616464611430813j),
-	(-0.5088301425431071-0.8608669386377672j),
-	(-0.5101500967067666-0.8600853904293903j),
-	(-0.5114688504379704-0.8593018183570084j),
-	(-0.5127864006335627-0.858516224264443j),
-	(-0.5141027441932217-0.8577286100002721j),
-	(-0.515417878019463-0.8569389774178288j),
-	(-0.5167317990176497-0.8561473283751946j),
-	(-0.5180445040959992-0.855353664735196j),
-	(-0.5193559901655896-0.8545579883654005j),
-	(-0.5206662541403669-0.8537603011381115j),
-	(-0.5219752929371543-0.8529606049303637j),
-	(-0.5232831034756565-0.8521589016239197j),
-	(-0.5245896826784687-0.8513551931052652j),
-	(-0.5258950274710846-0.8505494812656035j),
-	(-0.5271991347819011-0.8497417680008527j),
-	(-0.5285020015422284-0.8489320552116397j),
-	(-0.5298036246862947-0.8481203448032972j),
-	(-0.5311040011512548-0.8473066386858585j),
-	(-0.5324031278771979-0.8464909387740521j),
-	(-0.533701001807153-0.8456732469872991j),
-	(-0.534997619887097-0.8448535652497072j),
-	(-0.5362929790659631-0.8440318954900664j),
-	(-0.5375870762956456-0.8432082396418454j),
-	(-0.5388799085310083-0.842382599643186j),
-	(-0.5401714727298929-0.8415549774368984j),
-	(-0.5414617658531232-0.8407253749704582j),
-	(-0.5427507848645158-0.8398937941959996j),
-	(-0.5440385267308839-0.8390602370703126j),
-	(-0.5453249884220462-0.8382247055548382j),
-	(-0.5466101669108349-0.8373872016156619j),
-	(-0.5478940591731002-0.836547727223512j),
-	(-0.5491766621877195-0.8357062843537527j),
-	(-0.5504579729366047-0.8348628749863801j),
-	(-0.5517379884047074-0.834017501106018j),
-	(-0.5530167055800274-0.8331701647019133j),
-	(-0.5542941214536201-0.8323208677679297j),
-	(-0.555570233019602-0.8314696123025455j),
-	(-0.55684503727516-0.8306164003088463j),
-	(-0.5581185312205561-0.829761233794523j),
-	(-0.5593907118591358-0.8289041147718651j),
-	(-0.5606615761973359-0.8280450452577558j),
-	(-0.5619311212446895-0.8271840272736691j),
-	(-0.563199344013834-0.8263210628456636j),
-	(-0.5644662415205194-0.8254561540043776j),
-	(-0.5657318107836132-0.8245893027850252j),
-	(-0.5669960488251085-0.8237205112273915j),
-	(-0.5682589526701315-0.8228497813758263j),
-	(-0.5695205193469473-0.8219771152792414j),
-	(-0.5707807458869671-0.8211025149911048j),
-	(-0.572039629324757-0.8202259825694347j),
-	(-0.573297166698042-0.8193475200767971j),
-	(-0.5745533550477158-0.8184671295802988j),
-	(-0.5758081914178453-0.8175848131515837j),
-	(-0.5770616728556793-0.816700572866828j),
-	(-0.5783137964116555-0.8158144108067338j),
-	(-0.5795645591394059-0.8149263290565265j),
-	(-0.5808139580957644-0.8140363297059485j),
-	(-0.5820619903407755-0.8131444148492536j),
-	(-0.5833086529376984-0.8122505865852039j),
-	(-0.5845539429530152-0.8113548470170638j),
-	(-0.5857978574564389-0.8104571982525948j),
-	(-0.5870403935209177-0.8095576424040515j),
-	(-0.5882815482226452-0.8086561815881751j),
-	(-0.5895213186410639-0.8077528179261904j),
-	(-0.590759701858874-0.8068475535437994j),
-	(-0.5919966949620409-0.8059403905711764j),
-	(-0.5932322950397999-0.8050313311429635j),
-	(-0.5944664991846643-0.8041203773982658j),
-	(-0.5956993044924334-0.8032075314806449j),
-	(-0.5969307080621966-0.8022927955381156j),
-	(-0.5981607069963422-0.8013761717231404j),
-	(-0.5993892984005645-0.8004576621926228j),
-	(-0.6006164793838688-0.7995372691079052j),
-	(-0.6018422470585799-0.7986149946347609j),
-	(-0.6030665985403483-0.797690840943391j),
-	(-0.6042895309481559-0.7967648102084189j),
-	(-0.6055110414043254-0.7958369046088836j),
-	(-0.6067311270345246-0.7949071263282369j),
-	(-0.6079497849677735-0.7939754775543373j),
-	(-0.6091670123364532-0.7930419604794436j),
-	(-0.6103828062763096-0.7921065773002123j),
-	(-0.6115971639264618-0.7911693302176903j),
-	(-0.6128100824294097-0.79023022143731j),
-	(-0.6140215589310382-0.7892892531688859j),
-	(-0.6152315905806267-0.7883464276266063j),
-	(-0.6164401745308536-0.7874017470290313j),
-	(-0.6176473079378038-0.7864552135990859j),
-	(-0.6188529879609762-0.785506829564054j),
-	(-0.6200572117632892-0.7845565971555751j),
-	(-0.6212599765110874-0.7836045186096383j),
-	(-0.62246127937415-0.7826505961665757j),
-	(-0.6236611175256946-0.7816948320710593j),
-	(-0.6248594881423862-0.7807372285720946j),
-	(-0.6260563884043435-0.7797777879230144j),
-	(-0.6272518154951439-0.7788165123814761j),
-	(-0.6284457666018326-0.7778534042094531j),
-	(-0.6296382389149271-0.7768884656732324j),
-	(-0.6308292296284244-0.7759216990434078j),
-	(-0.632018735939809-0.7749531065948739j),
-	(-0.6332067550500573-0.7739826906068228j),
-	(-0.6343932841636454-0.7730104533627371j),
-	(-0.6355783204885561-0.7720363971503845j),
-	(-0.6367618612362843-0.7710605242618137j),
-	(-0.6379439036218439-0.770082836993348j),
-	(-0.6391244448637757-0.7691033376455796j),
-	(-0.6403034821841515-0.7681220285233655j),
-	(-0.641481012808583-0.7671389119358205j),
-	(-0.6426570339662269-0.7661539901963129j),
-	(-0.6438315428897913-0.7651672656224591j),
-	(-0.6450045368155439-0.7641787405361168j),
-	(-0.6461760129833164-0.7631884172633813j),
-	(-0.647345968636512-0.762196298134579j),
-	(-0.6485144010221124-0.7612023854842619j),
-	(-0.6496813073906833-0.7602066816512023j),
-	(-0.6508466849963808-0.7592091889783882j),
-	(-0.6520105310969595-0.7582099098130153j),
-	(-0.6531728429537765-0.7572088465064847j),
-	(-0.6543336178318004-0.7562060014143945j),
-	(-0.6554928529996155-0.7552013768965365j),
-	(-0.6566505457294288-0.7541949753168893j),
-	(-0.6578066932970786-0.7531867990436125j),
-	(-0.6589612929820374-0.7521768504490427j),
-	(-0.6601143420674204-0.7511651319096866j),
-	(-0.6612658378399922-0.7501516458062151j),
-	(-0.6624157775901719-0.7491363945234593j),
-	(-0.6635641586120397-0.7481193804504037j),
-	(-0.6647109782033449-0.7471006059801801j),
-	(-0.6658562336655095-0.746080073510064j),
-	(-0.6669999223036374-0.7450577854414661j),
-	(-0.6681420414265186-0.7440337441799293j),
-	(-0.6692825883466359-0.7430079521351218j),
-	(-0.6704215603801731-0.7419804117208311j),
-	(-0.6715589548470184-0.740951125354959j),
-	(-0.6726947690707727-0.7399200954595163j),
-	(-0.673829000378756-0.7388873244606152j),
-	(-0.6749616461020121-0.7378528147884659j),
-	(-0.6760927035753158-0.73681656887737j),
-	(-0.6772221701371804-0.7357785891657135j),
-	(-0.6783500431298612-0.7347388780959636j),
-	(-0.679476319899365-0.7336974381146604j),
-	(-0.680600997795453-0.7326542716724128j),
-	(-0.6817240741716496-0.7316093812238927j),
-	(-0.682845546385248-0.7305627692278276j),
-	(-0.6839654117973155-0.729514438146997j),
-	(-0.6850836677727002-0.7284643904482253j),
-	(-0.6862003116800386-0.7274126286023758j),
-	(-0.6873153408917592-0.7263591550843459j),
-	(-0.6884287527840903-0.7253039723730609j),
-	(-0.6895405447370669-0.7242470829514669j),
-	(-0.6906507141345344-0.7231884893065276j),
-	(-0.6917592583641576-0.7221281939292155j),
-	(-0.6928661748174247-0.7210661993145081j),
-	(-0.6939714608896538-0.7200025079613818j),
-	(-0.6950751139800008-0.7189371223728045j),
-	(-0.696177131491463-0.7178700450557317j),
-	(-0.6972775108308864-0.7168012785210996j),
-	(-0.6983762494089728-0.7157308252838187j),
-	(-0.6994733446402839-0.714658687862769j),
-	(-0.7005687939432482-0.7135848687807937j),
-	(-0.7016625947401685-0.7125093705646923j),
-	(-0.7027547444572251-0.7114321957452167j),
-	(-0.7038452405244848-0.7103533468570624j),
-	(-0.7049340803759049-0.7092728264388656j),
-	(-0.7060212614493396-0.7081906370331955j),
-	(-0.7071067811865475-0.7071067811865476j),
-	(-0.7081906370331954-0.7060212614493397j),
-	(-0.7092728264388655-0.7049340803759051j),
-	(-0.7103533468570623-0.703845240524485j),
-	(-0.7114321957452165-0.7027547444572252j),
-	(-0.7125093705646922-0.7016625947401687j),
-	(-0.7135848687807936-0.7005687939432483j),
-	(-0.7146586878627689-0.699473344640284j),
-	(-0.7157308252838186-0.6983762494089729j),
-	(-0.7168012785210995-0.6972775108308865j),
-	(-0.7178700450557316-0.6961771314914631j),
-	(-0.7189371223728044-0.695075113980001j),
-	(-0.7200025079613817-0.693971460889654j),
-	(-0.721066199314508-0.6928661748174249j),
-	(-0.7221281939292152-0.6917592583641579j),
-	(-0.7231884893065275-0.6906507141345346j),
-	(-0.7242470829514668-0.689540544737067j),
-	(-0.7253039723730608-0.6884287527840904j),
-	(-0.7263591550843458-0.6873153408917593j),
-	(-0.7274126286023757-0.6862003116800387j),
-	(-0.7284643904482252-0.6850836677727004j),
-	(-0.7295144381469968-0.6839654117973156j),
-	(-0.7305627692278275-0.6828455463852482j),
-	(-0.7316093812238926-0.6817240741716497j),
-	(-0.7326542716724127-0.6806009977954532j),
-	(-0.7336974381146603-0.6794763198993651j),
-	(-0.7347388780959635-0.6783500431298614j),
-	(-0.7357785891657134-0.6772221701371806j),
-	(-0.7368165688773699-0.6760927035753159j),
-	(-0.7378528147884658-0.6749616461020123j),
-	(-0.738887324460615-0.6738290003787561j),
-	(-0.7399200954595162-0.6726947690707729j),
-	(-0.7409511253549589-0.6715589548470186j),
-	(-0.741980411720831-0.6704215603801732j),
-	(-0.7430079521351217-0.669282588346636j),
-	(-0.7440337441799291-0.6681420414265187j),
-	(-0.745057785441466-0.6669999223036376j),
-	(-0.7460800735100639-0.6658562336655096j),
-	(-0.74710060598018-0.664710978203345j),
-	(-0.7481193804504036-0.6635641586120398j),
-	(-0.7491363945234591-0.662415777590172j),
-	(-0.750151645806215-0.6612658378399924j),
-	(-0.7511651319096865-0.6601143420674205j),
-	(-0.7521768504490425-0.6589612929820375j),
-	(-0.7531867990436124-0.6578066932970787j),
-	(-0.7541949753168892-0.656650545729429j),
-	(-0.7552013768965364-0.6554928529996156j),
-	(-0.7562060014143944-0.6543336178318006j),
-	(-0.7572088465064846-0.6531728429537766j),
-	(-0.7582099098130152-0.6520105310969597j),
-	(-0.7592091889783881-0.650846684996381j),
-	(-0.7602066816512022-0.6496813073906834j),
-	(-0.7612023854842617-0.6485144010221126j),
-	(-0.7621962981345789-0.6473459686365121j),
-	(-0.763188417263381-0.6461760129833166j),
-	(-0.7641787405361167-0.645004536815544j),
-	(-0.765167265622459-0.6438315428897914j),
-	(-0.7661539901963127-0.6426570339662271j),
-	(-0.7671389119358203-0.6414810128085832j),
-	(-0.7681220285233654-0.6403034821841516j),
-	(-0.7691033376455795-0.6391244448637758j),
-	(-0.7700828369933479-0.637943903621844j),
-	(-0.7710605242618136-0.6367618612362844j),
-	(-0.7720363971503844-0.6355783204885562j),
-	(-0.773010453362737-0.6343932841636455j),
-	(-0.7739826906068227-0.6332067550500574j),
-	(-0.7749531065948738-0.6320187359398091j),
-	(-0.7759216990434077-0.6308292296284245j),
-	(-0.7768884656732323-0.6296382389149272j),
-	(-0.777853404209453-0.6284457666018327j),
-	(-0.778816512381476-0.6272518154951441j),
-	(-0.7797777879230143-0.6260563884043436j),
-	(-0.7807372285720945-0.6248594881423863j),
-	(-0.7816948320710592-0.6236611175256949j),
-	(-0.7826505961665756-0.6224612793741501j),
-	(-0.7836045186096382-0.6212599765110876j),
-	(-0.784556597155575-0.6200572117632894j),
-	(-0.7855068295640539-0.6188529879609764j),
-	(-0.7864552135990858-0.6176473079378039j),
-	(-0.7874017470290312-0.6164401745308538j),
-	(-0.7883464276266062-0.6152315905806269j),
-	(-0.7892892531688858-0.6140215589310384j),
-	(-0.7902302214373099-0.6128100824294098j),
-	(-0.7911693302176902-0.6115971639264619j),
-	(-0.7921065773002122-0.6103828062763097j),
-	(-0.7930419604794435-0.6091670123364533j),
-	(-0.7939754775543372-0.6079497849677736j),
-	(-0.7949071263282368-0.6067311270345247j),
-	(-0.7958369046088835-0.6055110414043257j),
-	(-0.7967648102084188-0.604289530948156j),
-	(-0.7976908409433909-0.6030665985403484j),
-	(-0.7986149946347608-0.6018422470585801j),
-	(-0.7995372691079051-0.6006164793838689j),
-	(-0.8004576621926227-0.5993892984005647j),
-	(-0.8013761717231402-0.5981607069963424j),
-	(-0.8022927955381155-0.5969307080621967j),
-	(-0.8032075314806448-0.5956993044924335j),
-	(-0.8041203773982657-0.5944664991846644j),
-	(-0.8050313311429634-0.5932322950398j),
-	(-0.8059403905711763-0.591996694962041j),
-	(-0.8068475535437993-0.5907597018588742j),
-	(-0.8077528179261902-0.589521318641064j),
-	(-0.808656181588175-0.5882815482226453j),
-	(-0.8095576424040514-0.587040393520918j),
-	(-0.8104571982525947-0.585797857456439j),
-	(-0.8113548470170637-0.5845539429530153j),
-	(-0.8122505865852038-0.5833086529376985j),
-	(-0.8131444148492535-0.5820619903407757j),
-	(-0.8140363297059484-0.5808139580957645j),
-	(-0.8149263290565264-0.579564559139406j),
-	(-0.8158144108067337-0.5783137964116557j),
-	(-0.8167005728668278-0.5770616728556794j),
-	(-0.8175848131515836-0.5758081914178454j),
-	(-0.8184671295802987-0.5745533550477159j),
-	(-0.819347520076797-0.5732971666980421j),
-	(-0.8202259825694346-0.5720396293247573j),
-	(-0.8211025149911046-0.5707807458869673j),
-	(-0.8219771152792413-0.5695205193469475j),
-	(-0.8228497813758262-0.5682589526701317j),
-	(-0.8237205112273914-0.5669960488251087j),
-	(-0.8245893027850251-0.5657318107836135j),
-	(-0.8254561540043774-0.5644662415205195j),
-	(-0.8263210628456635-0.5631993440138341j),
-	(-0.827184027273669-0.5619311212446896j),
-	(-0.8280450452577557-0.5606615761973361j),
-	(-0.828904114771865-0.559390711859136j),
-	(-0.8297612337945229-0.5581185312205563j),
-	(-0.8306164003088463-0.5568450372751601j),
-	(-0.8314696123025453-0.5555702330196022j),
-	(-0.8323208677679296-0.5542941214536202j),
-	(-0.8331701647019132-0.5530167055800276j),
-	(-0.834017501106018-0.5517379884047077j),
-	(-0.83486287498638-0.5504579729366049j),
-	(-0.8357062843537526-0.5491766621877197j),
-	(-0.8365477272235119-0.5478940591731004j),
-	(-0.8373872016156618-0.546610166910835j),
-	(-0.8382247055548381-0.5453249884220464j),
-	(-0.8390602370703126-0.544038526730884j),
-	(-0.8398937941959995-0.5427507848645159j),
-	(-0.8407253749704581-0.5414617658531233j),
-	(-0.8415549774368983-0.540171472729893j),
-	(-0.8423825996431858-0.5388799085310084j),
-	(-0.8432082396418453-0.5375870762956457j),
-	(-0.8440318954900664-0.5362929790659633j),
-	(-0.8448535652497071-0.5349976198870972j),
-	(-0.845673246987299-0.5337010018071532j),
-	(-0.846490938774052-0.532403127877198j),
-	(-0.8473066386858584-0.5311040011512549j),
-	(-0.8481203448032971-0.5298036246862948j),
-	(-0.8489320552116396-0.5285020015422285j),
-	(-0.8497417680008525-0.5271991347819013j),
-	(-0.8505494812656034-0.5258950274710849j),
-	(-0.8513551931052652-0.524589682678469j),
-	(-0.8521589016239196-0.5232831034756567j),
-	(-0.8529606049303636-0.5219752929371545j),
-	(-0.8537603011381114-0.5206662541403672j),
-	(-0.8545579883654004-0.5193559901655898j),
-	(-0.8553536647351959-0.5180445040959994j),
-	(-0.8561473283751945-0.5167317990176498j),
-	(-0.8569389774178287-0.5154178780194631j),
-	(-0.857728610000272-0.5141027441932218j),
-	(-0.8585162242644429-0.512786400633563j),
-	(-0.8593018183570084-0.5114688504379705j),
-	(-0.8600853904293901-0.5101500967067668j),
-	(-0.8608669386377671-0.5088301425431073j),
-	(-0.8616464611430813-0.507508991052971j),
-	(-0.8624239561110405-0.5061866453451552j),
-	(-0.863199421712124-0.5048631085312677j),
-	(-0.8639728561215867-0.5035383837257177j),
-	(-0.8647442575194624-0.5022124740457107j),
-	(-0.865513624090569-0.5008853826112409j),
-	(-0.866280954024513-0.49955711254508195j),
-	(-0.8670462455156928-0.49822766697278176j),
-	(-0.8678094967633032-0.4968970490226547j),
-	(-0.8685707059713409-0.49556526182577254j),
-	(-0.8693298713486066-0.49423230851596j),
-	(-0.8700869911087113-0.49289819222978415j),
-	(-0.870842063470079-0.4915629161065499j),
-	(-0.8715950866559509-0.4902264832882914j),
-	(-0.8723460588943914-0.4888888969197633j),
-	(-0.8730949784182901-0.4875501601484359j),
-	(-0.8738418434653668-0.4862102761244866j),
-	(-0.8745866522781761-0.4848692480007911j),
-	(-0.8753294031041109-0.48352707893291863j),
-	(-0.8760700941954065-0.4821837720791229j),
-	(-0.8768087238091457-0.48083933060033396j),
-	(-0.8775452902072611-0.4794937576601533j),
-	(-0.8782797916565415-0.4781470564248432j),
-	(-0.8790122264286335-0.4767992300633221j),
-	(-0.8797425928000473-0.4754502817471561j),
-	(-0.8804708890521608-0.4741002146505501j),
-	(-0.8811971134712221-0.47274903195034274j),
-	(-0.8819212643483549-0.47139673682599786j),
-	(-0.8826433399795628-0.4700433324595957j),
-	(-0.8833633386657317-0.46868882203582785j),
-	(-0.8840812587126349-0.4673332087419886j),
-	(-0.8847970984309378-0.4659764957679662j),
-	(-0.8855108561361998-0.4646186863062381j),
-	(-0.8862225301488805-0.4632597835518603j),
-	(-0.8869321187943422-0.46189979070246273j),
-	(-0.8876396204028538-0.4605387109582402j),
-	(-0.8883450333095962-0.4591765475219442j),
-	(-0.8890483558546646-0.4578133035988772j),
-	(-0.8897495863830727-0.45644898239688414j),
-	(-0.8904487232447579-0.4550835871263439j),
-	(-0.8911457647945833-0.45371712100016376j),
-	(-0.8918407093923426-0.45234958723377106j),
-	(-0.8925335554027646-0.45098098904510386j),
-	(-0.8932243011955152-0.4496113296546069j),
-	(-0.8939129451452031-0.44824061228522005j),
-	(-0.8945994856313827-0.44686884016237416j),
-	(-0.8952839210385574-0.44549601651398196j),
-	(-0.8959662497561851-0.4441221445704293j),
-	(-0.8966464701786803-0.44274722756456997j),
-	(-0.8973245807054182-0.4413712687317169j),
-	(-0.8980005797407398-0.4399942713096333j),
-	(-0.8986744656939539-0.43861623853852755j),
-	(-0.8993462369793415-0.43723717366104425j),
-	(-0.9000158920161602-0.43585707992225553j),
-	(-0.9006834292286467-0.434475960569656j),
-	(-0.9013488470460219-0.43309381885315207j),
-	(-0.9020121439024932-0.43171065802505726j),
-	(-0.9026733182372587-0.4303264813400829j),
-	(-0.9033323684945118-0.4289412920553296j),
-	(-0.9039892931234433-0.42755509343028203j),
-	(-0.9046440905782461-0.42616788872679984j),
-	(-0.9052967593181187-0.42477968120910886j),
-	(-0.9059472978072685-0.42339047414379594j),
-	(-0.9065957045149153-0.42200027079979985j),
-	(-0.9072419779152958-0.42060907444840256j),
-	(-0.907886116487666-0.41921688836322424j),
-	(-0.9085281187163061-0.41782371582021244j),
-	(-0.9091679830905224-0.41642956009763715j),
-	(-0.9098057081046521-0.41503442447608185j),
-	(-0.9104412922580671-0.4136383122384346j),
-	(-0.9110747340551764-0.41224122666988283j),
-	(-0.9117060320054298-0.41084317105790413j),
-	(-0.9123351846233227-0.40944414869225765j),
-	(-0.9129621904283982-0.4080441628649786j),
-	(-0.9135870479452508-0.4066432168703692j),
-	(-0.9142097557035307-0.4052413140049899j),
-	(-0.914830312237946-0.4038384575676544j),
-	(-0.9154487160882677-0.4024346508594186j),
-	(-0.9160649657993317-0.4010298971835756j),
-	(-0.9166790599210426-0.39962419984564707j),
-	(-0.9172909970083779-0.39821756215337367j),
-	(-0.9179007756213905-0.39680998741671025j),
-	(-0.9185083943252121-0.3954014789478165j),
-	(-0.9191138516900578-0.39399204006104815j),
-	(-0.9197171462912274-0.3925816740729514j),
-	(-0.9203182767091105-0.39117038430225404j),
-	(-0.9209172415291894-0.38975817406985647j),
-	(-0.9215140393420418-0.3883450466988266j),
-	(-0.9221086687433451-0.38693100551438875j),
-	(-0.9227011283338786-0.38551605384391885j),
-	(-0.9232914167195275-0.3841001950169353j),
-	(-0.9238795325112867-0.3826834323650899j),
-	(-0.9244654743252626-0.3812657692221623j),
-	(-0.9250492407826775-0.3798472089240514j),
-	(-0.9256308305098727-0.37842775480876567j),
-	(-0.9262102421383114-0.37700741021641815j),
-	(-0.9267874743045817-0.3755861784892174j),
-	(-0.9273625256504011-0.37416406297145804j),
-	(-0.9279353948226178-0.3727410670095161j),
-	(-0.9285060804732155-0.3713171939518377j),
-	(-0.9290745812593157-0.3698924471489341j),
-	(-0.9296408958431812-0.3684668299533726j),
-	(-0.9302050228922191-0.3670403457197673j),
-	(-0.9307669610789837-0.3656129978047738j),
-	(-0.9313267090811803-0.3641847895670801j),
-	(-0.931884265581668-0.3627557243673973j),
-	(-0.9324396292684625-0.3613258055684542j),
-	(-0.9329927988347388-0.35989503653498833j),
-	(-0.9335437729788362-0.3584634206337366j),
-	(-0.9340925504042588-0.3570309612334303j),
-	(-0.9346391298196807-0.355597661704784j),
-	(-0.9351835099389476-0.3541635254204904j),
-	(-0.9357256894810803-0.35272855575521095j),
-	(-0.9362656671702783-0.3512927560855672j),
-	(-0.9368034417359217-0.34985612979013486j),
-	(-0.9373390119125748-0.3484186802494348j),
-	(-0.9378723764399898-0.34698041084592374j),
-	(-0.9384035340631082-0.345541324963989j),
-	(-0.9389324835320645-0.34410142598993904j),
-	(-0.9394592236021899-0.34266071731199443j),
-	(-0.9399837530340138-0.3412192023202827j),
-	(-0.9405060705932683-0.339776884406827j),
-	(-0.9410261750508893-0.3383337669655412j),
-	(-0.9415440651830207-0.33688985339222033j),
-	(-0.9420597397710173-0.3354451470845317j),
-	(-0.9425731976014469-0.3339996514420094j),
-	(-0.9430844374660934-0.33255336986604445j),
-	(-0.9435934581619604-0.3311063057598765j),
-	(-0.9441002584912727-0.32965846252858744j),
-	(-0.9446048372614801-0.3282098435790927j),
-	(-0.9451071932852606-0.32676045232013184j),
-	(-0.9456073253805212-0.32531029216226326j),
-	(-0.9461052323704033-0.323859366517853j),
-	(-0.9466009130832835-0.32240767880106985j),
-	(-0.9470943663527771-0.3209552324278755j),
-	(-0.9475855910177411-0.3195020308160158j),
-	(-0.9480745859222762-0.3180480773850149j),
-	(-0.9485613499157303-0.31659337555616607j),
-	(-0.9490458818527006-0.3151379287525225j),
-	(-0.9495281805930367-0.3136817403988914j),
-	(-0.950008245001843-0.3122248139218251j),
-	(-0.9504860739494817-0.31076715274961153j),
-	(-0.950961666311575-0.309308760312269j),
-	(-0.9514350209690083-0.30784964004153503j),
-	(-0.9519061368079323-0.3063897953708609j),
-	(-0.9523750127197658-0.30492922973540265j),
-	(-0.9528416476011986-0.3034679465720114j),
-	(-0.9533060403541939-0.30200594931922803j),
-	(-0.9537681898859902-0.3005432414172737j),
-	(-0.9542280951091056-0.29907982630804053j),
-	(-0.9546857549413383-0.29761570743508614j),
-	(-0.9551411683057707-0.296150888243624j),
-	(-0.9555943341307711-0.2946853721805144j),
-	(-0.9560452513499963-0.29321916269425896j),
-	(-0.956493918902395-0.29175226323498943j),
-	(-0.9569403357322088-0.2902846772544624j),
-	(-0.9573845007889759-0.28881640820604976j),
-	(-0.9578264130275329-0.2873474595447296j),
-	(-0.9582660714080177-0.28587783472708056j),
-	(-0.9587034748958715-0.2844075372112721j),
-	(-0.9591386224618419-0.28293657045705545j),
-	(-0.9595715130819845-0.2814649379257579j),
-	(-0.9600021457376658-0.27999264308027344j),
-	(-0.9604305194155658-0.27851968938505317j),
-	(-0.9608566331076795-0.27704608030610023j),
-	(-0.9612804858113206-0.2755718193109583j),
-	(-0.9617020765291225-0.2740969098687064j),
-	(-0.9621214042690415-0.27262135544994925j),
-	(-0.9625384680443592-0.2711451595268081j),
-	(-0.9629532668736839-0.2696683255729151j),
-	(-0.9633657997809539-0.2681908570634034j),
-	(-0.9637760657954398-0.2667127574748985j),
-	(-0.9641840639517458-0.26523403028551173j),
-	(-0.9645897932898126-0.26375467897483157j),
-	(-0.9649932528549203-0.2622747070239137j),
-	(-0.9653944416976893-0.26079411791527585j),
-	(-0.9657933588740836-0.2593129151328864j),
-	(-0.9661900034454125-0.257831102162159j),
-	(-0.966584374478333-0.2563486824899432j),
-	(-0.9669764710448521-0.2548656596045147j),
-	(-0.9673662922223285-0.2533820369955701j),
-	(-0.9677538370934754-0.2518978181542172j),
-	(-0.9681391047463623-0.25041300657296534j),
-	(-0.9685220942744174-0.2489276057457201j),
-	(-0.9689028047764289-0.2474416191677735j),
-	(-0.9692812353565484-0.24595505033579465j),
-	(-0.9696573851242923-0.24446790274782448j),
-	(-0.970031253194544-0.24298017990326407j),
-	(-0.9704028386875555-0.24149188530286936j),
-	(-0.9707721407289502-0.24000302244874178j),
-	(-0.9711391584497251-0.23851359484431855j),
-	(-0.9715038909862518-0.23702360599436717j),
-	(-0.9718663374802793-0.23553305940497574j),
-	(-0.9722264970789363-0.2340419585835435j),
-	(-0.9725843689347322-0.23255030703877516j),
-	(-0.9729399522055601-0.23105810828067133j),
-	(-0.9732932460546982-0.22956536582051892j),
-	(-0.9736442496508119-0.22807208317088606j),
-	(-0.9739929621679558-0.22657826384561017j),
-	(-0.9743393827855759-0.22508391135979283j),
-	(-0.9746835106885107-0.2235890292297903j),
-	(-0.9750253450669941-0.22209362097320365j),
-	(-0.975364885116657-0.2205976901088735j),
-	(-0.9757021300385285-0.21910124015687005j),
-	(-0.976037079039039-0.21760427463848372j),
-	(-0.9763697313300211-0.21610679707621944j),
-	(-0.9767000861287117-0.21460881099378698j),
-	(-0.9770281426577544-0.21311031991609142j),
-	(-0.9773539001452-0.2116113273692279j),
-	(-0.9776773578245099-0.2101118368804698j),
-	(-0.9779985149345571-0.2086118519782635j),
-	(-0.9783173707196275-0.20711137619221884j),
-	(-0.9786339244294231-0.20561041305309938j),
-	(-0.9789481753190622-0.20410896609281684j),
-	(-0.979260122649082-0.20260703884442138j),
-	(-0.9795697656854405-0.201104634842092j),
-	(-0.9798771036995176-0.19960175762113092j),
-	(-0.9801821359681173-0.1980984107179538j),
-	(-0.9804848617734694-0.19659459767008028j),
-	(-0.9807852804032304-0.1950903220161286j),
-	(-0.9810833911504866-0.1935855872958038j),
-	(-0.9813791933137546-0.19208039704989247j),
-	(-0.9816726861969831-0.19057475482025307j),
-	(-0.9819638691095552-0.18906866414980636j),
-	(-0.9822527413662894-0.18756212858252957j),
-	(-0.9825393022874412-0.1860551516634469j),
-	(-0.9828235511987052-0.1845477369386197j),
-	(-0.9831054874312163-0.1830398879551409j),
-	(-0.9833851103215512-0.18153160826112522j),
-	(-0.9836624192117303-0.18002290140569957j),
-	(-0.9839374134492189-0.17851377093899742j),
-	(-0.984210092386929-0.17700422041214894j),
-	(-0.9844804553832209-0.17549425337727145j),
-	(-0.9847485018019042-0.17398387338746413j),
-	(-0.9850142310122398-0.17247308399679612j),
-	(-0.9852776423889412-0.17096188876030122j),
-	(-0.9855387353121761-0.1694502912339682j),
-	(-0.9857975091675674-0.16793829497473128j),
-	(-0.9860539633461954-0.16642590354046405j),
-	(-0.9863080972445986-0.16491312048997014j),
-	(-0.9865599102647754-0.16339994938297328j),
-	(-0.9868094018141855-0.16188639378011174j),
-	(-0.987056571305751-0.16037245724292845j),
-	(-0.9873014181578584-0.15885814333386147j),
-	(-0.9875439417943592-0.15734345561623855j),
-	(-0.9877841416445722-0.15582839765426537j),
-	(-0.9880220171432835-0.15431297301302008j),
-	(-0.9882575677307495-0.15279718525844369j),
-	(-0.9884907928526966-0.1512810379573303j),
-	(-0.9887216919603238-0.14976453467732145j),
-	(-0.988950264510303-0.14824767898689625j),
-	(-0.989176509964781-0.1467304744553618j),
-	(-0.9894004277913804-0.14521292465284735j),
-	(-0.9896220174632008-0.14369503315029464j),
-	(-0.9898412784588205-0.1421768035194481j),
-	(-0.990058210262297-0.14065823933284954j),
-	(-0.9902728123631691-0.13913934416382634j),
-	(-0.9904850842564571-0.13762012158648604j),
-	(-0.9906950254426646-0.13610057517570648j),
-	(-0.99090263542778-0.13458070850712628j),
-	(-0.9911079137232769-0.133060525157139j),
-	(-0.9913108598461154-0.13154002870288334j),
-	(-0.9915114733187439-0.13001922272223343j),
-	(-0.9917097536690995-0.12849811079379309j),
-	(-0.9919057004306093-0.12697669649688606j),
-	(-0.9920993131421918-0.12545498341154626j),
-	(-0.9922905913482573-0.12393297511851248j),
-	(-0.99247953459871-0.12241067519921635j),
-	(-0.992666142448948-0.12088808723577706j),
-	(-0.9928504144598651-0.11936521481099163j),
-	(-0.9930323501978514-0.11784206150832509j),
-	(-0.9932119492347945-0.11631863091190471j),
-	(-0.9933892111480807-0.1147949266065103j),
-	(-0.9935641355205953-0.11327095217756442j),
-	(-0.9937367219407246-0.1117467112111265j),
-	(-0.9939069700023561-0.11022220729388324j),
-	(-0.9940748793048794-0.10869744401313874j),
-	(-0.9942404494531879-0.10717242495680916j),
-	(-0.9944036800576791-0.10564715371341075j),
-	(-0.9945645707342554-0.10412163387205457j),
-	(-0.9947231211043257-0.10259586902243656j),
-	(-0.9948793307948056-0.10106986275482793j),
-	(-0.9950331994381186-0.09954361866006928j),
-	(-0.9951847266721968-0.09801714032956083j),
-	(-0.9953339121404823-0.09649043135525266j),
-	(-0.9954807554919269-0.09496349532963891j),
-	(-0.9956252563809943-0.09343633584574797j),
-	(-0.9957674144676598-0.09190895649713275j),
-	(-0.9959072294174117-0.09038136087786529j),
-	(-0.996044700901252-0.08885355258252475j),
-	(-0.996179828595697-0.08732553520619206j),
-	(-0.996312612182778-0.08579731234444016j),
-	(-0.9964430513500426-0.08426888759332418j),
-	(-0.9965711457905548-0.08274026454937564j),
-	(-0.9966968952028961-0.08121144680959266j),
-	(-0.9968202992911657-0.0796824379714302j),
-	(-0.9969413577649822-0.07815324163279415j),
-	(-0.997060070339483-0.07662386139203169j),
-	(-0.9971764367353261-0.07509430084792135j),
-	(-0.9972904566786902-0.07356456359966773j),
-	(-0.9974021299012753-0.07203465324688947j),
-	(-0.9975114561403035-0.07050457338961386j),
-	(-0.9976184351385196-0.06897432762826702j),
-	(-0.9977230666441916-0.06744391956366418j),
-	(-0.9978253504111116-0.06591335279700376j),
-	(-0.997925286198596-0.0643826309298577j),
-	(-0.9980228737714862-0.06285175756416149j),
-	(-0.9981181129001492-0.06132073630220849j),
-	(-0.9982110033604782-0.05978957074664007j),
-	(-0.9983015449338929-0.058258264500435794j),
-	(-0.9983897374073402-0.05672682116690807j),
-	(-0.9984755805732948-0.055195244349690094j),
-	(-0.9985590742297593-0.05366353765273052j),
-	(-0.9986402181802652-0.052131704680283594j),
-	(-0.9987190122338729-0.05059974903689939j),
-	(-0.9987954562051724-0.049067674327417966j),
-	(-0.9988695499142836-0.04753548415695954j),
-	(-0.9989412931868569-0.046003182130914706j),
-	(-0.9990106858540734-0.044470771854938584j),
-	(-0.9990777277526454-0.04293825693494102j),
-	(-0.9991424187248169-0.041405640977076774j),
-	(-0.9992047586183639-0.03987292758774013j),
-	(-0.9992647472865944-0.038340120373552854j),
-	(-0.9993223845883495-0.03680722294135883j),
-	(-0.9993776703880028-0.03527423889821423j),
-	(-0.9994306045554617-0.033741171851377705j),
-	(-0.999481186966167-0.032208025408304544j),
-	(-0.9995294175010931-0.030674803176636865j),
-	(-0.9995752960467492-0.029141508764193802j),
-	(-0.9996188224951786-0.02760814577896566j),
-	(-0.9996599967439592-0.0260747178291041j),
-	(-0.9996988186962042-0.024541228522912326j),
-	(-0.9997352882605617-0.023007681468839695j),
-	(-0.9997694053512153-0.021474080275469667j),
-	(-0.9998011698878843-0.019940428551514438j),
-	(-0.9998305817958234-0.0184067299058051j),
-	(-0.9998576410058239-0.016872987947281835j),
-	(-0.9998823474542126-0.01533920628498806j),
-	(-0.9999047010828528-0.013805388528060632j),
-	(-0.9999247018391445-0.012271538285720007j),
-	(-0.9999423496760239-0.01073765916726441j),
-	(-0.9999576445519639-0.00920375478206002j),
-	(-0.9999705864309741-0.007669828739531138j),
-	(-0.9999811752826011-0.006135884649154799j),
-	(-0.9999894110819284-0.004601926120448733j),
-	(-0.9999952938095762-0.003067956762965977j),
-	(-0.9999988234517019-0.0015339801862850493j),
-};
+#define TWIDDLE_MAX_SAMPLES ((size_t)8192U)
 
-const double complex* const W²[12] =
+/* W_sin[m] = sin(2πm/TWIDDLE_MAX_SAMPLES) for 0 <= m <= TWIDDLE_MAX_SAMPLES/4 */
+const double W_sin[2049] =
 {
-	W₂²,
-	W₄²,
-	W₈²,
-	W₁₆²,
-	W₃₂²,
-	W₆₄²,
-	W₁₂₈²,
-	W₂₅₆²,
-	W₅₁₂²,
-	W₁₀₂₄²,
-	W₂₀₄₈²,
-	W₄₀₉₆²,
+	0.0,
+	0.0007669903187427045,
+	0.0015339801862847655,
+	0.002300969151425805,
+	0.003067956762965976,
+	0.0038349425697062275,
+	0.0046019261204485705,
+	0.0053689069639963425,
+	0.006135884649154475,
+	0.006902858724729756,
+	0.007669828739531097,
+	0.008436794242369799,
+	0.00920375478205982,
+	0.00997070990741803,
+	0.01073765916726449,
+	0.011504602110422714,
+	0.012271538285719925,
+	0.013038467241987334,
+	0.01380538852806039,
+	0.014572301692779064,
+	0.0153392062849881,
+	0.016106101853537287,
+	0.01687298794728171,
+	0.017639864115082053,
+	0.01840672990580482,
+	0.019173584868322623,
+	0.01994042855151444,
+	0.020707260504265895,
+	0.021474080275469508,
+	0.02224088741402496,
+	0.02300768146883937,
+	0.023774461988827555,
+	0.024541228522912288,
+	0.02530798062002457,
+	0.0260747178291039,
+	0.02684143969909853,
+	0.02760814577896574,
+	0.0283748356176721,
+	0.029141508764193722,
+	0.029908164767516555,
+	0.030674803176636626,
+	0.0314414235405603,
+	0.032208025408304586,
+	0.032974608328897335,
+	0.03374117185137758,
+	0.03450771552479575,
+	0.03527423889821395,
+	0.03604074152070623,
+	0.03680722294135883,
+	0.037573682709270494,
+	0.038340120373552694,
+	0.03910653548332989,
+	0.03987292758773981,
+	0.040639296235933736,
+	0.04140564097707674,
+	0.04217196136034795,
+	0.04293825693494082,
+	0.04370452725006342,
+	0.04447077185493867,
+	0.04523699029880459,
+	0.04600318213091462,
+	0.04676934690053786,
+	0.0475354841569593,
+	0.048301593449480144,
+	0.049067674327418015,
+	0.04983372634010728,
+	0.05059974903689928,
+	0.05136574196716259,
+	0.052131704680283324,
+	0.052897636725665324,
+	0.05366353765273052,
+	0.05442940701091913,
+	0.055195244349689934,
+	0.05596104921852057,
+	0.05672682116690775,
+	0.057492559744367566,
+	0.05825826450043575,
+	0.05902393498466793,
+	0.05978957074663987,
+	0.06055517133594779,
+	0.06132073630220858,
+	0.06208626519506009,
+	0.0628517575641614,
+	0.0636172129591931,
+	0.06438263092985747,
+	0.06514801102587883,
+	0.0659133527970038,
+	0.06667865579300156,
+	0.06744391956366405,
+	0.06820914365880633,
+	0.06897432762826675,
+	0.0697394710219073,
+	0.07050457338961386,
+	0.0712696342812964,
+	0.07203465324688933,
+	0.07279962983635167,
+	0.07356456359966743,
+	0.07432945408684576,
+	0.0750943008479213,
+	0.07585910343295445,
+	0.07662386139203149,
+	0.07738857427526505,
+	0.07815324163279423,
+	0.07891786301478494,
+	0.07968243797143013,
+	0.08044696605295001,
+	0.08121144680959244,
+	0.08197587979163307,
+	0.08274026454937569,
+	0.08350460063315243,
+	0.08426888759332407,
+	0.08503312498028028,
+	0.0857973123444399,
+	0.08656144923625117,
+	0.08732553520619206,
+	0.0880895698047705,
+	0.0888535525825246,
+	0.08961748309002296,
+	0.09038136087786498,
+	0.091145185496681,
+	0.09190895649713272,
+	0.09267267342991331,
+	0.09343633584574779,
+	0.0941999432953932,
+	0.09496349532963899,
+	0.09572699149930716,
+	0.09649043135525259,
+	0.09725381444836327,
+	0.0980171403295606,
+	0.09878040854979962,
+	0.09954361866006932,
+	0.10030677021139286,
+	0.10106986275482782,
+	0.10183289584146653,
+	0.10259586902243628,
+	0.10335878184889961,
+	0.10412163387205459,
+	0.10488442464313497,
+	0.10564715371341062,
+	0.10640982063418768,
+	0.10717242495680884,
+	0.10793496623265365,
+	0.10869744401313872,
+	0.10945985784971798,
+	0.11022220729388306,
+	0.11098449189716339,
+	0.11174671121112659,
+	0.11250886478737869,
+	0.11327095217756435,
+	0.1140329729333672,
+	0.11479492660651008,
+	0.11555681274875526,
+	0.11631863091190475,
+	0.11708038064780059,
+	0.11784206150832498,
+	0.11860367304540072,
+	0.11936521481099135,
+	0.1201266863571015,
+	0.12088808723577708,
+	0.12164941699910553,
+	0.1224106751992162,
+	0.12317186138828048,
+	0.12393297511851216,
+	0.12469401594216764,
+	0.12545498341154623,
+	0.12621587707899035,
+	0.12697669649688587,
+	0.1277374412176623,
+	0.12849811079379317,
+	0.12925870477779614,
+	0.13001922272223335,
+	0.1307796641797117,
+	0.13154002870288312,
+	0.13230031584444465,
+	0.13306052515713906,
+	0.13382065619375472,
+	0.13458070850712617,
+	0.13534068165013421,
+	0.1361005751757062,
+	0.13686038863681638,
+	0.13762012158648604,
+	0.1383797735777839,
+	0.1391393441638262,
+	0.13989883289777721,
+	0.1406582393328492,
+	0.14141756302230302,
+	0.14217680351944803,
+	0.14293596037764267,
+	0.14369503315029447,
+	0.14445402139086047,
+	0.14521292465284746,
+	0.1459717424898122,
+	0.14673047445536175,
+	0.14748912010315357,
+	0.14824767898689603,
+	0.14900615066034845,
+	0.1497645346773215,
+	0.1505228305916774,
+	0.15128103795733022,
+	0.15203915632824605,
+	0.15279718525844344,
+	0.15355512430199345,
+	0.1543129730130201,
+	0.1550707309457005,
+	0.15582839765426523,
+	0.15658597269299843,
+	0.15734345561623825,
+	0.15810084597837698,
+	0.15885814333386145,
+	0.15961534723719306,
+	0.16037245724292828,
+	0.1611294729056788,
+	0.16188639378011183,
+	0.1626432194209503,
+	0.16339994938297323,
+	0.1641565832210158,
+	0.16491312048996992,
+	0.16566956074478412,
+	0.1664259035404641,
+	0.16718214843207294,
+	0.16793829497473117,
+	0.16869434272361733,
+	0.16945029123396796,
+	0.17020614006107807,
+	0.17096188876030122,
+	0.17171753688704997,
+	0.17247308399679595,
+	0.17322852964507032,
+	0.17398387338746382,
+	0.1747391147796272,
+	0.17549425337727143,
+	0.1762492887361679,
+	0.17700422041214875,
+	0.17775904796110717,
+	0.1785137709389975,
+	0.17926838890183575,
+	0.18002290140569951,
+	0.1807773080067286,
+	0.18153160826112497,
+	0.1822858017251533,
+	0.18303988795514095,
+	0.18379386650747845,
+	0.18454773693861962,
+	0.1853014988050819,
+	0.18605515166344663,
+	0.18680869507035927,
+	0.1875621285825296,
+	0.18831545175673212,
+	0.1890686641498062,
+	0.1898217653186564,
+	0.19057475482025274,
+	0.1913276322116309,
+	0.19208039704989244,
+	0.19283304889220523,
+	0.1935855872958036,
+	0.1943380118179886,
+	0.19509032201612825,
+	0.19584251744765785,
+	0.19659459767008022,
+	0.19734656224096592,
+	0.19809841071795356,
+	0.1988501426587501,
+	0.19960175762113097,
+	0.20035325516294045,
+	0.2011046348420919,
+	0.20185589621656805,
+	0.20260703884442113,
+	0.20335806228377332,
+	0.20410896609281687,
+	0.20485974982981442,
+	0.20561041305309924,
+	0.2063609553210755,
+	0.20711137619221856,
+	0.20786167522507507,
+	0.20861185197826349,
+	0.20936190601047416,
+	0.2101118368804696,
+	0.21086164414708486,
+	0.21161132736922755,
+	0.21236088610587842,
+	0.21311031991609136,
+	0.21385962835899375,
+	0.21460881099378676,
+	0.21535786737974555,
+	0.21610679707621952,
+	0.21685559964263262,
+	0.21760427463848364,
+	0.21835282162334632,
+	0.2191012401568698,
+	0.2198495297987787,
+	0.2205976901088735,
+	0.2213457206470308,
+	0.2220936209732035,
+	0.22284139064742112,
+	0.22358902922979,
+	0.2243365362804936,
+	0.22508391135979283,
+	0.22583115402802617,
+	0.22657826384561,
+	0.22732524037303886,
+	0.22807208317088573,
+	0.22881879179980222,
+	0.22956536582051887,
+	0.23031180479384544,
+	0.2310581082806711,
+	0.23180427584196478,
+	0.23255030703877524,
+	0.2332962014322316,
+	0.23404195858354343,
+	0.23478757805400097,
+	0.2355330594049755,
+	0.23627840219791957,
+	0.2370236059943672,
+	0.2377686703559342,
+	0.23851359484431842,
+	0.23925837902129998,
+	0.2400030224487415,
+	0.24074752468858843,
+	0.24149188530286933,
+	0.242236103853696,
+	0.24298017990326387,
+	0.24372411301385216,
+	0.24446790274782415,
+	0.24521154866762754,
+	0.2459550503357946,
+	0.24669840731494241,
+	0.24744161916777327,
+	0.24818468545707478,
+	0.24892760574572015,
+	0.24967037959666855,
+	0.2504130065729652,
+	0.2511554862377419,
+	0.25189781815421697,
+	0.2526400018856955,
+	0.25338203699557016,
+	0.2541239230473206,
+	0.25486565960451457,
+	0.2556072462308074,
+	0.2563486824899429,
+	0.2570899679457531,
+	0.257831102162159,
+	0.25857208470317034,
+	0.25931291513288623,
+	0.2600535930154952,
+	0.2607941179152755,
+	0.2615344893965955,
+	0.2622747070239136,
+	0.263014770361779,
+	0.26375467897483135,
+	0.26449443242780163,
+	0.2652340302855118,
+	0.2659734721128756,
+	0.26671275747489837,
+	0.2674518859366776,
+	0.2681908570634032,
+	0.26892967042035726,
+	0.2696683255729151,
+	0.2704068220865448,
+	0.271145159526808,
+	0.2718833374593597,
+	0.272621355449949,
+	0.2733592130644187,
+	0.2740969098687064,
+	0.27483444542884394,
+	0.27557181931095814,
+	0.2763090310812711,
+	0.2770460803060999,
+	0.2777829665518577,
+	0.27851968938505306,
+	0.2792562483722912,
+	0.2799926430802732,
+	0.2807288730757972,
+	0.28146493792575794,
+	0.28220083719714756,
+	0.2829365704570554,
+	0.28367213727266843,
+	0.2844075372112719,
+	0.28514276984024867,
+	0.2858778347270806,
+	0.2866127314393478,
+	0.2873474595447295,
+	0.28808201861100413,
+	0.2888164082060495,
+	0.289550627897843,
+	0.29028467725446233,
+	0.2910185558440851,
+	0.29175226323498926,
+	0.2924857989955539,
+	0.29321916269425863,
+	0.29395235389968466,
+	0.2946853721805143,
+	0.295418217105532,
+	0.2961508882436238,
+	0.29688338516377827,
+	0.2976157074350862,
+	0.2983478546267414,
+	0.2990798263080405,
+	0.29981162204838335,
+	0.30054324141727345,
+	0.30127468398431795,
+	0.3020059493192281,
+	0.30273703699181914,
+	0.3034679465720113,
+	0.3041986776298291,
+	0.3049292297354024,
+	0.3056596024589661,
+	0.3063897953708609,
+	0.3071198080415331,
+	0.30784964004153487,
+	0.3085792909415251,
+	0.3093087603122687,
+	0.3100380477246379,
+	0.3107671527496115,
+	0.3114960749582759,
+	0.3122248139218249,
+	0.3129533692115602,
+	0.3136817403988915,
+	0.31440992705533666,
+	0.31513792875252244,
+	0.31586574506218396,
+	0.31659337555616585,
+	0.31732081980642174,
+	0.31804807738501495,
+	0.3187751478641185,
+	0.3195020308160157,
+	0.32022872581309986,
+	0.3209552324278752,
+	0.3216815502329566,
+	0.32240767880106985,
+	0.32313361770505233,
+	0.32385936651785285,
+	0.32458492481253215,
+	0.3253102921622629,
+	0.32603546814033024,
+	0.32676045232013173,
+	0.327485244275178,
+	0.3282098435790925,
+	0.3289342498056122,
+	0.3296584625285875,
+	0.3303824813219828,
+	0.33110630575987643,
+	0.3318299354164611,
+	0.3325533698660442,
+	0.3332766086830479,
+	0.3339996514420094,
+	0.3347224977175812,
+	0.3354451470845316,
+	0.3361675991177445,
+	0.33688985339222005,
+	0.3376119094830746,
+	0.3383337669655411,
+	0.33905542541496964,
+	0.33977688440682685,
+	0.34049814351669716,
+	0.34121920232028236,
+	0.3419400603934022,
+	0.3426607173119944,
+	0.34338117265211504,
+	0.3441014259899388,
+	0.3448214769017593,
+	0.3455413249639891,
+	0.34626096975316,
+	0.3469804108459237,
+	0.3476996478190514,
+	0.34841868024943456,
+	0.34913750771408497,
+	0.3498561297901349,
+	0.3505745460548375,
+	0.3512927560855671,
+	0.3520107594598191,
+	0.3527285557552107,
+	0.3534461445494808,
+	0.35416352542049034,
+	0.3548806979462228,
+	0.35559766170478385,
+	0.3563144162744024,
+	0.35703096123343,
+	0.3577472961603419,
+	0.35846342063373654,
+	0.3591793342323365,
+	0.3598950365349881,
+	0.36061052712066227,
+	0.3613258055684543,
+	0.3620408714575842,
+	0.3627557243673972,
+	0.36347036387736376,
+	0.3641847895670799,
+	0.3648990010162673,
+	0.36561299780477385,
+	0.3663267795125736,
+	0.3670403457197672,
+	0.367753696006582,
+	0.3684668299533723,
+	0.36917974714062,
+	0.3698924471489341,
+	0.37060492955905167,
+	0.37131719395183754,
+	0.372029239908285,
+	0.37274106700951576,
+	0.3734526748367803,
+	0.37416406297145793,
+	0.37487523099505754,
+	0.3755861784892172,
+	0.3762969050357048,
+	0.37700741021641826,
+	0.37771769361338564,
+	0.37842775480876556,
+	0.3791375933848473,
+	0.37984720892405116,
+	0.3805566010089285,
+	0.3812657692221624,
+	0.3819747131465672,
+	0.3826834323650898,
+	0.38339192646080866,
+	0.38410019501693504,
+	0.3848082376168129,
+	0.38551605384391885,
+	0.386223643281863,
+	0.3869310055143886,
+	0.38763814012537273,
+	0.38834504669882625,
+	0.3890517248188944,
+	0.3897581740698564,
+	0.3904643940361266,
+	0.39117038430225387,
+	0.39187614445292235,
+	0.39258167407295147,
+	0.3932869727472964,
+	0.3939920400610481,
+	0.39469687559943356,
+	0.39540147894781635,
+	0.39610584969169627,
+	0.3968099874167103,
+	0.3975138917086323,
+	0.39821756215337356,
+	0.3989209983369829,
+	0.3996241998456468,
+	0.4003271662656901,
+	0.4010298971835756,
+	0.401732392185905,
+	0.40243465085941843,
+	0.4031366727909953,
+	0.4038384575676541,
+	0.404540004776553,
+	0.40524131400498986,
+	0.4059423848404025,
+	0.40664321687036903,
+	0.40734380968260797,
+	0.4080441628649787,
+	0.40874427600548136,
+	0.4094441486922576,
+	0.41014378051359024,
+	0.4108431710579039,
+	0.4115423199137652,
+	0.4122412266698829,
+	0.4129398909151081,
+	0.4136383122384345,
+	0.4143364902289991,
+	0.41503442447608163,
+	0.41573211456910536,
+	0.41642956009763715,
+	0.4171267606513879,
+	0.41782371582021227,
+	0.4185204251941097,
+	0.4192168883632239,
+	0.4199131049178436,
+	0.4206090744484025,
+	0.42130479654547964,
+	0.4220002707997997,
+	0.42269549680223295,
+	0.42339047414379605,
+	0.42408520241565156,
+	0.4247796812091088,
+	0.4254739101156238,
+	0.4261678887267996,
+	0.42686161663438643,
+	0.4275550934302821,
+	0.42824831870653196,
+	0.4289412920553295,
+	0.4296340130690164,
+	0.4303264813400826,
+	0.43101869646116703,
+	0.43171065802505726,
+	0.43240236562469014,
+	0.43309381885315196,
+	0.4337850173036785,
+	0.43447596056965565,
+	0.43516664824461926,
+	0.4358570799222555,
+	0.4365472551964012,
+	0.4372371736610441,
+	0.43792683491032286,
+	0.43861623853852766,
+	0.43930538414009995,
+	0.43999427130963326,
+	0.4406828996418729,
+	0.44137126873171667,
+	0.4420593781742147,
+	0.44274722756457,
+	0.4434348164981385,
+	0.4441221445704292,
+	0.4448092113771049,
+	0.44549601651398174,
+	0.44618255957703007,
+	0.44686884016237416,
+	0.447554857866293,
+	0.4482406122852199,
+	0.44892610301574326,
+	0.44961132965460654,
+	0.4502962917987086,
+	0.45098098904510386,
+	0.4516654209910025,
+	0.4523495872337709,
+	0.4530334873709316,
+	0.45371712100016387,
+	0.4544004877193036,
+	0.45508358712634384,
+	0.45576641881943464,
+	0.4564489823968839,
+	0.457131277457157,
+	0.4578133035988772,
+	0.4584950604208263,
+	0.4591765475219441,
+	0.45985776450132954,
+	0.46053871095824,
+	0.4612193864920924,
+	0.46189979070246273,
+	0.4625799231890868,
+	0.46325978355186015,
+	0.4639393713908385,
+	0.4646186863062378,
+	0.4652977278984346,
+	0.4659764957679662,
+	0.4666549895155309,
+	0.4673332087419884,
+	0.46801115304835983,
+	0.4686888220358279,
+	0.4693662153057375,
+	0.4700433324595956,
+	0.4707201730990716,
+	0.47139673682599764,
+	0.47207302324236866,
+	0.4727490319503428,
+	0.47342476255224153,
+	0.47410021465054997,
+	0.4747753878479171,
+	0.47545028174715587,
+	0.4761248959512436,
+	0.4767992300633221,
+	0.47747328368669806,
+	0.478147056424843,
+	0.4788205478813939,
+	0.479493757660153,
+	0.4801666853650884,
+	0.48083933060033396,
+	0.48151169297018986,
+	0.4821837720791227,
+	0.4828555675317657,
+	0.48352707893291874,
+	0.48419830588754903,
+	0.48486924800079106,
+	0.48553990487794696,
+	0.4862102761244864,
+	0.48688036134604734,
+	0.487550160148436,
+	0.4882196721376268,
+	0.48888889691976317,
+	0.48955783410115744,
+	0.49022648328829116,
+	0.4908948440878151,
+	0.4915629161065499,
+	0.492230698951486,
+	0.49289819222978404,
+	0.49356539554877477,
+	0.4942323085159597,
+	0.49489893073901126,
+	0.49556526182577254,
+	0.49623130138425825,
+	0.49689704902265447,
+	0.49756250434931915,
+	0.49822766697278187,
+	0.4988925365017446,
+	0.49955711254508184,
+	0.5002213947118407,
+	0.5008853826112407,
+	0.5015490758526754,
+	0.5022124740457108,
+	0.502875576800087,
+	0.5035383837257176,
+	0.5042008944326903,
+	0.5048631085312676,
+	0.5055250256318854,
+	0.5061866453451552,
+	0.5068479672818632,
+	0.5075089910529709,
+	0.5081697162696146,
+	0.508830142543107,
+	0.5094902694849364,
+	0.5101500967067668,
+	0.510809623820439,
+	0.5114688504379703,
+	0.5121277761715547,
+	0.512786400633563,
+	0.5134447234365435,
+	0.5141027441932217,
+	0.5147604625165012,
+	0.5154178780194629,
+	0.5160749903153666,
+	0.5167317990176499,
+	0.5173883037399291,
+	0.5180445040959993,
+	0.518700399699835,
+	0.5193559901655896,
+	0.520011275107596,
+	0.5206662541403672,
+	0.5213209268785957,
+	0.5219752929371544,
+	0.5226293519310966,
+	0.5232831034756564,
+	0.5239365471862486,
+	0.524589682678469,
+	0.5252425095680947,
+	0.5258950274710846,
+	0.5265472360035794,
+	0.5271991347819013,
+	0.5278507234225552,
+	0.5285020015422285,
+	0.5291529687577906,
+	0.5298036246862946,
+	0.5304539689449763,
+	0.531104001151255,
+	0.5317537209227333,
+	0.5324031278771979,
+	0.5330522216326194,
+	0.533701001807153,
+	0.5343494680191375,
+	0.5349976198870972,
+	0.5356454570297411,
+	0.5362929790659632,
+	0.5369401856148429,
+	0.5375870762956454,
+	0.5382336507278217,
+	0.5388799085310084,
+	0.5395258493250289,
+	0.5401714727298929,
+	0.5408167783657967,
+	0.5414617658531234,
+	0.5421064348124439,
+	0.5427507848645159,
+	0.5433948156302848,
+	0.5440385267308838,
+	0.5446819177876345,
+	0.5453249884220465,
+	0.5459677382558176,
+	0.5466101669108349,
+	0.5472522740091741,
+	0.5478940591731002,
+	0.5485355220250674,
+	0.5491766621877197,
+	0.5498174792838909,
+	0.5504579729366048,
+	0.5510981427690754,
+	0.5517379884047073,
+	0.5523775094670961,
+	0.5530167055800275,
+	0.5536555763674793,
+	0.55429412145362,
+	0.5549323404628104,
+	0.5555702330196022,
+	0.5562077987487399,
+	0.5568450372751601,
+	0.5574819482239916,
+	0.5581185312205561,
+	0.5587547858903683,
+	0.5593907118591361,
+	0.5600263087527604,
+	0.560661576197336,
+	0.5612965138191515,
+	0.5619311212446895,
+	0.5625653981006266,
+	0.5631993440138341,
+	0.5638329586113782,
+	0.5644662415205195,
+	0.565099192368714,
+	0.5657318107836131,
+	0.5663640963930638,
+	0.5669960488251087,
+	0.5676276677079862,
+	0.5682589526701315,
+	0.5688899033401759,
+	0.5695205193469471,
+	0.5701508003194703,
+	0.5707807458869673,
+	0.5714103556788572,
+	0.572039629324757,
+	0.5726685664544812,
+	0.5732971666980422,
+	0.5739254296856507,
+	0.5745533550477158,
+	0.5751809424148451,
+	0.5758081914178453,
+	0.5764351016877218,
+	0.5770616728556794,
+	0.5776879045531228,
+	0.5783137964116556,
+	0.5789393480630818,
+	0.5795645591394056,
+	0.5801894292728317,
+	0.5808139580957645,
+	0.5814381452408102,
+	0.5820619903407754,
+	0.5826854930286685,
+	0.5833086529376983,
+	0.5839314697012762,
+	0.5845539429530153,
+	0.5851760723267304,
+	0.5857978574564389,
+	0.5864192979763605,
+	0.587040393520918,
+	0.5876611437247367,
+	0.5882815482226452,
+	0.5889016066496757,
+	0.5895213186410639,
+	0.5901406838322488,
+	0.5907597018588742,
+	0.5913783723567876,
+	0.591996694962041,
+	0.5926146693108911,
+	0.5932322950397998,
+	0.5938495717854336,
+	0.5944664991846644,
+	0.59508307687457,
+	0.5956993044924334,
+	0.5963151816757437,
+	0.5969307080621965,
+	0.5975458832896932,
+	0.5981607069963423,
+	0.5987751788204587,
+	0.5993892984005645,
+	0.6000030653753889,
+	0.600616479383869,
+	0.6012295400651485,
+	0.60184224705858,
+	0.6024546000037238,
+	0.6030665985403482,
+	0.6036782423084304,
+	0.604289530948156,
+	0.6049004640999198,
+	0.6055110414043255,
+	0.6061212625021861,
+	0.6067311270345245,
+	0.6073406346425729,
+	0.6079497849677736,
+	0.6085585776517795,
+	0.6091670123364532,
+	0.6097750886638684,
+	0.6103828062763095,
+	0.6109901648162717,
+	0.6115971639264619,
+	0.612203803249798,
+	0.6128100824294097,
+	0.6134160011086386,
+	0.6140215589310384,
+	0.614626755540375,
+	0.6152315905806268,
+	0.6158360636959851,
+	0.6164401745308536,
+	0.6170439227298498,
+	0.6176473079378039,
+	0.6182503297997602,
+	0.6188529879609763,
+	0.619455282066924,
+	0.6200572117632891,
+	0.6206587766959721,
+	0.6212599765110876,
+	0.6218608108549654,
+	0.62246127937415,
+	0.6230613817154013,
+	0.6236611175256945,
+	0.6242604864522207,
+	0.6248594881423863,
+	0.6254581222438144,
+	0.6260563884043435,
+	0.6266542862720293,
+	0.6272518154951441,
+	0.6278489757221765,
+	0.6284457666018327,
+	0.629042187783036,
+	0.629638238914927,
+	0.6302339196468644,
+	0.6308292296284245,
+	0.6314241685094019,
+	0.6320187359398091,
+	0.6326129315698774,
+	0.6332067550500572,
+	0.6338002060310173,
+	0.6343932841636455,
+	0.6349859890990495,
+	0.6355783204885561,
+	0.6361702779837122,
+	0.6367618612362842,
+	0.6373530698982591,
+	0.637943903621844,
+	0.6385343620594668,
+	0.6391244448637757,
+	0.6397141516876405,
+	0.6403034821841517,
+	0.6408924360066214,
+	0.6414810128085832,
+	0.6420692122437925,
+	0.6426570339662269,
+	0.6432444776300859,
+	0.6438315428897914,
+	0.6444182293999884,
+	0.6450045368155439,
+	0.6455904647915487,
+	0.6461760129833163,
+	0.6467611810463839,
+	0.6473459686365121,
+	0.6479303754096853,
+	0.6485144010221124,
+	0.649098045130226,
+	0.6496813073906832,
+	0.6502641874603659,
+	0.6508466849963809,
+	0.6514287996560598,
+	0.6520105310969595,
+	0.6525918789768624,
+	0.6531728429537768,
+	0.6537534226859361,
+	0.6543336178318004,
+	0.654913428050056,
+	0.6554928529996153,
+	0.6560718923396176,
+	0.6566505457294289,
+	0.6572288128286425,
+	0.6578066932970786,
+	0.658384186794785,
+	0.6589612929820373,
+	0.6595380115193387,
+	0.6601143420674205,
+	0.6606902842872423,
+	0.6612658378399923,
+	0.6618410023870869,
+	0.6624157775901718,
+	0.6629901631111215,
+	0.6635641586120398,
+	0.66413776375526,
+	0.6647109782033448,
+	0.6652838016190872,
+	0.6658562336655097,
+	0.6664282740058652,
+	0.6669999223036375,
+	0.6675711782225403,
+	0.6681420414265185,
+	0.668712511579748,
+	0.669282588346636,
+	0.669852271391821,
+	0.6704215603801731,
+	0.6709904549767942,
+	0.6715589548470183,
+	0.6721270596564117,
+	0.6726947690707729,
+	0.673262082756133,
+	0.673829000378756,
+	0.674395521605139,
+	0.6749616461020119,
+	0.6755273735363385,
+	0.6760927035753159,
+	0.676657635886375,
+	0.6772221701371803,
+	0.6777863059956315,
+	0.6783500431298615,
+	0.6789133812082384,
+	0.679476319899365,
+	0.6800388588720789,
+	0.680600997795453,
+	0.6811627363387954,
+	0.6817240741716497,
+	0.6822850109637956,
+	0.6828455463852481,
+	0.6834056801062587,
+	0.6839654117973154,
+	0.6845247411291423,
+	0.6850836677727004,
+	0.6856421913991875,
+	0.6862003116800386,
+	0.6867580282869259,
+	0.687315340891759,
+	0.6878722491666855,
+	0.6884287527840904,
+	0.688984851416597,
+	0.6895405447370668,
+	0.6900958324186,
+	0.6906507141345346,
+	0.6912051895584485,
+	0.6917592583641577,
+	0.6923129202257182,
+	0.6928661748174246,
+	0.6934190218138118,
+	0.693971460889654,
+	0.6945234917199655,
+	0.6950751139800009,
+	0.6956263273452549,
+	0.696177131491463,
+	0.6967275260946012,
+	0.6972775108308865,
+	0.6978270853767773,
+	0.6983762494089729,
+	0.6989250026044141,
+	0.6994733446402838,
+	0.7000212751940063,
+	0.7005687939432483,
+	0.7011159005659187,
+	0.7016625947401685,
+	0.7022088761443919,
+	0.7027547444572253,
+	0.7033001993575487,
+	0.7038452405244849,
+	0.7043898676374004,
+	0.7049340803759049,
+	0.7054778784198521,
+	0.7060212614493397,
+	0.7065642291447095,
+	0.7071067811865475,
+	0.7076489172556844,
+	0.7081906370331953,
+	0.7087319402004006,
+	0.7092728264388656,
+	0.7098132954304008,
+	0.7103533468570623,
+	0.7108929804011517,
+	0.7114321957452164,
+	0.71197099257205,
+	0.7125093705646923,
+	0.7130473294064292,
+	0.7135848687807935,
+	0.7141219883715647,
+	0.714658687862769,
+	0.71519496693868,
+	0.7157308252838186,
+	0.7162662625829531,
+	0.7168012785210995,
+	0.7173358727835217,
+	0.7178700450557317,
+	0.7184037950234897,
+	0.7189371223728044,
+	0.719470026789933,
+	0.7200025079613817,
+	0.7205345655739053,
+	0.7210661993145081,
+	0.7215974088704437,
+	0.7221281939292153,
+	0.7226585541785756,
+	0.7231884893065273,
+	0.7237179990013234,
+	0.7242470829514669,
+	0.7247757408457113,
+	0.7253039723730607,
+	0.7258317772227704,
+	0.726359155084346,
+	0.726886105647545,
+	0.7274126286023758,
+	0.7279387236390986,
+	0.7284643904482252,
+	0.7289896287205193,
+	0.7295144381469969,
+	0.7300388184189261,
+	0.7305627692278276,
+	0.7310862902654742,
+	0.7316093812238925,
+	0.7321320417953613,
+	0.7326542716724128,
+	0.7331760705478327,
+	0.7336974381146603,
+	0.7342183740661882,
+	0.7347388780959634,
+	0.7352589498977867,
+	0.7357785891657135,
+	0.7362977955940531,
+	0.7368165688773698,
+	0.7373349087104828,
+	0.737852814788466,
+	0.7383702868066485,
+	0.7388873244606151,
+	0.7394039274462058,
+	0.7399200954595161,
+	0.740435828196898,
+	0.7409511253549591,
+	0.7414659866305633,
+	0.741980411720831,
+	0.7424944003231392,
+	0.7430079521351217,
+	0.7435210668546691,
+	0.7440337441799292,
+	0.7445459838093073,
+	0.745057785441466,
+	0.7455691487753254,
+	0.7460800735100638,
+	0.7465905593451173,
+	0.7471006059801801,
+	0.7476102131152051,
+	0.7481193804504035,
+	0.7486281076862453,
+	0.7491363945234593,
+	0.7496442406630335,
+	0.750151645806215,
+	0.7506586096545106,
+	0.7511651319096864,
+	0.7516712122737684,
+	0.7521768504490427,
+	0.7526820461380552,
+	0.7531867990436124,
+	0.7536911088687812,
+	0.7541949753168892,
+	0.7546983980915244,
+	0.7552013768965365,
+	0.7557039114360359,
+	0.7562060014143945,
+	0.7567076465362457,
+	0.7572088465064845,
+	0.7577096010302681,
+	0.7582099098130153,
+	0.7587097725604074,
+	0.759209188978388,
+	0.7597081587731634,
+	0.7602066816512024,
+	0.7607047573192369,
+	0.7612023854842618,
+	0.7616995658535353,
+	0.7621962981345789,
+	0.7626925820351779,
+	0.7631884172633813,
+	0.7636838035275019,
+	0.7641787405361167,
+	0.7646732279980671,
+	0.765167265622459,
+	0.7656608531186624,
+	0.7661539901963128,
+	0.7666466765653104,
+	0.7671389119358204,
+	0.7676306960182733,
+	0.7681220285233653,
+	0.7686129091620583,
+	0.7691033376455796,
+	0.7695933136854229,
+	0.7700828369933479,
+	0.7705719072813807,
+	0.7710605242618137,
+	0.7715486876472063,
+	0.7720363971503844,
+	0.7725236524844413,
+	0.773010453362737,
+	0.773496799498899,
+	0.7739826906068228,
+	0.7744681264006709,
+	0.7749531065948738,
+	0.7754376309041304,
+	0.7759216990434076,
+	0.7764053107279404,
+	0.7768884656732324,
+	0.7773711635950562,
+	0.777853404209453,
+	0.7783351872327331,
+	0.7788165123814759,
+	0.7792973793725303,
+	0.7797777879230144,
+	0.7802577377503166,
+	0.7807372285720944,
+	0.7812162601062761,
+	0.7816948320710594,
+	0.7821729441849129,
+	0.7826505961665757,
+	0.7831277877350573,
+	0.7836045186096382,
+	0.78408078850987,
+	0.7845565971555752,
+	0.7850319442668481,
+	0.7855068295640539,
+	0.7859812527678302,
+	0.7864552135990858,
+	0.7869287117790017,
+	0.7874017470290313,
+	0.7878743190709001,
+	0.7883464276266062,
+	0.7888180724184202,
+	0.7892892531688857,
+	0.7897599696008191,
+	0.79023022143731,
+	0.7907000084017216,
+	0.7911693302176901,
+	0.7916381866091258,
+	0.7921065773002124,
+	0.7925745020154076,
+	0.7930419604794436,
+	0.7935089524173267,
+	0.7939754775543372,
+	0.7944415356160306,
+	0.794907126328237,
+	0.7953722494170612,
+	0.7958369046088835,
+	0.7963010916303591,
+	0.7967648102084187,
+	0.7972280600702687,
+	0.797690840943391,
+	0.7981531525555438,
+	0.7986149946347608,
+	0.7990763669093524,
+	0.799537269107905,
+	0.7999977009592819,
+	0.8004576621926227,
+	0.8009171525373443,
+	0.8013761717231401,
+	0.8018347194799813,
+	0.8022927955381157,
+	0.8027503996280692,
+	0.8032075314806448,
+	0.8036641908269241,
+	0.8041203773982657,
+	0.804576090926307,
+	0.8050313311429637,
+	0.8054860977804291,
+	0.8059403905711763,
+	0.8063942092479562,
+	0.8068475535437992,
+	0.8073004231920144,
+	0.8077528179261904,
+	0.8082047374801947,
+	0.808656181588175,
+	0.8091071499845581,
+	0.8095576424040513,
+	0.8100076585816411,
+	0.8104571982525948,
+	0.8109062611524597,
+	0.8113548470170637,
+	0.8118029555825154,
+	0.8122505865852039,
+	0.8126977397617995,
+	0.8131444148492536,
+	0.8135906115847985,
+	0.8140363297059483,
+	0.8144815689504986,
+	0.8149263290565266,
+	0.8153706097623913,
+	0.8158144108067338,
+	0.8162577319284774,
+	0.8167005728668278,
+	0.817142933361273,
+	0.8175848131515837,
+	0.8180262119778134,
+	0.8184671295802987,
+	0.818907565699659,
+	0.8193475200767969,
+	0.819786992452899,
+	0.8202259825694347,
+	0.8206644901681575,
+	0.8211025149911046,
+	0.8215400567805976,
+	0.8219771152792416,
+	0.8224136902299264,
+	0.8228497813758263,
+	0.8232853884604001,
+	0.8237205112273913,
+	0.8241551494208286,
+	0.8245893027850253,
+	0.8250229710645802,
+	0.8254561540043774,
+	0.8258888513495868,
+	0.8263210628456634,
+	0.8267527882383485,
+	0.827184027273669,
+	0.8276147796979384,
+	0.8280450452577558,
+	0.8284748237000071,
+	0.8289041147718649,
+	0.8293329182207883,
+	0.829761233794523,
+	0.8301890612411024,
+	0.8306164003088462,
+	0.8310432507463623,
+	0.8314696123025452,
+	0.8318954847265776,
+	0.8323208677679297,
+	0.8327457611763595,
+	0.8331701647019132,
+	0.8335940780949251,
+	0.8340175011060181,
+	0.8344404334861032,
+	0.83486287498638,
+	0.8352848253583374,
+	0.8357062843537526,
+	0.8361272517246922,
+	0.8365477272235119,
+	0.836967710602857,
+	0.8373872016156619,
+	0.8378062000151509,
+	0.838224705554838,
+	0.8386427179885273,
+	0.8390602370703126,
+	0.8394772625545786,
+	0.8398937941959994,
+	0.8403098317495408,
+	0.8407253749704581,
+	0.8411404236142981,
+	0.8415549774368983,
+	0.8419690361943877,
+	0.842382599643186,
+	0.8427956675400041,
+	0.8432082396418454,
+	0.843620315706004,
+	0.8440318954900664,
+	0.8444429787519107,
+	0.844853565249707,
+	0.8452636547419182,
+	0.8456732469872991,
+	0.8460823417448969,
+	0.846490938774052,
+	0.8468990378343974,
+	0.8473066386858583,
+	0.8477137410886543,
+	0.8481203448032971,
+	0.8485264495905926,
+	0.8489320552116396,
+	0.8493371614278307,
+	0.8497417680008524,
+	0.8501458746926852,
+	0.8505494812656034,
+	0.8509525874821757,
+	0.8513551931052652,
+	0.8517572978980291,
+	0.8521589016239198,
+	0.852560004046684,
+	0.8529606049303636,
+	0.8533607040392954,
+	0.8537603011381113,
+	0.8541593959917387,
+	0.8545579883654005,
+	0.8549560780246148,
+	0.855353664735196,
+	0.8557507482632539,
+	0.8561473283751945,
+	0.85654340483772,
+	0.8569389774178287,
+	0.8573340458828156,
+	0.8577286100002721,
+	0.858122669538086,
+	0.8585162242644427,
+	0.8589092739478239,
+	0.8593018183570084,
+	0.8596938572610726,
+	0.8600853904293901,
+	0.8604764176316321,
+	0.8608669386377673,
+	0.8612569532180621,
+	0.8616464611430813,
+	0.8620354621836872,
+	0.8624239561110405,
+	0.8628119426966003,
+	0.8631994217121242,
+	0.863586392929668,
+	0.8639728561215867,
+	0.864358811060534,
+	0.8647442575194624,
+	0.8651291952716237,
+	0.865513624090569,
+	0.8658975437501488,
+	0.866280954024513,
+	0.866663854688111,
+	0.8670462455156926,
+	0.8674281262823069,
+	0.8678094967633032,
+	0.8681903567343313,
+	0.8685707059713409,
+	0.8689505442505824,
+	0.8693298713486067,
+	0.8697086870422656,
+	0.8700869911087113,
+	0.8704647833253977,
+	0.8708420634700789,
+	0.8712188313208109,
+	0.8715950866559511,
+	0.8719708292541577,
+	0.8723460588943915,
+	0.8727207753559143,
+	0.8730949784182901,
+	0.8734686678613849,
+	0.8738418434653668,
+	0.8742145050107063,
+	0.8745866522781761,
+	0.8749582850488515,
+	0.8753294031041108,
+	0.8757000062256346,
+	0.8760700941954066,
+	0.8764396667957136,
+	0.8768087238091458,
+	0.8771772650185959,
+	0.8775452902072612,
+	0.8779127991586417,
+	0.8782797916565415,
+	0.8786462674850681,
+	0.8790122264286334,
+	0.8793776682719532,
+	0.8797425928000474,
+	0.8801069997982404,
+	0.8804708890521608,
+	0.880834260347742,
+	0.881197113471222,
+	0.8815594482091438,
+	0.8819212643483549,
+	0.8822825616760086,
+	0.8826433399795628,
+	0.8830035990467807,
+	0.8833633386657316,
+	0.8837225586247897,
+	0.884081258712635,
+	0.8844394387182537,
+	0.8847970984309378,
+	0.8851542376402851,
+	0.8855108561362,
+	0.8858669537088928,
+	0.8862225301488806,
+	0.886577585246987,
+	0.8869321187943421,
+	0.8872861305823831,
+	0.8876396204028539,
+	0.8879925880478056,
+	0.8883450333095962,
+	0.8886969559808917,
+	0.8890483558546646,
+	0.8893992327241955,
+	0.8897495863830729,
+	0.8900994166251922,
+	0.8904487232447579,
+	0.8907975060362815,
+	0.8911457647945832,
+	0.8914934993147914,
+	0.8918407093923427,
+	0.8921873948229825,
+	0.8925335554027647,
+	0.8928791909280517,
+	0.8932243011955153,
+	0.893568886002136,
+	0.8939129451452033,
+	0.894256478422316,
+	0.8945994856313826,
+	0.8949419665706208,
+	0.8952839210385576,
+	0.89562534883403,
+	0.8959662497561851,
+	0.8963066236044797,
+	0.8966464701786802,
+	0.896985789278864,
+	0.8973245807054183,
+	0.8976628442590407,
+	0.8980005797407399,
+	0.8983377869518342,
+	0.8986744656939538,
+	0.8990106157690391,
+	0.8993462369793415,
+	0.8996813291274239,
+	0.9000158920161603,
+	0.9003499254487356,
+	0.9006834292286469,
+	0.9010164031597023,
+	0.901348847046022,
+	0.9016807606920377,
+	0.9020121439024931,
+	0.9023429964824442,
+	0.9026733182372588,
+	0.903003108972617,
+	0.9033323684945118,
+	0.903661096609248,
+	0.9039892931234433,
+	0.9043169578440283,
+	0.9046440905782462,
+	0.9049706911336532,
+	0.9052967593181188,
+	0.9056222949398252,
+	0.9059472978072685,
+	0.9062717677292577,
+	0.9065957045149153,
+	0.906919107973678,
+	0.9072419779152959,
+	0.9075643141498325,
+	0.9078861164876662,
+	0.9082073847394887,
+	0.9085281187163061,
+	0.9088483182294391,
+	0.9091679830905223,
+	0.9094871131115054,
+	0.9098057081046522,
+	0.9101237678825416,
+	0.9104412922580671,
+	0.9107582810444376,
+	0.9110747340551762,
+	0.9113906511041223,
+	0.9117060320054299,
+	0.9120208765735682,
+	0.9123351846233227,
+	0.9126489559697939,
+	0.9129621904283981,
+	0.9132748878148678,
+	0.9135870479452508,
+	0.9138986706359117,
+	0.9142097557035307,
+	0.9145203029651044,
+	0.9148303122379461,
+	0.9151397833396853,
+	0.9154487160882678,
+	0.9157571103019567,
+	0.9160649657993316,
+	0.9163722823992891,
+	0.9166790599210427,
+	0.9169852981841229,
+	0.9172909970083779,
+	0.917596156213973,
+	0.9179007756213904,
+	0.9182048550514309,
+	0.9185083943252123,
+	0.9188113932641699,
+	0.9191138516900578,
+	0.919415769424947,
+	0.9197171462912274,
+	0.9200179821116066,
+	0.9203182767091105,
+	0.9206180299070839,
+	0.9209172415291895,
+	0.9212159113994087,
+	0.9215140393420419,
+	0.9218116251817081,
+	0.9221086687433451,
+	0.9224051698522099,
+	0.9227011283338785,
+	0.9229965440142462,
+	0.9232914167195276,
+	0.9235857462762566,
+	0.9238795325112867,
+	0.9241727752517912,
+	0.9244654743252626,
+	0.9247576295595139,
+	0.9250492407826776,
+	0.9253403078232062,
+	0.9256308305098727,
+	0.92592080867177,
+	0.9262102421383113,
+	0.9264991307392305,
+	0.9267874743045817,
+	0.9270752726647401,
+	0.9273625256504011,
+	0.9276492330925812,
+	0.9279353948226179,
+	0.9282210106721694,
+	0.9285060804732155,
+	0.928790604058057,
+	0.9290745812593157,
+	0.9293580119099355,
+	0.9296408958431813,
+	0.9299232328926396,
+	0.9302050228922191,
+	0.9304862656761498,
+	0.9307669610789837,
+	0.9310471089355952,
+	0.9313267090811804,
+	0.9316057613512578,
+	0.9318842655816681,
+	0.9321622216085743,
+	0.9324396292684624,
+	0.9327164883981403,
+	0.9329927988347388,
+	0.933268560415712,
+	0.9335437729788362,
+	0.933818436362211,
+	0.9340925504042589,
+	0.9343661149437259,
+	0.9346391298196808,
+	0.9349115948715161,
+	0.9351835099389475,
+	0.9354548748620146,
+	0.9357256894810804,
+	0.9359959536368313,
+	0.9362656671702783,
+	0.9365348299227555,
+	0.9368034417359216,
+	0.9370715024517592,
+	0.937339011912575,
+	0.937605969961,
+	0.9378723764399899,
+	0.9381382311928244,
+	0.9384035340631081,
+	0.9386682848947702,
+	0.9389324835320645,
+	0.9391961298195699,
+	0.9394592236021899,
+	0.9397217647251533,
+	0.9399837530340139,
+	0.9402451883746509,
+	0.9405060705932683,
+	0.9407663995363961,
+	0.9410261750508893,
+	0.9412853969839287,
+	0.9415440651830208,
+	0.9418021794959976,
+	0.9420597397710173,
+	0.9423167458565638,
+	0.9425731976014469,
+	0.9428290948548027,
+	0.9430844374660935,
+	0.9433392252851077,
+	0.9435934581619604,
+	0.9438471359470927,
+	0.9441002584912727,
+	0.9443528256455948,
+	0.9446048372614803,
+	0.9448562931906772,
+	0.9451071932852606,
+	0.9453575373976323,
+	0.9456073253805213,
+	0.9458565570869839,
+	0.9461052323704033,
+	0.9463533510844906,
+	0.9466009130832835,
+	0.946847918221148,
+	0.9470943663527772,
+	0.9473402573331919,
+	0.9475855910177411,
+	0.947830367262101,
+	0.9480745859222762,
+	0.9483182468545991,
+	0.9485613499157303,
+	0.9488038949626584,
+	0.9490458818527006,
+	0.949287310443502,
+	0.9495281805930367,
+	0.9497684921596067,
+	0.950008245001843,
+	0.9502474389787052,
+	0.9504860739494817,
+	0.9507241497737896,
+	0.9509616663115751,
+	0.9511986234231132,
+	0.9514350209690083,
+	0.9516708588101939,
+	0.9519061368079322,
+	0.9521408548238158,
+	0.9523750127197659,
+	0.9526086103580332,
+	0.9528416476011987,
+	0.9530741243121722,
+	0.9533060403541938,
+	0.9535373955908333,
+	0.9537681898859903,
+	0.9539984231038945,
+	0.9542280951091057,
+	0.9544572057665135,
+	0.9546857549413383,
+	0.9549137424991305,
+	0.9551411683057707,
+	0.9553680322274702,
+	0.9555943341307711,
+	0.9558200738825454,
+	0.9560452513499964,
+	0.9562698664006581,
+	0.956493918902395,
+	0.956717408723403,
+	0.9569403357322089,
+	0.9571626997976701,
+	0.9573845007889759,
+	0.9576057385756462,
+	0.9578264130275329,
+	0.9580465240148186,
+	0.9582660714080177,
+	0.9584850550779761,
+	0.9587034748958716,
+	0.9589213307332131,
+	0.9591386224618419,
+	0.9593553499539308,
+	0.9595715130819845,
+	0.9597871117188399,
+	0.9600021457376658,
+	0.9602166150119634,
+	0.9604305194155658,
+	0.9606438588226385,
+	0.9608566331076797,
+	0.9610688421455194,
+	0.9612804858113206,
+	0.961491563980579,
+	0.9617020765291225,
+	0.9619120233331121,
+	0.9621214042690416,
+	0.9623302192137374,
+	0.9625384680443592,
+	0.9627461506383994,
+	0.9629532668736839,
+	0.9631598166283714,
+	0.963365799780954,
+	0.9635712162102572,
+	0.9637760657954398,
+	0.9639803484159941,
+	0.9641840639517457,
+	0.9643872122828543,
+	0.9645897932898126,
+	0.9647918068534479,
+	0.9649932528549203,
+	0.9651941311757247,
+	0.9653944416976894,
+	0.9655941843029768,
+	0.9657933588740836,
+	0.9659919652938406,
+	0.9661900034454126,
+	0.9663874732122988,
+	0.9665843744783331,
+	0.9667807071276833,
+	0.9669764710448521,
+	0.9671716661146766,
+	0.9673662922223285,
+	0.9675603492533144,
+	0.9677538370934755,
+	0.9679467556289878,
+	0.9681391047463623,
+	0.9683308843324453,
+	0.9685220942744173,
+	0.9687127344597948,
+	0.9689028047764289,
+	0.9690923051125061,
+	0.9692812353565485,
+	0.969469595397413,
+	0.9696573851242924,
+	0.9698446044267148,
+	0.970031253194544,
+	0.9702173313179792,
+	0.9704028386875555,
+	0.9705877751941436,
+	0.9707721407289504,
+	0.970955935183518,
+	0.9711391584497251,
+	0.9713218104197862,
+	0.9715038909862518,
+	0.9716854000420085,
+	0.9718663374802794,
+	0.9720467031946235,
+	0.9722264970789363,
+	0.9724057190274498,
+	0.9725843689347322,
+	0.9727624466956886,
+	0.9729399522055601,
+	0.9731168853599251,
+	0.9732932460546982,
+	0.973469034186131,
+	0.9736442496508119,
+	0.9738188923456661,
+	0.9739929621679558,
+	0.9741664590152803,
+	0.9743393827855759,
+	0.9745117333771157,
+	0.9746835106885107,
+	0.9748547146187084,
+	0.9750253450669941,
+	0.9751954019329904,
+	0.9753648851166569,
+	0.9755337945182914,
+	0.9757021300385286,
+	0.975869891578341,
+	0.976037079039039,
+	0.9762036923222706,
+	0.9763697313300211,
+	0.9765351959646145,
+	0.9767000861287118,
+	0.9768644017253126,
+	0.9770281426577544,
+	0.9771913088297123,
+	0.9773539001452,
+	0.9775159165085693,
+	0.9776773578245099,
+	0.9778382239980504,
+	0.9779985149345571,
+	0.978158230539735,
+	0.9783173707196277,
+	0.9784759353806168,
+	0.9786339244294231,
+	0.9787913377731057,
+	0.9789481753190622,
+	0.9791044369750292,
+	0.979260122649082,
+	0.9794152322496348,
+	0.9795697656854405,
+	0.9797237228655912,
+	0.9798771036995176,
+	0.98002990809699,
+	0.9801821359681173,
+	0.980333787223348,
+	0.9804848617734694,
+	0.9806353595296081,
+	0.9807852804032304,
+	0.9809346243061416,
+	0.9810833911504866,
+	0.9812315808487497,
+	0.9813791933137546,
+	0.9815262284586647,
+	0.9816726861969831,
+	0.9818185664425525,
+	0.9819638691095552,
+	0.9821085941125136,
+	0.9822527413662894,
+	0.9823963107860847,
+	0.9825393022874412,
+	0.9826817157862409,
+	0.9828235511987052,
+	0.9829648084413964,
+	0.9831054874312163,
+	0.9832455880854071,
+	0.9833851103215512,
+	0.9835240540575713,
+	0.9836624192117303,
+	0.9838002057026315,
+	0.9839374134492189,
+	0.9840740423707764,
+	0.984210092386929,
+	0.9843455634176419,
+	0.9844804553832209,
+	0.9846147682043126,
+	0.9847485018019042,
+	0.9848816560973237,
+	0.9850142310122398,
+	0.9851462264686622,
+	0.9852776423889412,
+	0.9854084786957684,
+	0.9855387353121761,
+	0.9856684121615376,
+	0.9857975091675674,
+	0.9859260262543211,
+	0.9860539633461954,
+	0.9861813203679283,
+	0.9863080972445987,
+	0.9864342939016271,
+	0.9865599102647754,
+	0.9866849462601467,
+	0.9868094018141854,
+	0.9869332768536777,
+	0.987056571305751,
+	0.9871792850978743,
+	0.9873014181578584,
+	0.9874229704138554,
+	0.9875439417943592,
+	0.9876643322282057,
+	0.9877841416445722,
+	0.9879033699729778,
+	0.9880220171432835,
+	0.9881400830856926,
+	0.9882575677307495,
+	0.9883744710093413,
+	0.9884907928526966,
+	0.9886065331923864,
+	0.9887216919603238,
+	0.9888362690887635,
+	0.988950264510303,
+	0.9890636781578815,
+	0.989176509964781,
+	0.9892887598646252,
+	0.9894004277913804,
+	0.9895115136793552,
+	0.9896220174632008,
+	0.9897319390779106,
+	0.9898412784588205,
+	0.989950035541609,
+	0.9900582102622971,
+	0.9901658025572484,
+	0.9902728123631691,
+	0.9903792396171082,
+	0.990485084256457,
+	0.9905903462189501,
+	0.9906950254426646,
+	0.9907991218660204,
+	0.99090263542778,
+	0.9910055660670494,
+	0.9911079137232768,
+	0.9912096783362541,
+	0.9913108598461154,
+	0.9914114581933385,
+	0.9915114733187439,
+	0.9916109051634954,
+	0.9917097536690995,
+	0.9918080187774064,
+	0.9919057004306093,
+	0.9920027985712445,
+	0.9920993131421918,
+	0.9921952440866739,
+	0.9922905913482574,
+	0.9923853548708517,
+	0.99247953459871,
+	0.9925731304764288,
+	0.992666142448948,
+	0.9927585704615511,
+	0.9928504144598651,
+	0.9929416743898605,
+	0.9930323501978514,
+	0.9931224418304956,
+	0.9932119492347945,
+	0.9933008723580933,
+	0.9933892111480807,
+	0.9934769655527892,
+	0.9935641355205953,
+	0.9936507210002191,
+	0.9937367219407246,
+	0.9938221382915197,
+	0.9939069700023561,
+	0.9939912170233294,
+	0.9940748793048794,
+	0.9941579567977897,
+	0.9942404494531879,
+	0.9943223572225458,
+	0.9944036800576791,
+	0.9944844179107476,
+	0.9945645707342554,
+	0.9946441384810507,
+	0.9947231211043257,
+	0.9948015185576171,
+	0.9948793307948056,
+	0.9949565577701164,
+	0.9950331994381186,
+	0.9951092557537261,
+	0.9951847266721968,
+	0.9952596121491334,
+	0.9953339121404823,
+	0.9954076266025349,
+	0.9954807554919269,
+	0.9955532987656385,
+	0.9956252563809943,
+	0.9956966282956635,
+	0.9957674144676598,
+	0.9958376148553416,
+	0.9959072294174117,
+	0.9959762581129178,
+	0.996044700901252,
+	0.9961125577421511,
+	0.9961798285956969,
+	0.9962465134223155,
+	0.996312612182778,
+	0.9963781248382002,
+	0.9964430513500426,
+	0.9965073916801108,
+	0.9965711457905548,
+	0.9966343136438699,
+	0.9966968952028961,
+	0.996758890430818,
+	0.9968202992911657,
+	0.9968811217478138,
+	0.9969413577649822,
+	0.9970010073072353,
+	0.997060070339483,
+	0.99711854682698,
+	0.9971764367353262,
+	0.9972337400304662,
+	0.9972904566786902,
+	0.9973465866466332,
+	0.9974021299012753,
+	0.9974570864099419,
+	0.9975114561403035,
+	0.9975652390603758,
+	0.9976184351385196,
+	0.997671044343441,
+	0.9977230666441916,
+	0.9977745020101678,
+	0.9978253504111116,
+	0.9978756118171102,
+	0.997925286198596,
+	0.997974373526347,
+	0.9980228737714862,
+	0.9980707869054823,
+	0.9981181129001492,
+	0.9981648517276462,
+	0.9982110033604782,
+	0.9982565677714952,
+	0.9983015449338929,
+	0.9983459348212124,
+	0.9983897374073402,
+	0.9984329526665084,
+	0.9984755805732948,
+	0.9985176211026222,
+	0.9985590742297593,
+	0.9985999399303204,
+	0.9986402181802653,
+	0.9986799089558991,
+	0.9987190122338729,
+	0.9987575279911833,
+	0.9987954562051724,
+	0.998832796853528,
+	0.9988695499142836,
+	0.9989057153658183,
+	0.9989412931868569,
+	0.9989762833564698,
+	0.9990106858540734,
+	0.9990445006594293,
+	0.9990777277526454,
+	0.9991103671141749,
+	0.9991424187248169,
+	0.9991738825657164,
+	0.9992047586183639,
+	0.9992350468645959,
+	0.9992647472865944,
+	0.9992938598668878,
+	0.9993223845883495,
+	0.9993503214341994,
+	0.9993776703880028,
+	0.9994044314336713,
+	0.9994306045554617,
+	0.9994561897379773,
+	0.999481186966167,
+	0.9995055962253253,
+	0.9995294175010931,
+	0.999552650779457,
+	0.9995752960467492,
+	0.9995973532896484,
+	0.9996188224951786,
+	0.9996397036507102,
+	0.9996599967439592,
+	0.9996797017629879,
+	0.9996988186962042,
+	0.9997173475323622,
+	0.9997352882605617,
+	0.9997526408702488,
+	0.9997694053512153,
+	0.9997855816935992,
+	0.9998011698878843,
+	0.9998161699249004,
+	0.9998305817958234,
+	0.9998444054921752,
+	0.9998576410058239,
+	0.999870288328983,
+	0.9998823474542126,
+	0.9998938183744185,
+	0.9999047010828529,
+	0.9999149955731135,
+	0.9999247018391445,
+	0.999933819875236,
+	0.9999423496760239,
+	0.9999502912364905,
+	0.9999576445519639,
+	0.9999644096181183,
+	0.9999705864309741,
+	0.9999761749868976,
+	0.9999811752826011,
+	0.9999855873151432,
+	0.9999894110819284,
+	0.9999926465807072,
+	0.9999952938095762,
+	0.9999973527669782,
+	0.9999988234517019,
+	0.9999997058628822,
+	1.0,
 };
 
 #endif /* FFT_TWIDDLE_H */
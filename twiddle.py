@@ -1,6 +1,5 @@
 #!/bin/python
 import argparse
-import cmath
 import math
 import sys
 
@@ -13,29 +12,91 @@ def _v():
 
 def powerof2(strint) -> int:
     ival=int(strint)
-    if (ival<2) or (ival.bit_count() != 1):
-        raise(argparse.ArgumentTypeError("Argument is not a power of 2"))
+    # at least 4 so that the quarter wave has an entry for sin(π/2)
+    if (ival<4) or (ival.bit_count() != 1):
+        raise(argparse.ArgumentTypeError("Argument is not a power of 2 (4 or more)"))
     return ival
 
 def parse_args(inargs) -> argparse.Namespace:
     parser = argparse.ArgumentParser(
         description="This script generates twiddle.h")
-    parser.add_argument("-m", "--max", default=4096, type=powerof2,
+    # note: the default is twice MAX_SAMPLES from cfg.h to leave room for the
+    # zero-padded convolution of the Bluestein FFT
+    parser.add_argument("-m", "--max", default=8192, type=powerof2,
         help="specify the maximum FFT size (must be a power of 2)")
+    parser.add_argument("-l", "--layout", action="append", default=[],
+        choices=["split", "dup", "radix4"],
+        help="also emit per-stage tables in a layout for vectorized kernels: "
+        "split re/im arrays, duplicated (re,re)/(im,im) pairs or radix-4 "
+        "(w, w², w³) triplets; may be repeated")
     parser.add_argument("-o", "--output", default="twiddle.h",
         type=argparse.FileType('w'), help="specify an different output file")
     parser.add_argument("-v", "--verbose", action="store_true",
         help="extra output for debug")
     return(parser.parse_args(inargs))
 
-# translate numbers into subscript form
-def subscript(val) -> str:
-    tln = str.maketrans("0123456789", "₀₁₂₃₄₅₆₇₈₉")
-    return str(val).translate(tln)
-
-# TBD: use this to clamp numbers that are close to 0 or 1
-def clamp(cval: complex) -> complex:
-    return cval
+def twiddle(k, n) -> tuple:
+    """real and imaginary part of e^(-i2πk/n)"""
+    # reduce to the first octant so the symmetric values are exact
+    (q, r)=divmod(4*k, n) # 2πk/n = qπ/2 + 2πr/4n
+    if (2*r <= n):
+        (c, s)=(math.cos(2*math.pi*r/(4*n)), math.sin(2*math.pi*r/(4*n)))
+    else:
+        (c, s)=(math.sin(2*math.pi*(n-r)/(4*n)), math.cos(2*math.pi*(n-r)/(4*n)))
+    (c, s)=((c, s), (-s, c), (-c, -s), (s, -c))[q%4]
+    return (c+0.0, 0.0-s)
+
+def emit_split(size, out):
+    # radix-2 stage with half size h reads [h..2h), entry 0 is unused
+    re=[0.0]*size
+    im=[0.0]*size
+    h=1
+    while (h < size):
+        for k in range(h):
+            re[h+k], im[h+k]=twiddle(k, 2*h)
+        h*=2
+    print("""#define TWIDDLE_LAYOUT_SPLIT
+/* W_re[h+k] + iW_im[h+k] = e^(-iπk/h) for the radix-2 stage of half size h */""",
+        file=out)
+    for (name, values) in (("W_re", re), ("W_im", im)):
+        print("const double {}[{}] __attribute__((aligned(64))) =\n{{".format(
+            name, size), file=out)
+        for v in values:
+            print("\t{},".format(repr(v)), file=out)
+        print("};\n", file=out)
+
+def emit_dup(size, out):
+    # same entries as the split layout, with each value stored twice
+    print("""#define TWIDDLE_LAYOUT_DUP
+/* W_dup_re[2(h+k)..2(h+k)+1] = cos(πk/h), W_dup_im[2(h+k)..2(h+k)+1] = -sin(πk/h)
+ * for the radix-2 stage of half size h */""", file=out)
+    for part in range(2):
+        print("const double {}[{}] __attribute__((aligned(64))) =\n{{".format(
+            ("W_dup_re", "W_dup_im")[part], 2*size), file=out)
+        print("\t0.0, 0.0,", file=out)
+        h=1
+        while (h < size):
+            for k in range(h):
+                v=repr(twiddle(k, 2*h)[part])
+                print("\t{}, {},".format(v, v), file=out)
+            h*=2
+        print("};\n", file=out)
+
+def emit_radix4(size, out):
+    # radix-4 stage with quarter size m reads [3m..6m), entries 0-2 are unused
+    print("""#define TWIDDLE_LAYOUT_RADIX4
+/* W_r4[3(m+k)+j] = e^(-i2π(j+1)k/4m) for the radix-4 stage of quarter size m */
+const double complex W_r4[{}] __attribute__((aligned(64))) =
+{{""".format(3*size//2 if (size >= 4) else 3), file=out)
+    print("\t0.0, 0.0, 0.0,", file=out)
+    m=1
+    while (4*m <= size):
+        for k in range(m):
+            for j in range(1, 4):
+                (re, im)=twiddle(j*k, 4*m)
+                print("\tCMPLX({}, {}),".format(repr(re), repr(im)), file=out)
+        m*=2
+    print("};\n", file=out)
 
 def main(inargs) -> int:
     global args
@@ -52,32 +113,36 @@ def main(inargs) -> int:
 #define FFT_TWIDDLE_H
 
 #include <complex.h>
-""".format(args.max), file=args.output)
-
-    i=2
-    i2=1 # i//2
-    count=0
-    while (i <= args.max):
-        print("const double complex W{}²[{}] =\n{{".format(subscript(i), i2),
-            file=args.output)
-
-        for k in range(i//2):
-            print("\t{},".format(clamp(cmath.exp(-1j*k*math.pi/i2))),
-                file=args.output)
-
-        print("};\n", file=args.output)
-        i=i*2
-        i2=i2*2
-        count=count+1
-
-    print("const double complex* const W²[{}] =\n{{".format(count),
-            file=args.output)
-    i=2
-    while (i <= args.max):
-        print("\tW{}²,".format(subscript(i)), file=args.output)
-        i=i*2
+
+#define TWIDDLE_MAX_SAMPLES ((size_t){}U)
+""".format(args.max, args.max), file=args.output)
+
+    # one quarter-wave sine table for the largest size, the twiddle factors
+    # of every stage are reconstructed from it by symmetry
+    quarter=args.max//4
+    print("""/* W_sin[m] = sin(2πm/TWIDDLE_MAX_SAMPLES) for 0 <= m <= TWIDDLE_MAX_SAMPLES/4 */
+const double W_sin[{}] =
+{{""".format(quarter+1), file=args.output)
+
+    for m in range(quarter+1):
+        # use the exact values at the ends of the quarter wave
+        if (m == 0):
+            v=0.0
+        elif (m == quarter):
+            v=1.0
+        else:
+            v=math.sin(2*math.pi*m/args.max)
+        print("\t{},".format(repr(v)), file=args.output)
+
     print("};\n", file=args.output)
 
+    if ("split" in args.layout):
+        emit_split(args.max, args.output)
+    if ("dup" in args.layout):
+        emit_dup(args.max, args.output)
+    if ("radix4" in args.layout):
+        emit_radix4(args.max, args.output)
+
     print("#endif /* FFT_TWIDDLE_H */", file=args.output)
 
 if __name__ == "__main__":